@@ -0,0 +1,79 @@
+/**
+ * @file CanCandump_Benchmarks.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the benchmarks for the candump log parser.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <CanCandump.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanCandump;
+using sockcanpp::CanCandumpFrame;
+
+using std::string;
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    /**
+     * @brief Formats lines with payloads of the given length; FD frames for lengths above 8.
+     */
+    vector<string> makeLines(const size_t payloadLength, const size_t count) {
+        vector<string> lines{};
+        char buffer[CanCandump::MAX_LINE_LENGTH];
+        const auto start = system_clock::time_point(nanoseconds(1700000000000000000));
+
+        for (size_t i = 0; i < count; i++) {
+            size_t length = 0;
+
+            if (payloadLength > CAN_MAX_DLEN) {
+                canfd_frame frame{};
+                frame.can_id = static_cast<canid_t>(0x18FEF100 + i) | CAN_EFF_FLAG;
+                frame.len = static_cast<uint8_t>(payloadLength);
+                for (size_t j = 0; j < payloadLength; j++) { frame.data[j] = static_cast<uint8_t>(i * 31 + j); }
+                length = CanCandump::format(buffer, sizeof(buffer), frame, "can0", start + microseconds(i));
+            } else {
+                can_frame frame{};
+                frame.can_id = static_cast<canid_t>(i & CAN_SFF_MASK);
+                frame.can_dlc = static_cast<uint8_t>(payloadLength);
+                for (size_t j = 0; j < payloadLength; j++) { frame.data[j] = static_cast<uint8_t>(i * 31 + j); }
+                length = CanCandump::format(buffer, sizeof(buffer), frame, "can0", start + microseconds(i));
+            }
+
+            lines.emplace_back(buffer, length - 1); // without the newline
+        }
+
+        return lines;
+    }
+
+}
+
+static void CanCandump_parse(benchmark::State& state) {
+    const auto lines = makeLines(static_cast<size_t>(state.range(0)), 1024);
+    CanCandumpFrame frame{};
+    size_t bytes = 0;
+    size_t i = 0;
+
+    for (auto _ : state) {
+        const auto& line = lines[i++ & 1023];
+        benchmark::DoNotOptimize(CanCandump::parse(line.data(), line.size(), frame));
+        bytes += line.size() + 1;
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(CanCandump_parse)->Arg(8)->Arg(64);
@@ -0,0 +1,174 @@
+/**
+ * @file CanDriver_Benchmarks.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the benchmarks for the CanDriver class; the end-to-end benchmarks run over vcan and over a CanVirtualBus.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <CanDriver.hpp>
+#include <CanVirtualBus.hpp>
+#include <exceptions/CanException.hpp>
+#include <exceptions/CanInitException.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanId;
+using sockcanpp::CanMessage;
+using sockcanpp::CanVirtualBus;
+using sockcanpp::filtermap_t;
+using sockcanpp::formatString;
+using sockcanpp::exceptions::CanException;
+using sockcanpp::exceptions::CanInitException;
+
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::unique_ptr;
+using std::chrono::duration_cast;
+using std::chrono::duration;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+    /**
+     * @brief Gets the interface used by the end-to-end benchmarks; vcan0 unless SOCKCANPP_BENCHMARK_INTERFACE is set.
+     */
+    string benchmarkInterface() {
+        const auto interface = std::getenv("SOCKCANPP_BENCHMARK_INTERFACE");
+
+        return interface ? interface : "vcan0";
+    }
+
+    /**
+     * @brief Opens a driver on the benchmark interface, or on the given virtual bus. Marks the benchmark as skipped on failure.
+     */
+    unique_ptr<CanDriver> openDriver(benchmark::State& state, const shared_ptr<CanVirtualBus>& bus = nullptr) {
+        try {
+            if (bus) { return unique_ptr<CanDriver>(new CanDriver(benchmarkInterface(), CanDriver::CAN_SOCK_RAW, bus)); }
+
+            return unique_ptr<CanDriver>(new CanDriver(benchmarkInterface(), CanDriver::CAN_SOCK_RAW));
+        } catch (CanInitException& ex) {
+            state.SkipWithError((benchmarkInterface() + " is unavailable: " + ex.what()).c_str());
+        } catch (CanException& ex) {
+            state.SkipWithError((benchmarkInterface() + " is unavailable: " + ex.what()).c_str());
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Creates a virtual bus if the benchmark's "virtual" argument is set.
+     */
+    shared_ptr<CanVirtualBus> virtualBus(const benchmark::State& state, const int32_t argument) {
+        return state.range(argument) ? make_shared<CanVirtualBus>() : nullptr;
+    }
+
+    /**
+     * @brief Reads until the given amount of messages has been received, or the bus stays silent.
+     */
+    size_t drain(CanDriver& driver, const size_t expected) {
+        size_t received = 0;
+
+        while (received < expected && driver.waitForMessages(milliseconds(100))) {
+            received += driver.readQueuedMessages().size();
+        }
+
+        return received;
+    }
+
+}
+
+static void CanDriver_formatString(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(formatString("FAILED to send CAN message on %s! Error: %d => %s", "vcan0", 105, "No buffer space available"));
+    }
+}
+BENCHMARK(CanDriver_formatString);
+
+static void CanDriver_setCanFilters(benchmark::State& state) {
+    const auto bus = virtualBus(state, 1);
+    auto driver = openDriver(state, bus);
+    filtermap_t filters{};
+
+    for (int64_t i = 0; i < state.range(0); i++) { filters[CanId(static_cast<canid_t>(0x100 + i))] = CAN_SFF_MASK; }
+
+    for (auto _ : state) {
+        driver->setCanFilters(filters);
+    }
+
+    state.counters["filters"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(CanDriver_setCanFilters)->ArgNames({ "filters", "virtual" })->ArgsProduct({ { 1, 16, 256 }, { 0, 1 } });
+
+static void CanDriver_sendMessage(benchmark::State& state) {
+    const auto bus = virtualBus(state, 1);
+    auto sender = openDriver(state, bus);
+    auto receiver = openDriver(state, bus);
+    const CanMessage message(CanId(0x123), string("\x01\x02\x03\x04\x05\x06\x07\x08", 8));
+    const auto batchSize = static_cast<size_t>(state.range(0));
+    size_t lost = 0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < batchSize; i++) { sender->sendMessage(message); }
+
+        // Keep the receive queue from overflowing, without counting the reads
+        state.PauseTiming();
+        lost += batchSize - drain(*receiver, batchSize);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batchSize));
+    state.counters["lost"] = static_cast<double>(lost);
+}
+BENCHMARK(CanDriver_sendMessage)->ArgNames({ "batch", "virtual" })->ArgsProduct({ { 1, 64 }, { 0, 1 } });
+
+static void CanDriver_readQueuedMessages(benchmark::State& state) {
+    const auto bus = virtualBus(state, 1);
+    auto sender = openDriver(state, bus);
+    auto receiver = openDriver(state, bus);
+    const CanMessage message(CanId(0x123), string("\x01\x02\x03\x04\x05\x06\x07\x08", 8));
+    const auto batchSize = static_cast<size_t>(state.range(0));
+    size_t lost = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < batchSize; i++) { sender->sendMessage(message); }
+        state.ResumeTiming();
+
+        lost += batchSize - drain(*receiver, batchSize);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batchSize));
+    state.counters["lost"] = static_cast<double>(lost);
+}
+BENCHMARK(CanDriver_readQueuedMessages)->ArgNames({ "batch", "virtual" })->ArgsProduct({ { 1, 64 }, { 0, 1 } });
+
+static void CanDriver_roundTripLatency(benchmark::State& state) {
+    const auto bus = virtualBus(state, 0);
+    auto sender = openDriver(state, bus);
+    auto receiver = openDriver(state, bus);
+    const CanMessage message(CanId(0x123), string("\x01\x02\x03\x04", 4));
+    size_t lost = 0;
+
+    for (auto _ : state) {
+        const auto start = steady_clock::now();
+
+        sender->sendMessage(message);
+        lost += 1 - drain(*receiver, 1);
+
+        state.SetIterationTime(duration_cast<duration<double>>(steady_clock::now() - start).count());
+    }
+
+    state.counters["lost"] = static_cast<double>(lost);
+}
+BENCHMARK(CanDriver_roundTripLatency)->ArgName("virtual")->Arg(0)->Arg(1)->UseManualTime()->Unit(benchmark::kMicrosecond);
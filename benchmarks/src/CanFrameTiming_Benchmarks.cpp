@@ -0,0 +1,70 @@
+/**
+ * @file CanFrameTiming_Benchmarks.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the benchmarks for the CanFrameTiming and CanBusLoadMeter classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <CanFrameTiming.hpp>
+
+#include <chrono>
+
+using sockcanpp::CanBusLoadMeter;
+using sockcanpp::CanFrameTiming;
+
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+
+static void CanFrameTiming_classicFrameBits(benchmark::State& state) {
+    can_frame frame{};
+    frame.can_id = 0x123;
+    frame.can_dlc = 8;
+    for (uint8_t i = 0; i < 8; i++) { frame.data[i] = i; }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frame);
+        benchmark::DoNotOptimize(CanFrameTiming::frameBits(frame));
+    }
+}
+BENCHMARK(CanFrameTiming_classicFrameBits);
+
+static void CanFrameTiming_fdFrameBits(benchmark::State& state) {
+    canfd_frame frame{};
+    frame.can_id = 0x18FEF100 | CAN_EFF_FLAG;
+    frame.len = static_cast<uint8_t>(state.range(0));
+    frame.flags = CANFD_BRS;
+    for (uint8_t i = 0; i < CANFD_MAX_DLEN; i++) { frame.data[i] = i; }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frame);
+        benchmark::DoNotOptimize(CanFrameTiming::frameBits(frame));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * frame.len);
+}
+BENCHMARK(CanFrameTiming_fdFrameBits)->Arg(8)->Arg(64);
+
+static void CanBusLoadMeter_addBatch(benchmark::State& state) {
+    CanBusLoadMeter meter(500000);
+    can_frame frames[64]{};
+    for (uint32_t i = 0; i < 64; i++) {
+        frames[i].can_id = 0x100 + i;
+        frames[i].can_dlc = 8;
+    }
+
+    auto received = steady_clock::time_point(microseconds(1));
+
+    for (auto _ : state) {
+        meter.add(frames, 64, received);
+        received += microseconds(100);
+    }
+
+    benchmark::DoNotOptimize(meter.getLoad(received));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 64);
+}
+BENCHMARK(CanBusLoadMeter_addBatch);
@@ -0,0 +1,93 @@
+/**
+ * @file CanId_Benchmarks.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the benchmarks for the CanId class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <CanDriver.hpp>
+#include <CanId.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using sockcanpp::CanId;
+using sockcanpp::CanIdHasher;
+using sockcanpp::filtermap_t;
+
+using std::vector;
+
+namespace {
+
+    vector<CanId> makeIds(const size_t count) {
+        vector<CanId> ids{};
+        ids.reserve(count);
+
+        for (size_t i = 0; i < count; i++) { ids.emplace_back(static_cast<canid_t>((i * 2654435761u) & CAN_EFF_MASK) | CAN_EFF_FLAG); }
+
+        return ids;
+    }
+
+}
+
+static void CanId_construct(benchmark::State& state) {
+    canid_t raw = 0x123;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(raw);
+        CanId id(raw);
+        benchmark::DoNotOptimize(id);
+    }
+}
+BENCHMARK(CanId_construct);
+
+static void CanId_bitwiseOperators(benchmark::State& state) {
+    CanId id(0x18FEF100 | CAN_EFF_FLAG);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(id);
+        const auto result = (((id & CAN_EFF_MASK) >> 8) | 0x100) ^ 0x5A;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(CanId_bitwiseOperators);
+
+static void CanId_flagChecks(benchmark::State& state) {
+    CanId id(0x18FEF100 | CAN_EFF_FLAG);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(id);
+        const auto flags = id.isExtendedFrameId() + id.hasRtrFrameFlag() + id.hasErrorFrameFlag() + CanId::isValidIdentifier(*id & CAN_EFF_MASK);
+        benchmark::DoNotOptimize(flags);
+    }
+}
+BENCHMARK(CanId_flagChecks);
+
+static void CanId_hash(benchmark::State& state) {
+    const auto ids = makeIds(1024);
+    const CanIdHasher hasher{};
+    size_t index = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hasher(ids[index++ & 1023]));
+    }
+}
+BENCHMARK(CanId_hash);
+
+static void CanId_filterMapLookup(benchmark::State& state) {
+    const auto ids = makeIds(static_cast<size_t>(state.range(0)));
+    filtermap_t filters{};
+    for (const auto& id : ids) { filters[id] = CAN_EFF_MASK; }
+
+    size_t index = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(filters.find(ids[index++ % ids.size()]));
+    }
+}
+BENCHMARK(CanId_filterMapLookup)->Arg(16)->Arg(256)->Arg(4096);
@@ -0,0 +1,63 @@
+/**
+ * @file CanMessage_Benchmarks.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the benchmarks for the CanMessage class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <CanMessage.hpp>
+
+#include <string>
+
+using sockcanpp::CanId;
+using sockcanpp::CanMessage;
+
+using std::string;
+
+static void CanMessage_constructFromFrame(benchmark::State& state) {
+    can_frame frame{};
+    frame.can_id = 0x123;
+    frame.can_dlc = 8;
+    for (uint8_t i = 0; i < 8; i++) { frame.data[i] = i; }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frame);
+        CanMessage message(frame);
+        benchmark::DoNotOptimize(message);
+    }
+}
+BENCHMARK(CanMessage_constructFromFrame);
+
+static void CanMessage_constructFromPayload(benchmark::State& state) {
+    const string payload("\x01\x02\x03\x04\x05\x06\x07\x08", 8);
+
+    for (auto _ : state) {
+        CanMessage message(CanId(0x123), payload);
+        benchmark::DoNotOptimize(message);
+    }
+}
+BENCHMARK(CanMessage_constructFromPayload);
+
+static void CanMessage_copy(benchmark::State& state) {
+    const CanMessage original(CanId(0x123), string("\x01\x02\x03\x04\x05\x06\x07\x08", 8));
+
+    for (auto _ : state) {
+        CanMessage copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(CanMessage_copy);
+
+static void CanMessage_getFrameData(benchmark::State& state) {
+    const CanMessage message(CanId(0x123), string("\x01\x02\x03\x04\x05\x06\x07\x08", 8));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.getFrameData());
+    }
+}
+BENCHMARK(CanMessage_getFrameData);
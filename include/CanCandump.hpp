@@ -0,0 +1,111 @@
+/**
+ * @file CanCandump.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for formatting and parsing candump log files.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANCANDUMP_HPP
+#define LIBSOCKCANPP_INCLUDE_CANCANDUMP_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace sockcanpp {
+
+    using std::string;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief A frame parsed from a candump log line.
+     *
+     * The interface name points into the parsed text and is only valid as long as the text is.
+     */
+    struct CanCandumpFrame {
+        canfd_frame                 frame{};            //!< The frame; classic frames use the first 8 data bytes
+        bool                        isFd{false};        //!< Whether or not the frame is a CAN FD frame
+        system_clock::time_point    timestamp{};        //!< The time stamp of the line
+        const char*                 interface{nullptr}; //!< The interface name; not NUL-terminated
+        size_t                      interfaceLength{0}; //!< The length of the interface name
+    };
+
+    /**
+     * @brief CanCandump class; converts frames to and from the candump log format.
+     *
+     * Lines look like "(1700000000.123456) can0 123#DEADBEEF", as written by "candump -L" and read by canplayer.
+     * FD frames use "##" followed by the flags nibble, remote frames "#R" with an optional length digit.
+     *
+     * Neither direction allocates memory or uses printf-style formatting.
+     */
+    class CanCandump {
+        public: // +++ Static +++
+            static constexpr size_t     MAX_LINE_LENGTH = 192; //!< A buffer of this size holds any line with an interface name of up to IFNAMSIZ characters
+
+        public: // +++ Formatting +++
+            static size_t               format(char* buffer, const size_t bufferSize, const can_frame& frame, const char* interface, const system_clock::time_point timestamp); //!< Formats a classic frame as a log line
+            static size_t               format(char* buffer, const size_t bufferSize, const canfd_frame& frame, const char* interface, const system_clock::time_point timestamp); //!< Formats an FD frame as a log line
+
+        public: // +++ Parsing +++
+            static bool                 parse(const char* line, const size_t length, CanCandumpFrame& frame); //!< Parses a single log line
+
+        private: // +++ Member Functions +++
+            static size_t               formatFrame(char* buffer, const size_t bufferSize, const canfd_frame& frame, const bool isFd, const char* interface, const system_clock::time_point timestamp);
+    };
+
+    /**
+     * @brief CanCandumpReader class; streams the frames out of a candump log file.
+     *
+     * The file is memory-mapped and scanned in place: lines are split with memchr(), which uses the C library's
+     * vectorised implementation, and parsed without copying. Lines which aren't valid candump lines are skipped
+     * and counted.
+     */
+    class CanCandumpReader {
+        public: // +++ Constructor / Destructor +++
+            explicit CanCandumpReader(const string& path); //!< Constructor
+            virtual ~CanCandumpReader();
+
+            CanCandumpReader(const CanCandumpReader&) = delete;
+            CanCandumpReader& operator=(const CanCandumpReader&) = delete;
+
+        public: // +++ Reading +++
+            bool                        next(CanCandumpFrame& frame); //!< Reads the next frame
+            void                        rewind() { _position = 0; } //!< Starts reading from the beginning again
+
+        public: // +++ Getters +++
+            uint64_t                    getInvalidLineCount() const { return _invalidLines; } //!< The amount of lines skipped because they couldn't be parsed
+
+        private: // +++ Variables +++
+            int32_t                     _fileFd{-1};
+            const char*                 _data{nullptr};
+            size_t                      _size{0};
+            size_t                      _position{0};
+            uint64_t                    _invalidLines{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANCANDUMP_HPP
@@ -0,0 +1,150 @@
+/**
+ * @file CanCaptureRing.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a capture ring which survives a crash of the recording process.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANCAPTURERING_HPP
+#define LIBSOCKCANPP_INCLUDE_CANCAPTURERING_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <sys/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanRecordFormat.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::string;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief The layout of a capture ring's header.
+     *
+     * The magic is written last when a ring is created, so a reader either sees a fully initialised header
+     * or no ring at all.
+     */
+    struct CanCaptureRingHeader {
+        atomic<uint64_t>    magic;          //!< Always CanCaptureRingHeader::MAGIC once the ring is initialised
+        uint32_t            version;        //!< The layout version
+        uint32_t            slotSize;       //!< sizeof(CanCaptureRingSlot)
+        uint64_t            capacity;       //!< The amount of slots; always a power of two
+        uint64_t            dataOffset;     //!< The offset of the first slot from the start of the file
+        int64_t             created;        //!< When the ring was created, in nanoseconds since the epoch
+        int32_t             pid;            //!< The process which created the ring
+
+        alignas(64) atomic<uint64_t> head;  //!< The position of the next frame to be written
+
+        static constexpr uint64_t MAGIC = 0x474e525041434353; //!< "SCCAPRNG"
+        static constexpr uint32_t VERSION = 1;
+    };
+
+    /**
+     * @brief A single slot of a capture ring.
+     *
+     * The sequence is 2p + 1 while the frame at position p is written and 2p + 2 once it is complete,
+     * so a slot the writer died in the middle of is recognised and skipped.
+     */
+    struct CanCaptureRingSlot {
+        atomic<uint64_t>    sequence;
+        atomic<uint64_t>    words[sizeof(CanRecord) / sizeof(uint64_t)]; //!< The CanRecord, as raw words
+    };
+
+    /**
+     * @brief The frames extracted from a capture ring.
+     */
+    struct CanCaptureDump {
+        int32_t             pid{0};         //!< The process which created the ring
+        uint64_t            written{0};     //!< The amount of frames written over the ring's lifetime
+        uint64_t            torn{0};        //!< Slots skipped because they were being written (or overwritten) while extracting
+        vector<CanRecord>   records{};      //!< The extracted frames, oldest first
+    };
+
+    /**
+     * @brief CanCaptureRing class; keeps the most recent traffic in a file-backed ring which outlives the process.
+     *
+     * The ring lives in a shared mapping of a regular file, typically on tmpfs (/dev/shm/...) or hugetlbfs
+     * (e.g. /dev/hugepages/...). Should the process crash, the kernel keeps the file's contents, and
+     * @ref extract() (or the cancapture tool) recovers the last frames written before the crash.
+     *
+     * Recording a frame is wait-free: it copies the frame into the next slot, bracketed by two sequence stores,
+     * and never enters the kernel. The whole file is pre-faulted when the ring is created.
+     *
+     * @remarks
+     * Only a single thread may record frames. Creating a ring moves any existing ring at the given path to
+     * @ref getPreviousPath(), so a restarted process doesn't wipe the capture of the one that crashed; only the
+     * capture before that is lost.
+     */
+    class CanCaptureRing {
+        public: // +++ Constructor / Destructor +++
+            explicit CanCaptureRing(const string& path, const size_t capacity = 65536); //!< Constructor
+            virtual ~CanCaptureRing();
+
+            CanCaptureRing(const CanCaptureRing&) = delete;
+            CanCaptureRing& operator=(const CanCaptureRing&) = delete;
+
+        public: // +++ Recording +++
+            void                        record(const can_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records a classic frame
+            void                        record(const canfd_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records an FD frame
+            size_t                      receiveFrom(CanDriver& driver, const int32_t ifindex = 0, const milliseconds timeout = milliseconds(100)); //!< Waits for frames on a driver and records them
+
+        public: // +++ Extraction +++
+            static CanCaptureDump       extract(const string& path, const size_t maxRecords = 0); //!< Extracts the most recent frames from a ring
+            static string               getPreviousPath(const string& path); //!< Where the ring replaced by a new ring at path is kept
+
+        public: // +++ Getters +++
+            const string&               getPath() const { return _path; } //!< The path of the ring's file
+            size_t                      getCapacity() const { return static_cast<size_t>(_mask + 1); } //!< The amount of frames held by the ring
+            uint64_t                    getWrittenCount() const { return _head; } //!< The amount of frames written
+
+        private: // +++ Member Functions +++
+            void                        write(const canid_t id, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp);
+
+        private: // +++ Variables +++
+            string                      _path;
+
+            int32_t                     _fileFd{-1};
+            size_t                      _mappingSize{0};
+
+            CanCaptureRingHeader*       _header{nullptr};
+            CanCaptureRingSlot*         _slots{nullptr};
+            uint64_t                    _mask{0};
+            uint64_t                    _head{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANCAPTURERING_HPP
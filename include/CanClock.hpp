@@ -0,0 +1,107 @@
+/**
+ * @file CanClock.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for the clocks driving all timing in the library.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANCLOCK_HPP
+#define LIBSOCKCANPP_INCLUDE_CANCLOCK_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::shared_ptr;
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief CanClock class; the source of time for drivers, schedulers and timeouts.
+     *
+     * Everything which waits or measures time (CanDriver::waitForMessages(), the delay of CanDriver::sendMessageQueue(),
+     * request and cycle timeouts, TX queue deadlines and replays) asks its clock instead of the system. Time points are steady_clock time points, so
+     * clocks can be swapped without changing any of the APIs which take or return them.
+     */
+    class CanClock {
+        public: // +++ Destructor +++
+            virtual ~CanClock() = default;
+
+        public: // +++ Time +++
+            virtual steady_clock::time_point now() const = 0; //!< The current time
+            virtual void                sleepFor(const nanoseconds duration) = 0; //!< Waits for the given duration
+            virtual void                sleepUntil(const steady_clock::time_point time); //!< Waits until the given point in time
+            virtual bool                waitReadable(const int32_t fd, const nanoseconds timeout) = 0; //!< Waits until a file descriptor is readable or the timeout elapses
+    };
+
+    /**
+     * @brief CanSteadyClock class; the default clock, using std::chrono::steady_clock and poll().
+     */
+    class CanSteadyClock: public CanClock {
+        public: // +++ Static +++
+            static shared_ptr<CanClock> getDefault(); //!< The clock used by objects which weren't given one
+
+        public: // +++ Time +++
+            steady_clock::time_point    now() const override { return steady_clock::now(); }
+            void                        sleepFor(const nanoseconds duration) override;
+            void                        sleepUntil(const steady_clock::time_point time) override;
+            bool                        waitReadable(const int32_t fd, const nanoseconds timeout) override;
+    };
+
+    /**
+     * @brief CanManualClock class; a clock which only moves when told to.
+     *
+     * Sleeping on a manual clock returns immediately and advances it by the requested duration. Waiting for a file
+     * descriptor checks it without blocking; if it isn't readable, the clock is advanced by the timeout and the
+     * descriptor is checked again. Tests covering hours of traffic therefore run in milliseconds and produce the same
+     * result on every run.
+     *
+     * @remarks
+     * The clock is thread-safe, but time advanced by one thread is seen by all users of the clock.
+     */
+    class CanManualClock: public CanClock {
+        public: // +++ Constructor / Destructor +++
+            explicit CanManualClock(const steady_clock::time_point start = steady_clock::time_point{}); //!< Constructor
+            virtual ~CanManualClock() = default;
+
+        public: // +++ Time +++
+            steady_clock::time_point    now() const override;
+            void                        sleepFor(const nanoseconds duration) override { advance(duration); }
+            void                        sleepUntil(const steady_clock::time_point time) override { advanceTo(time); }
+            bool                        waitReadable(const int32_t fd, const nanoseconds timeout) override;
+
+        public: // +++ Control +++
+            void                        advance(const nanoseconds duration); //!< Moves the clock forward
+            void                        advanceTo(const steady_clock::time_point time); //!< Moves the clock forward to a point in time; earlier times are ignored
+
+        private: // +++ Variables +++
+            atomic<int64_t>             _now{0}; //!< Nanoseconds since the steady_clock epoch
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANCLOCK_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file CanCycleSupervisor.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for supervising the cycle times of periodic CAN messages.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANCYCLESUPERVISOR_HPP
+#define LIBSOCKCANPP_INCLUDE_CANCYCLESUPERVISOR_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanId.hpp"
+#include "CanMessage.hpp"
+#include "CanTimerWheel.hpp"
+
+namespace sockcanpp {
+
+    using std::function;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::unordered_map;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief The kinds of events raised by a @ref CanCycleSupervisor.
+     */
+    enum class CanCycleEventType: uint8_t {
+        Timeout,    //!< The message did not arrive within its period plus tolerance
+        Jitter,     //!< The message arrived, but its cycle time deviated by more than the tolerance
+        Recovered,  //!< The message arrived again after a timeout
+    };
+
+    /**
+     * @brief An event raised by a @ref CanCycleSupervisor.
+     */
+    struct CanCycleEvent {
+        CanCycleEventType           type{CanCycleEventType::Timeout};   //!< What happened
+        CanId                       id{0};                              //!< The monitored ID
+        nanoseconds                 expectedPeriod{0};                  //!< The configured cycle time
+        nanoseconds                 interval{0};                        //!< Time since the previous arrival (Jitter, Recovered) or since the last arrival (Timeout)
+        steady_clock::time_point    time{};                             //!< When the event was detected
+    };
+
+    /**
+     * @brief Statistics for a single monitored ID.
+     */
+    struct CanCycleStatistics {
+        uint64_t    received{0};        //!< The amount of messages received
+        uint64_t    timeouts{0};        //!< The amount of timeouts raised
+        uint64_t    jitterEvents{0};    //!< The amount of jitter violations raised
+        nanoseconds minInterval{0};     //!< The shortest cycle time seen
+        nanoseconds maxInterval{0};     //!< The longest cycle time seen
+        bool        timedOut{false};    //!< Whether or not the message is currently timed out
+    };
+
+    using cycleeventhandler_t = function<void(const CanCycleEvent&)>; //!< Receives supervision events
+
+    /**
+     * @brief CanCycleSupervisor class; detects missing or jittering cyclic messages.
+     *
+     * Feed every received message to @ref onMessage() and call @ref expire() periodically (e.g. after each
+     * call to CanDriver::waitForMessages()). All monitored IDs share a single timer wheel, so supervising
+     * thousands of IDs costs O(1) per received message and requires no additional threads.
+     *
+     * A timeout is raised once when a message stops arriving; a Recovered event is raised when it resumes.
+     * Events are delivered outside of the supervisor's lock.
+     *
+     * The overloads without a time point use the supervisor's clock; with a CanManualClock, hours of cyclic
+     * traffic can be supervised in milliseconds.
+     */
+    class CanCycleSupervisor {
+        public: // +++ Constructor / Destructor +++
+            explicit CanCycleSupervisor(const cycleeventhandler_t& handler, const nanoseconds resolution = milliseconds(1), const shared_ptr<CanClock>& clock = CanSteadyClock::getDefault()); //!< Constructor
+            virtual ~CanCycleSupervisor() = default;
+
+            CanCycleSupervisor(const CanCycleSupervisor&) = delete;
+            CanCycleSupervisor& operator=(const CanCycleSupervisor&) = delete;
+
+        public: // +++ Configuration +++
+            void                        monitor(const CanId id, const nanoseconds period, const nanoseconds tolerance); //!< Starts supervising an ID now
+            void                        monitor(const CanId id, const nanoseconds period, const nanoseconds tolerance, const steady_clock::time_point now); //!< Starts supervising an ID
+            bool                        unmonitor(const CanId id); //!< Stops supervising an ID
+
+        public: // +++ Receive Path +++
+            bool                        onMessage(const CanMessage& message); //!< Records the arrival of a message now
+            bool                        onMessage(const CanMessage& message, const steady_clock::time_point received); //!< Records the arrival of a message
+            size_t                      expire(); //!< Raises timeouts for all IDs overdue by the supervisor's clock
+            size_t                      expire(const steady_clock::time_point now); //!< Raises timeouts for all overdue IDs
+
+        public: // +++ Getters +++
+            CanCycleStatistics          getStatistics(const CanId id) const; //!< Gets the statistics of a monitored ID
+            size_t                      getMonitoredCount() const; //!< The amount of monitored IDs
+
+        private: // +++ Types +++
+            struct Monitor {
+                canid_t                     id{0};
+                nanoseconds                 period{0};
+                nanoseconds                 tolerance{0};
+                steady_clock::time_point    lastArrival{};
+                bool                        hasArrived{false};
+                timerid_t                   timer{CanTimerWheel::INVALID_TIMER};
+                CanCycleStatistics          statistics{};
+            };
+
+        private: // +++ Member Functions +++
+            void                        arm(Monitor& monitor, const uint64_t index, const steady_clock::time_point from);
+            void                        dispatch(const vector<CanCycleEvent>& events) const;
+
+        private: // +++ Variables +++
+            mutable mutex                       _lock{};
+
+            cycleeventhandler_t                 _handler;
+            shared_ptr<CanClock>                _clock;
+            CanTimerWheel                       _timeouts;
+
+            vector<Monitor>                     _monitors{};
+            vector<uint64_t>                    _freeMonitors{};
+            unordered_map<canid_t, uint64_t>    _monitorIndex{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANCYCLESUPERVISOR_HPP
@@ -28,6 +28,13 @@
 //////////////////////////////
 //      SYSTEM INCLUDES     //
 //////////////////////////////
+#include <sys/socket.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -37,8 +44,11 @@
 //////////////////////////////
 //      LOCAL  INCLUDES     //
 //////////////////////////////
+#include "CanClock.hpp"
 #include "CanId.hpp"
+#include "CanLatencyHistogram.hpp"
 #include "CanMessage.hpp"
+#include "CanTransport.hpp"
 
 /**
  * @brief Main library namespace.
@@ -48,13 +58,31 @@
 namespace sockcanpp {
 
     using std::chrono::milliseconds;
+    using std::chrono::nanoseconds;
+    using std::chrono::system_clock;
+    using std::atomic;
+    using std::deque;
+    using std::future;
     using std::mutex;
+    using std::promise;
     using std::string;
     using std::queue;
+    using std::shared_ptr;
     using std::unordered_map;
 
     using filtermap_t = unordered_map<CanId, uint32_t, CanIdHasher>;
 
+    /**
+     * @brief Confirms that a frame sent with CanDriver::sendMessageConfirmed() was transmitted on the bus.
+     */
+    struct CanTxConfirmation {
+        can_frame                   frame{};        //!< The frame as it was sent
+        system_clock::time_point    sent{};         //!< When the frame was handed to the kernel
+        system_clock::time_point    confirmed{};    //!< When the interface reported the frame as transmitted
+
+        nanoseconds latency() const { return std::chrono::duration_cast<nanoseconds>(confirmed - sent); } //!< The send->wire latency
+    };
+
     /**
      * @brief CanDriver class; handles communication via CAN.
      * 
@@ -68,22 +96,27 @@ namespace sockcanpp {
             static constexpr int32_t CAN_MAX_DATA_LENGTH = 8; //!< The maximum amount of bytes allowed in a single CAN frame
             static constexpr int32_t CAN_SOCK_RAW        = CAN_RAW; //!< The raw CAN protocol
             static constexpr int32_t CAN_SOCK_SEVEN      = 7; //!< A separate CAN protocol, used by certain embedded device OEMs.
+            static constexpr size_t  CAN_MAX_BATCH_SIZE  = 64; //!< The maximum amount of frames transferred by a single readFrames()/sendFrames() call
 
         public: // +++ Constructor / Destructor +++
             CanDriver(const string& canInterface, const int32_t canProtocol, const CanId defaultSenderId = 0); //!< Constructor
             CanDriver(const string& canInterface, const int32_t canProtocol, const int32_t filterMask, const CanId defaultSenderId = 0);
             CanDriver(const string& canInterface, const int32_t canProtocol, const filtermap_t& filters, const CanId defaultSenderId = 0);
+            CanDriver(const string& canInterface, const int32_t canProtocol, const shared_ptr<CanTransport>& transport, const filtermap_t& filters = filtermap_t{{0, 0}}, const CanId defaultSenderId = 0); //!< Constructs a driver on a specific transport, e.g. a CanVirtualBus
             CanDriver() = default;
-            virtual ~CanDriver() { uninitialiseSocketCan(); } //!< Destructor
+            virtual ~CanDriver() { if (_socketFd >= 0) { uninitialiseSocketCan(); } } //!< Destructor
 
         public: // +++ Getter / Setter +++
             CanDriver&                  setDefaultSenderId(const CanId id) { this->_defaultSenderId = id; return *this; } //!< Sets the default sender ID
+            CanDriver&                  setClock(const shared_ptr<CanClock>& clock); //!< Sets the clock used for waiting and delays
 
             CanId                       getDefaultSenderId() const { return this->_defaultSenderId; } //!< Gets the default sender ID
 
             filtermap_t                 getFilterMask() const { return this->_canFilterMask; } //!< Gets the filter mask used by this instance
             int32_t                     getMessageQueueSize() const { return this->_queueSize; } //!< Gets the amount of CAN messages found after last calling waitForMessages()
             int32_t                     getSocketFd() const { return this->_socketFd; } //!< The socket file descriptor used by this instance.
+            shared_ptr<CanTransport>    getTransport() const { return this->_transport; } //!< The transport this instance's socket was created with
+            shared_ptr<CanClock>        getClock() const; //!< The clock used for waiting and delays
 
         public: // +++ I/O +++
             virtual bool                waitForMessages(milliseconds timeout = milliseconds(3000)); //!< Waits for CAN messages to appear
@@ -95,16 +128,40 @@ namespace sockcanpp {
              
             virtual queue<CanMessage>   readQueuedMessages(); //!< Attempts to read all queued messages from the bus
 
+            virtual size_t              readFrames(can_frame* frames, const size_t maxFrames); //!< Reads up to maxFrames raw frames with a single system call
+            virtual size_t              sendFrames(const can_frame* frames, const size_t frameCount); //!< Sends up to frameCount raw frames with a single system call
+
             virtual void                setCanFilterMask(const int32_t mask, const CanId& filterId); //!< Attempts to set a new CAN filter mask to the interface
             virtual void                setCanFilters(const filtermap_t& filters); //!< Sets the CAN filters for the interface
 
+        public: // +++ TX Confirmation +++
+            virtual CanDriver&          setTxConfirmation(const bool enabled); //!< Enables or disables confirmation of transmitted frames
+            bool                        isTxConfirmationEnabled() const { return _txConfirmation; } //!< Whether or not transmitted frames are confirmed
+
+            virtual future<CanTxConfirmation> sendMessageConfirmed(const CanMessage& message, bool forceExtended = false); //!< Sends a message and tracks its transmission
+
+            size_t                      getPendingConfirmationCount() const; //!< The amount of frames sent but not yet confirmed
+            CanLatencyHistogram::Snapshot getTxLatencyHistogram() const { return _txLatency.snapshot(); } //!< Send->wire latency of confirmed frames
+
         protected: // +++ Socket Management +++
             virtual void                initialiseSocketCan(); //!< Initialises socketcan
             virtual void                uninitialiseSocketCan(); //!< Uninitialises socketcan
+            virtual ssize_t             receiveMessage(msghdr& message); //!< Receives a single message, including its flags and ancillary data
+
+        private: // +++ Types +++
+            struct PendingConfirmation {
+                uint64_t                    sequence{0};
+                can_frame                   frame{};
+                system_clock::time_point    sent{};
+                promise<CanTxConfirmation>  confirmation{};
+            };
 
         private: // +++ Member Functions +++
             virtual CanMessage          readMessageLock(bool const lock = true); //!< readMessage deadlock guard
 
+            bool                        receiveFrame(can_frame& frame); //!< Reads a single frame, consuming TX confirmations
+            void                        confirmTransmission(const can_frame& frame, const msghdr& message); //!< Completes the pending send matching an echoed frame
+
         private: // +++ Variables +++
             
             CanId       _defaultSenderId; //!< The ID to send messages with if no other ID was set.
@@ -116,10 +173,19 @@ namespace sockcanpp {
             int32_t     _queueSize{0}; ///!< The size of the message queue read by waitForMessages()
 
             //!< Mutex for thread-safety.
-            mutex       _lock{};
+            mutable mutex _lock{};
             mutex       _lockSend{}; 
 
+            atomic<bool>                _txConfirmation{false}; //!< Whether CAN_RAW_RECV_OWN_MSGS is enabled
+            mutable mutex               _lockConfirm{}; //!< Guards the pending confirmations
+            deque<PendingConfirmation>  _pendingConfirmations{}; //!< Sent frames awaiting their echo, oldest first
+            uint64_t                    _nextConfirmation{0};
+            CanLatencyHistogram         _txLatency{}; //!< Written by the receiving thread
+
             string      _canInterface; //!< The CAN interface used for communication (e.g. can0, can1, ...)
+
+            shared_ptr<CanTransport>    _transport{}; //!< Creates and configures the socket; SocketCAN unless set otherwise
+            shared_ptr<CanClock>        _clock{CanSteadyClock::getDefault()}; //!< Times waits and delays
             
     };
 
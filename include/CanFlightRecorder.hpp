@@ -0,0 +1,191 @@
+/**
+ * @file CanFlightRecorder.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for the pre-trigger flight recorder.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANFLIGHTRECORDER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANFLIGHTRECORDER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanRecordFormat.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::condition_variable;
+    using std::deque;
+    using std::function;
+    using std::mutex;
+    using std::thread;
+    using std::unique_ptr;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::nanoseconds;
+    using std::chrono::seconds;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief Why a @ref CanFlightRecorder took a snapshot.
+     */
+    enum class CanFlightTriggerReason: uint8_t {
+        Manual,     //!< CanFlightRecorder::trigger() was called
+        Pattern,    //!< A recorded frame matched a trigger pattern
+        ErrorFrame, //!< An error frame was recorded
+    };
+
+    /**
+     * @brief A frame pattern which triggers a snapshot.
+     *
+     * A frame matches if (can_id & mask) == (id & mask) and, for each of the first 8 payload bytes,
+     * (payload[i] & dataMask[i]) == (data[i] & dataMask[i]).
+     */
+    struct CanFlightPattern {
+        CanFlightPattern(const canid_t id, const canid_t mask = CAN_EFF_FLAG | CAN_EFF_MASK): id(id), mask(mask) { } //!< Constructor
+
+        canid_t     id{0};                      //!< The ID to match
+        canid_t     mask{0};                    //!< The bits of the ID to compare
+        uint8_t     data[CAN_MAX_DLEN]{};       //!< The payload to match
+        uint8_t     dataMask[CAN_MAX_DLEN]{};   //!< The bits of the payload to compare; all zero ignores the payload
+    };
+
+    /**
+     * @brief The traffic leading up to a trigger.
+     */
+    struct CanFlightSnapshot {
+        system_clock::time_point    triggered{};                            //!< When the trigger fired
+        CanFlightTriggerReason      reason{CanFlightTriggerReason::Manual}; //!< What fired the trigger
+        vector<CanRecord>           records{};                              //!< The frames within the pre-trigger window, oldest first
+    };
+
+    /**
+     * @brief Statistics kept by a @ref CanFlightRecorder.
+     */
+    struct CanFlightRecorderStatistics {
+        uint64_t    recorded{0};        //!< Frames recorded
+        uint64_t    triggers{0};        //!< Triggers which froze a snapshot
+        uint64_t    missedTriggers{0};  //!< Triggers ignored because every spare region still held an unwritten snapshot
+    };
+
+    using snapshothandler_t = function<void(const CanFlightSnapshot& snapshot)>; //!< Receives snapshots on the background thread
+
+    /**
+     * @brief CanFlightRecorder class; keeps the most recent traffic in memory and preserves it when a fault occurs.
+     *
+     * Frames are written into the active region, a ring of fixed-size records which overwrites its oldest entries.
+     * A trigger atomically swaps a spare region in, so capture continues without a gap, and hands the frozen region
+     * to a background thread. That thread extracts the frames within the pre-trigger window and passes them to the
+     * snapshot handler, e.g. to write them to disk, then returns the region to the spare pool.
+     *
+     * Recording a frame never takes a lock or waits: the recording thread only publishes which region it is writing
+     * to, and the triggering thread waits for that write to finish before handing the region over.
+     *
+     * @remarks
+     * Only a single thread may record frames. @ref trigger() may be called from any thread.
+     */
+    class CanFlightRecorder {
+        public: // +++ Constructor / Destructor +++
+            explicit CanFlightRecorder(const snapshothandler_t& handler, const size_t capacity = 65536, const nanoseconds preTrigger = seconds(10), const size_t regionCount = 3); //!< Constructor
+            virtual ~CanFlightRecorder();
+
+            CanFlightRecorder(const CanFlightRecorder&) = delete;
+            CanFlightRecorder& operator=(const CanFlightRecorder&) = delete;
+
+        public: // +++ Configuration +++
+            void                        addTrigger(const CanFlightPattern& pattern); //!< Adds a frame pattern which triggers a snapshot; call before recording
+            void                        setErrorFrameTrigger(const bool enabled) { _errorFrameTrigger = enabled; } //!< Whether or not error frames trigger a snapshot; call before recording
+
+        public: // +++ Recording +++
+            bool                        record(const can_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records a classic frame
+            bool                        record(const canfd_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records an FD frame
+            size_t                      receiveFrom(CanDriver& driver, const int32_t ifindex = 0, const milliseconds timeout = milliseconds(100)); //!< Waits for frames on a driver and records them
+
+            bool                        trigger(); //!< Freezes a snapshot of the pre-trigger window
+            void                        waitForSnapshots(); //!< Waits until all triggered snapshots have been handled
+
+        public: // +++ Getters +++
+            size_t                      getCapacity() const { return _mask + 1; } //!< The amount of frames held by a region
+            CanFlightRecorderStatistics getStatistics() const; //!< Gets the recorder's statistics
+
+        private: // +++ Types +++
+            struct Region {
+                vector<CanRecord>       records{};
+                atomic<uint64_t>        head{0};        //!< The amount of frames written into the region
+                atomic<bool>            writing{false}; //!< Set while the recording thread writes into the region
+            };
+
+            struct Pending {
+                uint32_t                    region{0};
+                system_clock::time_point    triggered{};
+                CanFlightTriggerReason      reason{CanFlightTriggerReason::Manual};
+            };
+
+        private: // +++ Member Functions +++
+            bool                        append(const canid_t id, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp);
+            bool                        freeze(const CanFlightTriggerReason reason, const system_clock::time_point triggered);
+            void                        writerLoop();
+
+        private: // +++ Variables +++
+            snapshothandler_t           _handler;
+            nanoseconds                 _preTrigger{0};
+            uint64_t                    _mask{0};
+
+            vector<unique_ptr<Region>>  _regions{};
+            atomic<uint32_t>            _activeRegion{0};
+
+            vector<CanFlightPattern>    _patterns{};
+            bool                        _errorFrameTrigger{false};
+
+            mutable mutex               _lock{};
+            condition_variable          _snapshotsChanged{};
+            vector<uint32_t>            _spareRegions{};
+            deque<Pending>              _pending{};
+            size_t                      _handling{0}; //!< Snapshots taken off the queue but not yet handled
+            bool                        _stopping{false};
+            thread                      _writer{};
+
+            atomic<uint64_t>            _recorded{0};
+            atomic<uint64_t>            _triggers{0};
+            atomic<uint64_t>            _missedTriggers{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANFLIGHTRECORDER_HPP
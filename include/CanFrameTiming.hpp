@@ -0,0 +1,146 @@
+/**
+ * @file CanFrameTiming.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for computing the exact length of frames on the wire and the resulting bus load.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANFRAMETIMING_HPP
+#define LIBSOCKCANPP_INCLUDE_CANFRAMETIMING_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanId.hpp"
+#include "CanMessage.hpp"
+
+namespace sockcanpp {
+
+    using std::array;
+    using std::shared_ptr;
+    using std::chrono::nanoseconds;
+    using std::chrono::seconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief The length of a frame on the wire.
+     */
+    struct CanFrameBits {
+        uint32_t    bits{0};            //!< The frame's length from start of frame to end of frame, including stuff bits; excluding the interframe space
+        uint32_t    stuffBits{0};       //!< The amount of stuff bits (dynamic and, for FD frames, fixed) included in bits
+        uint32_t    dataPhaseBits{0};   //!< The bits included in bits which are sent at the data bitrate; zero unless the frame is an FD frame with BRS
+    };
+
+    /**
+     * @brief CanFrameTiming class; computes the exact length of classic and FD frames on the wire.
+     *
+     * The frame is built field by field as a controller would send it and bit stuffing is applied exactly:
+     * for classic frames, this includes the CRC, whose bits are stuffed as well. For FD frames, the stuff count
+     * and CRC are protected by fixed stuff bits instead, so their value doesn't affect the frame's length.
+     *
+     * Both the CRC and the stuffing are table-driven, eight bits at a time, so computing a frame's length
+     * costs a few table lookups per payload byte and is cheap enough for the receive path at full bus rate.
+     */
+    class CanFrameTiming {
+        public: // +++ Static +++
+            static constexpr uint32_t   INTERFRAME_BITS = 3; //!< The length of the interframe space
+
+            static CanFrameBits         frameBits(const canid_t id, const uint8_t* data, const uint8_t length, const bool fd, const uint8_t fdFlags = 0); //!< The length of a frame with the given ID and payload
+            static CanFrameBits         frameBits(const can_frame& frame); //!< The length of a classic frame
+            static CanFrameBits         frameBits(const canfd_frame& frame); //!< The length of an FD frame
+            static CanFrameBits         frameBits(const CanMessage& message); //!< The length of a message sent as a classic frame
+
+            static uint32_t             worstCaseFrameBits(const bool extended, const uint8_t length); //!< The longest a classic frame with the given payload length can be on the wire
+            static nanoseconds          frameTime(const CanFrameBits& bits, const uint32_t bitrate, const uint32_t dataBitrate = 0); //!< The time a frame and its interframe space occupy the bus
+
+            static uint64_t             arbitrationKey(const canid_t id); //!< The arbitration field as sent on the wire; the lower value wins arbitration
+
+            static uint8_t              fdLengthToDlc(const uint8_t length); //!< Gets the DLC of the shortest FD payload which holds the given amount of bytes
+            static uint8_t              fdDlcToLength(const uint8_t dlc); //!< Gets the payload length of an FD DLC
+    };
+
+    /**
+     * @brief CanBusLoadMeter class; measures the bus load from a stream of received frames.
+     *
+     * Each frame's exact length (see @ref CanFrameTiming) is added to one of BUCKET_COUNT buckets which together
+     * span the measurement window; the load is the time the frames occupied the bus within the last window,
+     * divided by the window's length. Adding a frame costs one length computation and a few additions.
+     *
+     * The overloads without a time point use the meter's clock.
+     *
+     * @remarks
+     * The meter is designed to be fed and read from a single thread, e.g. the receive loop.
+     */
+    class CanBusLoadMeter {
+        public: // +++ Static +++
+            static constexpr size_t     BUCKET_COUNT = 16; //!< The amount of buckets the window is divided into
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanBusLoadMeter(const uint32_t bitrate = 500000, const uint32_t dataBitrate = 0, const nanoseconds window = seconds(1), const shared_ptr<CanClock>& clock = CanSteadyClock::getDefault()); //!< Constructor
+            virtual ~CanBusLoadMeter() = default;
+
+        public: // +++ Recording +++
+            void                        add(const can_frame& frame); //!< Adds a classic frame received now
+            void                        add(const can_frame& frame, const steady_clock::time_point received); //!< Adds a classic frame
+            void                        add(const canfd_frame& frame); //!< Adds an FD frame received now
+            void                        add(const canfd_frame& frame, const steady_clock::time_point received); //!< Adds an FD frame
+            void                        add(const CanMessage& message); //!< Adds a message received now
+            void                        add(const CanMessage& message, const steady_clock::time_point received); //!< Adds a message
+            void                        add(const can_frame* frames, const size_t frameCount); //!< Adds a batch of classic frames received now
+            void                        add(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received); //!< Adds a batch of classic frames
+
+            void                        reset(); //!< Forgets all frames
+
+        public: // +++ Getters +++
+            double                      getLoad() const; //!< The bus load within the last window, as of now
+            double                      getLoad(const steady_clock::time_point now) const; //!< The bus load within the window ending at the given time
+            uint64_t                    getFrameCount() const { return _frames; } //!< The amount of frames added since construction or the last reset
+            nanoseconds                 getBusyTime() const { return nanoseconds(static_cast<int64_t>(_busyPicoseconds / 1000)); } //!< The time all frames added occupied the bus
+
+        private: // +++ Member Functions +++
+            void                        addBusy(const uint64_t picoseconds, const steady_clock::time_point received, const size_t frameCount = 1);
+
+        private: // +++ Variables +++
+            uint64_t                    _bitPicoseconds{0};     //!< The length of a bit at the nominal bitrate
+            uint64_t                    _dataBitPicoseconds{0}; //!< The length of a bit at the data bitrate
+            int64_t                     _bucketWidth{0};        //!< In nanoseconds
+            shared_ptr<CanClock>        _clock;
+
+            array<uint64_t, BUCKET_COUNT> _buckets{};           //!< Busy time per bucket, in picoseconds
+            array<int64_t, BUCKET_COUNT>  _bucketNumbers{};     //!< The absolute number of the bucket each slot currently holds
+
+            uint64_t                    _frames{0};
+            uint64_t                    _busyPicoseconds{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANFRAMETIMING_HPP
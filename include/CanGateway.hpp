@@ -0,0 +1,181 @@
+/**
+ * @file CanGateway.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for managing kernel CAN gateway (CAN_GW) routing rules.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANGATEWAY_HPP
+#define LIBSOCKCANPP_INCLUDE_CANGATEWAY_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <linux/can/gw.h>
+#include <linux/netlink.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanId.hpp"
+
+namespace sockcanpp {
+
+    using std::mutex;
+    using std::string;
+    using std::vector;
+
+    /**
+     * @brief The operations the kernel gateway can apply to a routed frame.
+     */
+    enum class CanGatewayModOp: uint16_t {
+        And = CGW_MOD_AND, //!< Binary AND with the given frame
+        Or  = CGW_MOD_OR,  //!< Binary OR with the given frame
+        Xor = CGW_MOD_XOR, //!< Binary XOR with the given frame
+        Set = CGW_MOD_SET, //!< Replace with the values of the given frame
+    };
+
+    /**
+     * @brief Describes a single modification applied by the kernel to each routed frame.
+     *
+     * The @ref elements field is a combination of CGW_MOD_ID, CGW_MOD_DLC and CGW_MOD_DATA
+     * and selects which parts of @ref frame the operation is applied to.
+     */
+    struct CanGatewayModification {
+        CanGatewayModOp op{CanGatewayModOp::Set}; //!< The operation to apply
+        uint8_t         elements{0};              //!< The frame elements affected (CGW_MOD_*)
+        can_frame       frame{};                  //!< The operand
+
+        CanGatewayModification() = default;
+        CanGatewayModification(const CanGatewayModOp op, const uint8_t elements, const can_frame& frame): op(op), elements(elements), frame(frame) { }
+    };
+
+    /**
+     * @brief Describes a CRC8 checksum the kernel writes into each routed frame.
+     *
+     * The lookup table is generated from @ref polynomial (MSB first), as the cangw utility does.
+     */
+    struct CanGatewayCrc8 {
+        bool    enabled{false};     //!< Whether or not the checksum is calculated
+        int8_t  fromIndex{0};       //!< First data byte included in the checksum
+        int8_t  toIndex{0};         //!< Last data byte included in the checksum
+        int8_t  resultIndex{0};     //!< The data byte the checksum is written to
+        uint8_t initialValue{0};    //!< The initial CRC value
+        uint8_t finalXor{0};        //!< Value XOR'd into the final CRC
+        uint8_t polynomial{0x1d};   //!< The CRC8 polynomial (default: SAE J1850)
+        uint8_t profile{CGW_CRC8PRF_UNSPEC}; //!< Additional data profile (CGW_CRC8PRF_*)
+        uint8_t profileData[20]{};  //!< Data required by the profile
+    };
+
+    /**
+     * @brief Describes an XOR checksum the kernel writes into each routed frame.
+     */
+    struct CanGatewayXorChecksum {
+        bool    enabled{false};  //!< Whether or not the checksum is calculated
+        int8_t  fromIndex{0};    //!< First data byte included in the checksum
+        int8_t  toIndex{0};      //!< Last data byte included in the checksum
+        int8_t  resultIndex{0};  //!< The data byte the checksum is written to
+        uint8_t initialValue{0}; //!< The initial XOR value
+    };
+
+    /**
+     * @brief Describes a single CAN->CAN routing rule handled by the kernel's can-gw module.
+     */
+    struct CanGatewayRule {
+        string                          sourceInterface;      //!< The interface frames are received on (e.g. can0)
+        string                          destinationInterface; //!< The interface frames are routed to (e.g. can1)
+
+        bool                            hasFilter{false};     //!< Whether or not @ref filter is applied
+        can_filter                      filter{};             //!< The filter applied on the source interface
+
+        vector<CanGatewayModification>  modifications{};      //!< Modifications applied to each routed frame
+        CanGatewayXorChecksum           xorChecksum{};        //!< Optional XOR checksum
+        CanGatewayCrc8                  crc8{};               //!< Optional CRC8 checksum
+
+        uint8_t                         hopLimit{0};          //!< Max hops for frames routed by this rule (0 = module default)
+        uint32_t                        modificationUid{0};   //!< If non-zero, allows modifications to be updated in-place
+        uint16_t                        flags{0};             //!< Combination of CGW_FLAGS_CAN_*
+
+        CanGatewayRule() = default;
+        CanGatewayRule(const string& source, const string& destination): sourceInterface(source), destinationInterface(destination) { }
+
+        CanGatewayRule& setFilter(const CanId& id, const uint32_t mask) { filter = { *id, mask }; hasFilter = true; return *this; } //!< Only route matching frames
+        CanGatewayRule& addModification(const CanGatewayModOp op, const uint8_t elements, const can_frame& frame) { modifications.emplace_back(op, elements, frame); return *this; } //!< Adds a frame modification
+    };
+
+    /**
+     * @brief A routing rule read back from the kernel, along with its statistics.
+     */
+    struct CanGatewayRuleInfo {
+        CanGatewayRule  rule;        //!< The rule as reported by the kernel
+        uint32_t        handled{0};  //!< The amount of frames routed by this rule
+        uint32_t        dropped{0};  //!< The amount of frames which could not be routed
+        uint32_t        deleted{0};  //!< The amount of frames deleted due to the hop limit
+    };
+
+    /**
+     * @brief CanGateway class; programs kernel CAN gateway rules via rtnetlink.
+     *
+     * Frames matching a rule are routed from one interface to another entirely within the kernel,
+     * without being copied to userspace.
+     *
+     * @remarks
+     * Modifying rules requires CAP_NET_ADMIN and the can-gw kernel module.
+     */
+    class CanGateway {
+        public: // +++ Constructor / Destructor +++
+            CanGateway(); //!< Constructor
+            virtual ~CanGateway(); //!< Destructor
+
+            CanGateway(const CanGateway&) = delete;
+            CanGateway& operator=(const CanGateway&) = delete;
+
+        public: // +++ Rule Management +++
+            virtual void                        addRule(const CanGatewayRule& rule); //!< Adds (or updates) a routing rule
+            virtual void                        removeRule(const CanGatewayRule& rule); //!< Removes a routing rule
+            virtual void                        clearRules(); //!< Removes all routing rules
+
+            virtual vector<CanGatewayRuleInfo>  getRules(); //!< Reads all rules and their statistics from the kernel
+
+        public: // +++ Helpers +++
+            static void                         generateCrc8Table(const uint8_t polynomial, uint8_t (&table)[256]); //!< Generates a CRC8 lookup table
+            static void                         appendRule(nlmsghdr* header, const size_t capacity, const CanGatewayRule& rule); //!< Serialises a rule into a gateway request
+            static void                         appendFlush(nlmsghdr* header, const size_t capacity); //!< Makes a gateway request address all rules
+            static CanGatewayRuleInfo           parseRule(const nlmsghdr* header); //!< Parses a rule dumped by the kernel
+
+        private: // +++ Member Functions +++
+            void                                sendRequest(const uint16_t type, const uint16_t flags, const CanGatewayRule* rule); //!< Sends a request and waits for its acknowledgement
+
+        private: // +++ Variables +++
+            int32_t     _netlinkFd{-1}; //!< The rtnetlink socket
+            uint32_t    _sequence{0};   //!< The sequence number of the last request
+
+            mutex       _lock{};        //!< Mutex for thread-safety.
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANGATEWAY_HPP
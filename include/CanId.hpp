@@ -232,6 +232,15 @@ namespace sockcanpp {
             size_t operator()(const CanId& id) const { return std::hash<canid_t>()(*id); }
     };
 
+    /**
+     * @brief Strips the RTR/error flags from an ID and marks IDs which don't fit into 11 bits as extended.
+     *
+     * Gives every standard and extended ID a single key, whether or not CAN_EFF_FLAG was set by the caller.
+     */
+    constexpr canid_t normaliseCanId(const canid_t id) {
+        return (id & CAN_EFF_MASK) > CAN_SFF_MASK ? (id & CAN_EFF_MASK) | CAN_EFF_FLAG : id & (CAN_EFF_FLAG | CAN_EFF_MASK);
+    }
+
 }
 
 #endif // LIBSOCKPP_INCLUDE_CANID_HPP
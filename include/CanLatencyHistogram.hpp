@@ -0,0 +1,171 @@
+/**
+ * @file CanLatencyHistogram.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of a lightweight, logarithmic latency histogram.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANLATENCYHISTOGRAM_HPP
+#define LIBSOCKCANPP_INCLUDE_CANLATENCYHISTOGRAM_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace sockcanpp {
+
+    using std::array;
+    using std::atomic;
+    using std::chrono::nanoseconds;
+
+    /**
+     * @brief A histogram of latencies with power-of-two nanosecond buckets.
+     *
+     * Bucket n counts samples in the range [2^n, 2^(n+1)) ns; bucket 0 additionally counts 0 ns.
+     * The histogram is designed for a single writer; any thread may take a snapshot at any time.
+     */
+    class CanLatencyHistogram {
+        public: // +++ Static +++
+            static constexpr size_t BUCKET_COUNT = 48; //!< Covers latencies up to ~78 hours
+
+            /**
+             * @brief A point-in-time copy of a histogram.
+             */
+            struct Snapshot {
+                array<uint64_t, BUCKET_COUNT>   buckets{};  //!< The sample counts per bucket
+                uint64_t                        count{0};   //!< The total amount of samples
+                uint64_t                        sum{0};     //!< The sum of all samples (ns)
+                uint64_t                        min{0};     //!< The smallest sample (ns)
+                uint64_t                        max{0};     //!< The largest sample (ns)
+
+                /**
+                 * @brief Gets the mean latency.
+                 */
+                nanoseconds mean() const { return nanoseconds(count ? sum / count : 0); }
+
+                /**
+                 * @brief Gets an upper bound for the given percentile.
+                 *
+                 * @param percentile The percentile to get, in the range [0, 100].
+                 *
+                 * @return nanoseconds The upper bound of the bucket containing the percentile.
+                 */
+                nanoseconds percentile(const double percentile) const {
+                    if (!count) { return nanoseconds(0); }
+
+                    const auto target = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count) + 0.5);
+                    uint64_t seen = 0;
+
+                    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+                        seen += buckets[i];
+                        if (seen >= target && seen > 0) { return nanoseconds(std::min<uint64_t>(max, (uint64_t(2) << i) - 1)); }
+                    }
+
+                    return nanoseconds(max);
+                }
+            };
+
+        public: // +++ Constructor / Destructor +++
+            CanLatencyHistogram() { reset(); }
+
+            CanLatencyHistogram(const CanLatencyHistogram&) = delete;
+            CanLatencyHistogram& operator=(const CanLatencyHistogram&) = delete;
+
+        public: // +++ Recording +++
+            /**
+             * @brief Records one or more samples with the same latency.
+             *
+             * @param latency The latency to record. Negative values are recorded as zero.
+             * @param samples The amount of samples to record.
+             */
+            void record(const nanoseconds latency, const uint64_t samples = 1) {
+                const auto value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : uint64_t(0);
+                auto& bucket = _buckets[bucketIndex(value)];
+
+                increment(bucket, samples);
+                increment(_count, samples);
+                increment(_sum, value * samples);
+
+                if (value < _min.load(std::memory_order_relaxed)) { _min.store(value, std::memory_order_relaxed); }
+                if (value > _max.load(std::memory_order_relaxed)) { _max.store(value, std::memory_order_relaxed); }
+            }
+
+            /**
+             * @brief Clears all recorded samples.
+             */
+            void reset() {
+                for (auto& bucket : _buckets) { bucket.store(0, std::memory_order_relaxed); }
+
+                _count.store(0, std::memory_order_relaxed);
+                _sum.store(0, std::memory_order_relaxed);
+                _min.store(UINT64_MAX, std::memory_order_relaxed);
+                _max.store(0, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Takes a snapshot of the histogram.
+             */
+            Snapshot snapshot() const {
+                Snapshot snapshot{};
+
+                for (size_t i = 0; i < BUCKET_COUNT; i++) { snapshot.buckets[i] = _buckets[i].load(std::memory_order_relaxed); }
+
+                snapshot.count = _count.load(std::memory_order_relaxed);
+                snapshot.sum = _sum.load(std::memory_order_relaxed);
+                snapshot.max = _max.load(std::memory_order_relaxed);
+                snapshot.min = snapshot.count ? _min.load(std::memory_order_relaxed) : 0;
+
+                return snapshot;
+            }
+
+            /**
+             * @brief Gets the bucket a latency value falls into.
+             */
+            static size_t bucketIndex(const uint64_t value) {
+                if (value < 2) { return 0; }
+
+                const auto index = static_cast<size_t>(63 - __builtin_clzll(value));
+                return index < BUCKET_COUNT ? index : BUCKET_COUNT - 1;
+            }
+
+        private: // +++ Helpers +++
+            /**
+             * @brief Single-writer increment; avoids a locked read-modify-write.
+             */
+            static void increment(atomic<uint64_t>& counter, const uint64_t value) {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+        private: // +++ Variables +++
+            array<atomic<uint64_t>, BUCKET_COUNT>   _buckets;
+            atomic<uint64_t>                        _count{0};
+            atomic<uint64_t>                        _sum{0};
+            atomic<uint64_t>                        _min{UINT64_MAX};
+            atomic<uint64_t>                        _max{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANLATENCYHISTOGRAM_HPP
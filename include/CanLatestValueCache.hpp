@@ -0,0 +1,132 @@
+/**
+ * @file CanLatestValueCache.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a lock-free store of the most recent frame per CAN ID.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANLATESTVALUECACHE_HPP
+#define LIBSOCKCANPP_INCLUDE_CANLATESTVALUECACHE_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanId.hpp"
+#include "CanMessage.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::vector;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief The most recent frame received for an ID.
+     */
+    struct CanLatestValue {
+        can_frame                   frame{};        //!< The frame, as received
+        steady_clock::time_point    received{};     //!< When the frame was received
+        uint64_t                    updates{0};     //!< The amount of frames received for this ID; zero if none has been received yet
+    };
+
+    /**
+     * @brief CanLatestValueCache class; keeps the newest frame of every CAN ID.
+     *
+     * The receive path calls @ref update() for every frame; readers on any thread call @ref read() or
+     * @ref snapshot() to get the latest value of one or many IDs. Each entry is guarded by a sequence
+     * lock, so readers never block writers, never take a mutex and only copy the entries they ask for.
+     *
+     * Standard IDs are stored in a flat table indexed by ID. Extended IDs are stored in an open-addressed
+     * table whose capacity is fixed at construction; once it is full, frames with new extended IDs are
+     * dropped and counted. Memory usage therefore never grows after construction.
+     *
+     * Error frames and remote requests are not cached.
+     */
+    class CanLatestValueCache {
+        public: // +++ Static +++
+            static constexpr size_t STANDARD_ID_COUNT = CAN_SFF_MASK + 1; //!< The amount of standard IDs
+            static constexpr uint32_t DEFAULT_SNAPSHOT_ATTEMPTS = 16; //!< The default amount of attempts made by @ref snapshot()
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanLatestValueCache(const size_t extendedCapacity = 1024); //!< Constructor
+            virtual ~CanLatestValueCache() = default;
+
+            CanLatestValueCache(const CanLatestValueCache&) = delete;
+            CanLatestValueCache& operator=(const CanLatestValueCache&) = delete;
+
+        public: // +++ Writing +++
+            bool                        update(const can_frame& frame, const steady_clock::time_point received = steady_clock::now()); //!< Stores a received frame
+            bool                        update(const CanMessage& message, const steady_clock::time_point received = steady_clock::now()); //!< Stores a received message
+            size_t                      update(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received = steady_clock::now()); //!< Stores a batch of received frames
+
+        public: // +++ Reading +++
+            bool                        read(const CanId id, CanLatestValue& value) const; //!< Reads the latest value of a single ID
+            bool                        snapshot(const vector<CanId>& ids, vector<CanLatestValue>& values, const uint32_t attempts = DEFAULT_SNAPSHOT_ATTEMPTS) const; //!< Reads the latest values of several IDs at the same point in time
+
+        public: // +++ Getters +++
+            size_t                      getExtendedCapacity() const { return _extendedCapacity; } //!< The maximum amount of extended IDs
+            size_t                      getExtendedCount() const { return _extendedCount.load(std::memory_order_relaxed); } //!< The amount of extended IDs stored
+            uint64_t                    getDroppedCount() const { return _droppedFrames.load(std::memory_order_relaxed); } //!< The amount of frames dropped because the extended table was full
+
+        private: // +++ Types +++
+            /**
+             * @brief A sequence-locked entry. The sequence is odd while the entry is being written.
+             */
+            struct Slot {
+                atomic<uint64_t>    sequence{0};
+                atomic<canid_t>     key{0};         //!< The normalised ID; only used by the extended table
+                atomic<uint64_t>    words[2];       //!< The frame, as raw words
+                atomic<int64_t>     received{0};    //!< The receive time, in steady_clock ticks
+
+                Slot() { words[0].store(0, std::memory_order_relaxed); words[1].store(0, std::memory_order_relaxed); }
+            };
+
+        private: // +++ Member Functions +++
+            static void                 write(Slot& slot, const can_frame& frame, const steady_clock::time_point received);
+            static uint64_t             readSlot(const Slot& slot, CanLatestValue& value);
+
+            size_t                      hashId(const canid_t key) const;
+            Slot*                       findSlot(const canid_t key);
+            const Slot*                 findSlot(const canid_t key) const;
+
+        private: // +++ Variables +++
+            vector<Slot>                _standardSlots;
+            vector<Slot>                _extendedSlots{};
+            size_t                      _extendedCapacity;
+            size_t                      _extendedMask{0};
+
+            atomic<size_t>              _extendedCount{0};
+            atomic<uint64_t>            _droppedFrames{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANLATESTVALUECACHE_HPP
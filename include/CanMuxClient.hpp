@@ -0,0 +1,81 @@
+/**
+ * @file CanMuxClient.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for receiving CAN frames from a CanMuxServer.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANMUXCLIENT_HPP
+#define LIBSOCKCANPP_INCLUDE_CANMUXCLIENT_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanMuxProtocol.hpp"
+
+namespace sockcanpp {
+
+    using std::string;
+    using std::vector;
+    using std::chrono::milliseconds;
+
+    /**
+     * @brief CanMuxClient class; subscribes to a bus served by a @ref CanMuxServer.
+     *
+     * A lightweight alternative to a CanDriver for tools which only need a subset of a bus's traffic:
+     * no CAN socket is opened and filtering happens in the server.
+     */
+    class CanMuxClient {
+        public: // +++ Constructor / Destructor +++
+            CanMuxClient(const string& socketPath, const string& canInterface, const vector<can_filter>& filters = { can_filter{0, 0} }, const milliseconds timeout = milliseconds(1000)); //!< Constructor
+            virtual ~CanMuxClient();
+
+            CanMuxClient(const CanMuxClient&) = delete;
+            CanMuxClient& operator=(const CanMuxClient&) = delete;
+
+        public: // +++ I/O +++
+            bool                        waitForFrames(const milliseconds timeout = milliseconds(3000)); //!< Waits for frames to arrive
+            size_t                      readFrames(vector<CanMuxFrame>& frames); //!< Appends all queued frames without blocking
+            size_t                      sendFrames(const can_frame* frames, const size_t frameCount); //!< Sends frames on the subscribed bus
+
+        public: // +++ Getters +++
+            int32_t                     getSocketFd() const { return _socketFd; } //!< The socket, for use with poll()
+            const string&               getInterface() const { return _canInterface; } //!< The subscribed bus
+
+        private: // +++ Variables +++
+            int32_t                     _socketFd{-1};
+            string                      _canInterface;
+            vector<uint8_t>             _datagram{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANMUXCLIENT_HPP
@@ -0,0 +1,82 @@
+/**
+ * @file CanMuxProtocol.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the wire format shared by the CAN multiplexer server and its clients.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANMUXPROTOCOL_HPP
+#define LIBSOCKCANPP_INCLUDE_CANMUXPROTOCOL_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <net/if.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sockcanpp {
+
+    /**
+     * @brief The types of datagrams exchanged between a @ref CanMuxServer and its clients.
+     */
+    enum class CanMuxMessageType: uint16_t {
+        Subscribe   = 1,    //!< Client -> server: CanMuxSubscription followed by count can_filters
+        Acknowledge = 2,    //!< Server -> client: the subscription was accepted
+        Reject      = 3,    //!< Server -> client: a request failed; followed by count bytes of error text
+        Frames      = 4,    //!< Server -> client: count CanMuxFrames
+        Send        = 5,    //!< Client -> server: count can_frames to send on the subscribed bus
+    };
+
+    /**
+     * @brief Precedes every datagram.
+     */
+    struct CanMuxHeader {
+        uint16_t    type;       //!< A CanMuxMessageType
+        uint16_t    version;    //!< Always CAN_MUX_PROTOCOL_VERSION
+        uint32_t    count;      //!< The amount of elements following the header
+    };
+
+    /**
+     * @brief The body of a subscription request.
+     */
+    struct CanMuxSubscription {
+        char        interface[IFNAMSIZ]; //!< The name of the bus to subscribe to; NUL-padded
+    };
+
+    /**
+     * @brief A frame delivered by the server.
+     */
+    struct CanMuxFrame {
+        can_frame   frame;      //!< The received frame
+        int64_t     timestamp;  //!< When the server received the frame, in steady_clock (CLOCK_MONOTONIC) nanoseconds
+    };
+
+    constexpr uint16_t CAN_MUX_PROTOCOL_VERSION = 1; //!< The current protocol version
+    constexpr size_t   CAN_MUX_MAX_FRAMES = 256; //!< The maximum amount of frames per datagram
+    constexpr size_t   CAN_MUX_MAX_DATAGRAM = sizeof(CanMuxHeader) + CAN_MUX_MAX_FRAMES * sizeof(CanMuxFrame); //!< The largest datagram either side sends
+    constexpr size_t   CAN_MUX_MAX_FILTERS = (CAN_MUX_MAX_DATAGRAM - sizeof(CanMuxHeader) - sizeof(CanMuxSubscription)) / sizeof(can_filter); //!< The maximum amount of filters per subscription
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANMUXPROTOCOL_HPP
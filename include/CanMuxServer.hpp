@@ -0,0 +1,133 @@
+/**
+ * @file CanMuxServer.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for serving CAN frames to local clients over Unix domain sockets.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANMUXSERVER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANMUXSERVER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanMuxProtocol.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::mutex;
+    using std::string;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief CanMuxServer class; shares CAN buses with local clients over SOCK_SEQPACKET Unix domain sockets.
+     *
+     * Each client connection subscribes to a single bus with a set of socketcan-style filters. Received frames
+     * are filtered in the server and delivered in batches of up to CAN_MUX_MAX_FRAMES frames per datagram, so
+     * clients never open CAN sockets themselves and only wake up for frames they asked for.
+     *
+     * Clients which don't keep up lose frames instead of stalling the server.
+     *
+     * @remarks
+     * Buses must not be added while the server is running.
+     * The drivers are not owned by the server and must outlive it.
+     */
+    class CanMuxServer {
+        public: // +++ Constructor / Destructor +++
+            explicit CanMuxServer(const string& socketPath); //!< Constructor
+            virtual ~CanMuxServer();
+
+            CanMuxServer(const CanMuxServer&) = delete;
+            CanMuxServer& operator=(const CanMuxServer&) = delete;
+
+        public: // +++ Configuration +++
+            void                        addBus(const string& name, CanDriver& driver); //!< Makes a bus available to clients
+
+        public: // +++ Processing +++
+            size_t                      processOnce(milliseconds timeout = milliseconds(100)); //!< Services all pending connections, requests and frames
+            void                        run(); //!< Serves clients until stop() is called
+            void                        stop() { _running = false; } //!< Causes run() to return
+
+            void                        publish(const string& bus, const can_frame* frames, const size_t frameCount, const steady_clock::time_point received = steady_clock::now()); //!< Delivers frames from another source to a bus's subscribers
+
+        public: // +++ Getters +++
+            size_t                      getClientCount() const; //!< The amount of connected clients
+            uint64_t                    getDroppedCount() const { return _droppedFrames.load(std::memory_order_relaxed); } //!< Frames not delivered because a client's queue was full
+            const string&               getSocketPath() const { return _socketPath; } //!< The path clients connect to
+
+        private: // +++ Types +++
+            struct Bus {
+                string              name{};
+                CanDriver*          driver{nullptr};
+            };
+
+            struct Client {
+                int32_t             fd{-1};
+                int32_t             bus{-1};        //!< The subscribed bus, or -1 before subscribing
+                vector<can_filter>  filters{};      //!< Empty filters match no frames, as with CAN_RAW_FILTER
+                bool                closed{false};
+            };
+
+        private: // +++ Member Functions +++
+            void                        acceptClients();
+            void                        receiveRequest(Client& client);
+            void                        distribute(const int32_t bus, const can_frame* frames, const size_t frameCount, const int64_t timestamp);
+            void                        sendDatagram(Client& client, const void* datagram, const size_t length, const size_t frameCount);
+            void                        reject(Client& client, const string& reason);
+            void                        removeClosedClients();
+
+            static bool                 matches(const Client& client, const can_frame& frame);
+
+        private: // +++ Variables +++
+            mutable mutex               _lock{};
+
+            int32_t                     _listenFd{-1};
+            string                      _socketPath;
+
+            vector<Bus>                 _buses{};
+            vector<Client>              _clients{};
+            vector<pollfd>              _pollFds{};
+            vector<uint8_t>             _datagram{};
+
+            atomic<uint64_t>            _droppedFrames{0};
+            atomic<bool>                _running{false};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANMUXSERVER_HPP
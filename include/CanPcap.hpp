@@ -0,0 +1,148 @@
+/**
+ * @file CanPcap.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for writing and reading PCAP-NG captures of CAN traffic.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANPCAP_HPP
+#define LIBSOCKCANPP_INCLUDE_CANPCAP_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sockcanpp {
+
+    using std::string;
+    using std::vector;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief An interface described by an Interface Description Block.
+     */
+    struct CanPcapInterface {
+        string      name{};             //!< The interface name (if_name), if present
+        uint16_t    linkType{0};        //!< The link type; only CanPcapWriter::LINKTYPE_CAN_SOCKETCAN carries CAN frames
+        uint8_t     timestampResolution{6}; //!< The raw if_tsresol value; 6 (microseconds) if absent
+    };
+
+    /**
+     * @brief A frame read from a capture.
+     */
+    struct CanPcapFrame {
+        canfd_frame                 frame{};        //!< The frame; classic frames use the first 8 data bytes
+        bool                        isFd{false};    //!< Whether or not the frame is a CAN FD frame
+        uint32_t                    interface{0};   //!< The index of the frame's interface within its section
+        system_clock::time_point    timestamp{};    //!< The capture time
+    };
+
+    /**
+     * @brief CanPcapWriter class; streams CAN frames into a PCAP-NG file readable by Wireshark and tcpdump.
+     *
+     * Every interface gets its own Interface Description Block with nanosecond timestamp resolution. Frames are
+     * stored as Enhanced Packet Blocks using the LINKTYPE_CAN_SOCKETCAN encapsulation. Blocks are assembled in
+     * memory and written with a single system call whenever the buffer fills up, so writing a frame usually costs
+     * no more than a copy.
+     *
+     * The writer is not thread-safe.
+     */
+    class CanPcapWriter {
+        public: // +++ Static +++
+            static constexpr uint16_t   LINKTYPE_CAN_SOCKETCAN = 227; //!< The link type of SocketCAN frames
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanPcapWriter(const string& path, const size_t bufferSize = 1024 * 1024); //!< Constructor
+            virtual ~CanPcapWriter();
+
+            CanPcapWriter(const CanPcapWriter&) = delete;
+            CanPcapWriter& operator=(const CanPcapWriter&) = delete;
+
+        public: // +++ Writing +++
+            uint32_t                    addInterface(const string& name); //!< Describes a new interface and returns its index
+            void                        write(const uint32_t interface, const can_frame& frame, const system_clock::time_point timestamp = system_clock::now()); //!< Writes a classic frame
+            void                        write(const uint32_t interface, const canfd_frame& frame, const system_clock::time_point timestamp = system_clock::now()); //!< Writes an FD frame
+
+            void                        flush(); //!< Writes all buffered blocks to the file
+            void                        close(); //!< Flushes and closes the file
+
+        public: // +++ Getters +++
+            size_t                      getInterfaceCount() const { return _interfaceCount; } //!< The amount of interfaces described so far
+            uint64_t                    getFrameCount() const { return _frameCount; } //!< The amount of frames written
+
+        private: // +++ Member Functions +++
+            uint8_t*                    reserve(const size_t length); //!< Makes room for a block at the end of the buffer
+            void                        writePacket(const uint32_t interface, const canid_t id, const uint8_t length, const uint8_t flags, const uint8_t* data, const size_t dataSize, const system_clock::time_point timestamp);
+
+        private: // +++ Variables +++
+            int32_t                     _fileFd{-1};
+            vector<uint8_t>             _buffer{};
+            size_t                      _bufferUsed{0};
+            size_t                      _interfaceCount{0};
+            uint64_t                    _frameCount{0};
+    };
+
+    /**
+     * @brief CanPcapReader class; streams the CAN frames out of a PCAP-NG file.
+     *
+     * Files of either byte order and with several sections are supported. Packets of interfaces which don't use
+     * LINKTYPE_CAN_SOCKETCAN, and block types other than section headers, interface descriptions and enhanced
+     * packets, are skipped. A truncated final block, e.g. of a capture which is still being written, ends the file.
+     */
+    class CanPcapReader {
+        public: // +++ Constructor / Destructor +++
+            explicit CanPcapReader(const string& path, const size_t bufferSize = 1024 * 1024); //!< Constructor
+            virtual ~CanPcapReader();
+
+            CanPcapReader(const CanPcapReader&) = delete;
+            CanPcapReader& operator=(const CanPcapReader&) = delete;
+
+        public: // +++ Reading +++
+            bool                        next(CanPcapFrame& frame); //!< Reads the next CAN frame
+
+        public: // +++ Getters +++
+            const vector<CanPcapInterface>& getInterfaces() const { return _interfaces; } //!< The interfaces of the current section
+
+        private: // +++ Member Functions +++
+            const uint8_t*              nextBlock(uint32_t& type, uint32_t& length); //!< Gets the next block, or nullptr at the end of the file
+            bool                        fill(const size_t length); //!< Ensures length bytes are buffered
+            uint16_t                    read16(const uint8_t* data) const;
+            uint32_t                    read32(const uint8_t* data) const;
+            void                        parseInterface(const uint8_t* block, const uint32_t length);
+            bool                        parsePacket(const uint8_t* data, const uint32_t length, const uint32_t interface, const uint64_t timestamp, CanPcapFrame& frame) const;
+
+        private: // +++ Variables +++
+            int32_t                     _fileFd{-1};
+            vector<uint8_t>             _buffer{};
+            size_t                      _bufferStart{0};
+            size_t                      _bufferEnd{0};
+            bool                        _swapped{false}; //!< Whether or not the current section uses the other byte order
+            vector<CanPcapInterface>    _interfaces{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANPCAP_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file CanRecordAnalyser.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for analysing binary CAN recordings in parallel.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANRECORDANALYSER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANRECORDANALYSER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanRecordFormat.hpp"
+#include "CanRecordReader.hpp"
+
+namespace sockcanpp {
+
+    using std::map;
+    using std::vector;
+
+    /**
+     * @brief Controls what a @ref CanRecordAnalyser computes.
+     */
+    struct CanRecordAnalysisOptions {
+        uint32_t    bitrate{500000};        //!< The nominal bitrate used to compute the bus load
+        bool        byteHistograms{false};  //!< Whether or not to count the values of each payload byte per ID
+        size_t      threads{0};             //!< The amount of worker threads; 0 uses all cores
+        size_t      blocksPerTask{16};      //!< The amount of consecutive blocks processed by a worker at a time
+    };
+
+    /**
+     * @brief The statistics of a single ID.
+     *
+     * Intervals are measured between consecutive records of the ID in recording order.
+     */
+    struct CanIdAnalysis {
+        canid_t         id{0};                  //!< The ID; extended IDs carry CAN_EFF_FLAG
+        uint64_t        count{0};               //!< The amount of frames
+        int64_t         firstTimestamp{0};      //!< The timestamp of the first frame, in nanoseconds since the epoch
+        int64_t         lastTimestamp{0};       //!< The timestamp of the last frame, in nanoseconds since the epoch
+        int64_t         minInterval{INT64_MAX}; //!< The shortest time between two frames, in nanoseconds; INT64_MAX if count < 2
+        int64_t         maxInterval{0};         //!< The longest time between two frames, in nanoseconds
+        vector<uint64_t> byteHistogram{};       //!< Occurrences of value v at payload byte b, at [b * 256 + v]; empty unless enabled
+    };
+
+    /**
+     * @brief The traffic of one interface during one second.
+     */
+    struct CanBusLoadSample {
+        int32_t     ifindex{0};     //!< The interface
+        int64_t     second{0};      //!< Seconds since the epoch
+        uint64_t    frames{0};      //!< The amount of frames
+        uint64_t    bits{0};        //!< The amount of bits on the wire, including stuff bits and interframe spaces
+        double      load{0};        //!< bits / bitrate
+    };
+
+    /**
+     * @brief The result of analysing a recording.
+     */
+    struct CanRecordAnalysis {
+        uint64_t                    records{0};     //!< The amount of matching records
+        map<canid_t, CanIdAnalysis> ids{};          //!< The statistics of each ID, ordered by ID
+        vector<CanBusLoadSample>    busLoad{};      //!< The bus load, ordered by interface and second
+    };
+
+    /**
+     * @brief CanRecordAnalyser class; filters and aggregates a recording on all cores.
+     *
+     * The recording is split into runs of consecutive blocks, which worker threads take from a shared counter.
+     * Each run yields a partial result; partial results are merged in file order once all workers are done,
+     * so the result is identical regardless of the amount of threads or the order in which runs completed.
+     */
+    class CanRecordAnalyser {
+        public: // +++ Constructor / Destructor +++
+            explicit CanRecordAnalyser(const CanRecordReader& reader, const CanRecordAnalysisOptions& options = CanRecordAnalysisOptions()); //!< Constructor
+            virtual ~CanRecordAnalyser() = default;
+
+        public: // +++ Analysis +++
+            CanRecordAnalysis           analyse(const CanRecordQuery& query = CanRecordQuery()) const; //!< Analyses all records matching a query
+
+        public: // +++ Getters +++
+            const CanRecordAnalysisOptions& getOptions() const { return _options; } //!< The options used for analysis
+
+        public: // +++ Static +++
+            static uint64_t             estimateFrameBits(const CanRecord& record); //!< The bits a frame occupies on the wire, including stuff bits
+
+        private: // +++ Types +++
+            struct Partial;
+
+        private: // +++ Member Functions +++
+            void                        analyseRun(const size_t firstBlock, const size_t lastBlock, const CanRecordQuery& query, Partial& partial) const;
+            static void                 merge(Partial& into, Partial& from);
+
+        private: // +++ Variables +++
+            const CanRecordReader&      _reader;
+            CanRecordAnalysisOptions    _options;
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANRECORDANALYSER_HPP
@@ -0,0 +1,157 @@
+/**
+ * @file CanRecordFormat.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the on-disk layout of binary CAN recordings.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANRECORDFORMAT_HPP
+#define LIBSOCKCANPP_INCLUDE_CANRECORDFORMAT_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanId.hpp"
+
+namespace sockcanpp {
+
+    /**
+     * @brief Flags stored with each recorded frame.
+     */
+    enum CanRecordFlags: uint8_t {
+        CAN_RECORD_FD   = 0x01, //!< The frame is a CAN FD frame
+        CAN_RECORD_BRS  = 0x02, //!< CAN FD bit rate switch
+        CAN_RECORD_ESI  = 0x04, //!< CAN FD error state indicator
+        CAN_RECORD_TX   = 0x08, //!< The frame was sent by this host
+    };
+
+    /**
+     * @brief The header at the start of a recording.
+     *
+     * The header occupies the first CanRecordFileHeader::SIZE bytes of the file; fixed-size blocks follow,
+     * so block n starts at SIZE + n * blockSize. All values are stored in host byte order.
+     */
+    struct CanRecordFileHeader {
+        uint64_t    magic;          //!< Always CanRecordFileHeader::MAGIC
+        uint32_t    version;        //!< The format version
+        uint32_t    headerSize;     //!< The offset of the first block
+        uint32_t    blockSize;      //!< The size of every block, including its header
+        uint32_t    recordSize;     //!< sizeof(CanRecord)
+        int64_t     created;        //!< When the recording was started, in nanoseconds since the epoch
+
+        static constexpr uint64_t MAGIC = 0x474f4c4e41435053; //!< "SPCANLOG"
+        static constexpr uint32_t VERSION = 1; //!< The format version written and accepted
+        static constexpr size_t   SIZE = 4096; //!< Keeps blocks aligned to pages and logical sectors
+    };
+
+    /**
+     * @brief The header at the start of each block. Records follow immediately.
+     *
+     * Block headers double as a sparse index: readers use the time range to seek and the ID bitmap to skip
+     * blocks which can't contain a wanted ID. Unused trailing records of a block are zeroed; only the first
+     * recordCount records are valid.
+     */
+    struct CanRecordBlockHeader {
+        uint32_t    magic;          //!< Always CanRecordBlockHeader::MAGIC
+        uint32_t    recordCount;    //!< The amount of valid records in the block
+        uint64_t    sequence;       //!< The index of the block within the file
+        int64_t     minTimestamp;   //!< The earliest timestamp in the block, in nanoseconds since the epoch
+        int64_t     maxTimestamp;   //!< The latest timestamp in the block, in nanoseconds since the epoch
+        uint64_t    idBitmap[4];    //!< Bit canRecordIdBit(id) is set for every ID in the block
+
+        static constexpr uint32_t MAGIC = 0x4b4c4253; //!< "SBLK"
+    };
+
+    /**
+     * @brief A single recorded frame. Classic and FD frames share the same fixed-size record.
+     */
+    struct CanRecord {
+        int64_t     timestamp;              //!< The receive time, in nanoseconds since the epoch
+        uint32_t    canId;                  //!< The ID, including the EFF/RTR/ERR flags
+        int32_t     ifindex;                //!< The index of the interface the frame was seen on
+        uint8_t     length;                 //!< The amount of valid data bytes
+        uint8_t     flags;                  //!< A combination of CanRecordFlags
+        uint8_t     reserved[6];
+        uint8_t     data[CANFD_MAX_DLEN];   //!< The payload
+    };
+
+    /**
+     * @brief Gets the bit representing an ID in a block's ID bitmap.
+     */
+    inline uint32_t canRecordIdBit(const canid_t id) { return (normaliseCanId(id) * 0x9E3779B1u) >> 24; }
+
+    /**
+     * @brief Gets the CanRecordFlags describing an FD frame, in addition to the given flags.
+     */
+    inline uint8_t canRecordFdFlags(const canfd_frame& frame, const uint8_t flags) {
+        auto recordFlags = static_cast<uint8_t>(flags | CAN_RECORD_FD);
+
+        if (frame.flags & CANFD_BRS) { recordFlags |= CAN_RECORD_BRS; }
+        if (frame.flags & CANFD_ESI) { recordFlags |= CAN_RECORD_ESI; }
+
+        return recordFlags;
+    }
+
+    /**
+     * @brief Reads all frames pending on a driver in batches and passes each of them to a handler.
+     *
+     * All frames of a batch share the time the batch was read.
+     *
+     * @param driver The driver to read from.
+     * @param handler Called as handler(const can_frame&, std::chrono::system_clock::time_point) for each frame.
+     *
+     * @return size_t The amount of frames read.
+     */
+    template<typename FrameHandler>
+    size_t readCanRecordBatches(CanDriver& driver, FrameHandler&& handler) {
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE];
+        size_t framesReceived = 0;
+
+        while (true) {
+            const auto framesRead = driver.readFrames(frames, CanDriver::CAN_MAX_BATCH_SIZE);
+            if (!framesRead) { break; }
+
+            const auto timestamp = std::chrono::system_clock::now();
+            for (size_t i = 0; i < framesRead; i++) { handler(frames[i], timestamp); }
+            framesReceived += framesRead;
+
+            if (framesRead < CanDriver::CAN_MAX_BATCH_SIZE) { break; }
+        }
+
+        return framesReceived;
+    }
+
+    static_assert(sizeof(CanRecordFileHeader) <= CanRecordFileHeader::SIZE, "The file header must fit into its reserved area!");
+    static_assert(sizeof(CanRecordBlockHeader) == 64, "Block headers are expected to be 64 bytes!");
+    static_assert(sizeof(CanRecord) == 88, "Records are expected to be 88 bytes!");
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANRECORDFORMAT_HPP
@@ -0,0 +1,124 @@
+/**
+ * @file CanRecordReader.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for reading and querying binary CAN recordings.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANRECORDREADER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANRECORDREADER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanRecordFormat.hpp"
+
+namespace sockcanpp {
+
+    using std::function;
+    using std::string;
+    using std::vector;
+    using std::chrono::system_clock;
+
+    using recordhandler_t = function<void(const CanRecord& record)>; //!< Receives the records matched by a query
+
+    /**
+     * @brief Selects records from a recording. A default-constructed query matches everything.
+     */
+    struct CanRecordQuery {
+        CanRecordQuery() = default;
+        CanRecordQuery(const system_clock::time_point from, const system_clock::time_point to, const vector<canid_t>& ids = {}); //!< Constructor
+
+        int64_t         from{INT64_MIN};    //!< The earliest timestamp to match, in nanoseconds since the epoch
+        int64_t         to{INT64_MAX};      //!< The latest timestamp to match, in nanoseconds since the epoch
+        vector<canid_t> ids{};              //!< The IDs to match; IDs above 0x7FF are treated as extended. Empty matches all IDs.
+    };
+
+    /**
+     * @brief An entry of the in-memory block index.
+     */
+    struct CanRecordBlockInfo {
+        size_t      offset{0};          //!< The offset of the block within the file
+        uint32_t    recordCount{0};     //!< The amount of records in the block
+        int64_t     minTimestamp{0};    //!< The earliest timestamp in the block
+        int64_t     maxTimestamp{0};    //!< The latest timestamp in the block
+        uint64_t    idBitmap[4]{};      //!< The block's ID bitmap
+    };
+
+    /**
+     * @brief CanRecordReader class; memory-maps a recording written by a @ref CanRecorder and queries it.
+     *
+     * Opening a recording only reads the block headers, which form a sparse index. Queries then binary-search
+     * the index for the first block of the time window and skip blocks whose ID bitmap rules out all wanted IDs,
+     * so only the records which can match are ever touched.
+     *
+     * A recording which is still being written can be opened; only the blocks written so far are visible.
+     * Zeroed blocks (left behind by failed writes) are skipped. Queries are const and may run concurrently.
+     */
+    class CanRecordReader {
+        public: // +++ Constructor / Destructor +++
+            explicit CanRecordReader(const string& path); //!< Constructor
+            virtual ~CanRecordReader();
+
+            CanRecordReader(const CanRecordReader&) = delete;
+            CanRecordReader& operator=(const CanRecordReader&) = delete;
+
+        public: // +++ Queries +++
+            size_t                      query(const CanRecordQuery& query, const recordhandler_t& handler) const; //!< Passes all matching records to a handler
+            vector<CanRecord>           query(const CanRecordQuery& query) const; //!< Gets all matching records
+            size_t                      scanBlock(const size_t block, const CanRecordQuery& query, const recordhandler_t& handler) const; //!< Passes the matching records of a single block to a handler
+
+            size_t                      findFirstBlock(const int64_t from) const; //!< Gets the first block which may contain records at or after a timestamp
+            size_t                      findEndBlock(const int64_t to) const; //!< Gets the block from which on no block contains records at or before a timestamp
+            bool                        mayContain(const size_t block, const CanRecordQuery& query) const; //!< Whether or not a block may contain matching records
+
+        public: // +++ Getters +++
+            const CanRecordFileHeader&  getHeader() const { return *_header; } //!< The recording's file header
+            size_t                      getBlockCount() const { return _blocks.size(); } //!< The amount of valid blocks
+            const CanRecordBlockInfo&   getBlock(const size_t block) const { return _blocks.at(block); } //!< Gets the index entry of a block
+            const CanRecord*            getRecords(const size_t block) const; //!< Gets the records of a block
+            uint64_t                    getRecordCount() const { return _recordCount; } //!< The amount of records in the recording
+
+        private: // +++ Variables +++
+            int32_t                     _fileFd{-1};
+            size_t                      _mappingSize{0};
+            const uint8_t*              _mapping{nullptr};
+            const CanRecordFileHeader*  _header{nullptr};
+
+            vector<CanRecordBlockInfo>  _blocks{};
+            vector<int64_t>             _maxTimestampBefore{};  //!< The latest timestamp in all blocks up to and including each block
+            vector<int64_t>             _minTimestampAfter{};   //!< The earliest timestamp in all blocks from each block onwards
+            uint64_t                    _recordCount{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANRECORDREADER_HPP
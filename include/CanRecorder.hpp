@@ -0,0 +1,163 @@
+/**
+ * @file CanRecorder.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for recording CAN traffic into compact binary logs.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANRECORDER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANRECORDER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanMessage.hpp"
+#include "CanRecordFormat.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::condition_variable;
+    using std::mutex;
+    using std::string;
+    using std::thread;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief Statistics kept by a @ref CanRecorder.
+     */
+    struct CanRecorderStatistics {
+        uint64_t    recorded{0};        //!< Frames stored in a block
+        uint64_t    dropped{0};         //!< Frames discarded because the writer fell behind and no block was free
+        uint64_t    blocksWritten{0};   //!< Blocks written to disk
+        uint64_t    bytesWritten{0};    //!< Bytes written to disk, including the file header
+        uint64_t    syncs{0};           //!< Calls to fdatasync()
+        uint64_t    writeErrors{0};     //!< Failed writes; the affected blocks are lost
+    };
+
+    /**
+     * @brief CanRecorder class; appends timestamped frames to a binary log without blocking the receive path.
+     *
+     * Frames are copied into fixed-size records inside a block buffer. Full blocks are handed to a writer thread,
+     * which writes all pending blocks with a single, page-aligned pwritev() and calls fdatasync() at most once per
+     * sync interval. The receive path never waits for the disk: if every block buffer is waiting to be written,
+     * frames are dropped and counted instead.
+     *
+     * See CanRecordFormat.hpp for the file layout.
+     *
+     * @remarks
+     * Only a single thread may record frames. Blocks are only written once they are full or @ref flush() is called;
+     * @ref receiveFrom() flushes automatically while the bus is idle.
+     */
+    class CanRecorder {
+        public: // +++ Static +++
+            static constexpr size_t     DEFAULT_BLOCK_SIZE = 64 * 1024; //!< The default size of a block, in bytes
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanRecorder(const string& path, const size_t blockSize = DEFAULT_BLOCK_SIZE, const size_t bufferCount = 8, const milliseconds syncInterval = milliseconds(1000)); //!< Constructor
+            virtual ~CanRecorder();
+
+            CanRecorder(const CanRecorder&) = delete;
+            CanRecorder& operator=(const CanRecorder&) = delete;
+
+        public: // +++ Recording +++
+            bool                        record(const can_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records a classic frame
+            bool                        record(const canfd_frame& frame, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now(), const uint8_t flags = 0); //!< Records an FD frame
+            bool                        record(const CanMessage& message, const int32_t ifindex = 0, const system_clock::time_point timestamp = system_clock::now()); //!< Records a message
+            size_t                      receiveFrom(CanDriver& driver, const int32_t ifindex = 0, const milliseconds timeout = milliseconds(100)); //!< Waits for frames on a driver and records them
+
+            void                        flush(); //!< Hands the current, partially filled block to the writer
+            void                        close(); //!< Writes all pending blocks and closes the file
+
+        public: // +++ Getters +++
+            size_t                      getBlockSize() const { return _blockSize; } //!< The size of a block, in bytes
+            size_t                      getRecordsPerBlock() const { return _recordsPerBlock; } //!< The amount of records per block
+            CanRecorderStatistics       getStatistics() const; //!< Gets the recorder's statistics
+            bool                        isOpen() const { return _fileFd >= 0; } //!< Whether or not the recording is still open
+
+        private: // +++ Types +++
+            /**
+             * @brief A single-producer/single-consumer queue of buffer indices.
+             */
+            struct IndexQueue {
+                vector<uint32_t>        slots{};
+                atomic<uint64_t>        head{0};    //!< The next index to pop
+                atomic<uint64_t>        tail{0};    //!< The next slot to push to
+
+                void                    push(const uint32_t index);
+                bool                    pop(uint32_t& index);
+                bool                    empty() const { return head.load() == tail.load(); }
+            };
+
+        private: // +++ Member Functions +++
+            bool                        append(const uint32_t canId, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp);
+            void                        sealBlock(); //!< Hands the current block to the writer
+            void                        writerLoop();
+            void                        writeBlocks(const vector<uint32_t>& blocks); //!< Writes blocks with consecutive sequences
+
+        private: // +++ Variables +++
+            int32_t                     _fileFd{-1};
+            size_t                      _blockSize{0};
+            size_t                      _recordsPerBlock{0};
+            milliseconds                _syncInterval{0};
+
+            size_t                      _bufferCount{0};
+            uint8_t*                    _buffers{nullptr}; //!< bufferCount blocks, page-aligned
+            IndexQueue                  _freeBlocks{};
+            IndexQueue                  _fullBlocks{};
+
+            // Receive path only
+            uint32_t                    _currentBlock{0};
+            bool                        _hasBlock{false};
+            uint64_t                    _nextSequence{0};
+
+            mutable mutex               _lock{};
+            condition_variable          _blocksAvailable{};
+            thread                      _writer{};
+            bool                        _stopping{false};
+
+            atomic<uint64_t>            _recorded{0};
+            atomic<uint64_t>            _dropped{0};
+            atomic<uint64_t>            _blocksWritten{0};
+            atomic<uint64_t>            _bytesWritten{0};
+            atomic<uint64_t>            _syncs{0};
+            atomic<uint64_t>            _writeErrors{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANRECORDER_HPP
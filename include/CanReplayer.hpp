@@ -0,0 +1,127 @@
+/**
+ * @file CanReplayer.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for replaying recorded CAN traffic with its original timing.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANREPLAYER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANREPLAYER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanCandump.hpp"
+#include "CanClock.hpp"
+#include "CanDriver.hpp"
+#include "CanLatencyHistogram.hpp"
+#include "CanPcap.hpp"
+#include "CanRecordReader.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::shared_ptr;
+    using std::string;
+    using std::unordered_map;
+
+    /**
+     * @brief Statistics kept by a @ref CanReplayer.
+     */
+    struct CanReplayStatistics {
+        uint64_t    sent{0};        //!< Frames sent
+        uint64_t    unmapped{0};    //!< Frames skipped because their interface isn't mapped to a driver
+        uint64_t    unsupported{0}; //!< FD frames skipped; CanDriver only sends classic frames
+        uint64_t    failed{0};      //!< Frames the driver didn't accept, even after retrying
+    };
+
+    /**
+     * @brief CanReplayer class; sends recorded frames with the timing they were recorded with.
+     *
+     * Each frame is scheduled on an absolute deadline derived from its offset to the first frame, divided by the
+     * speed factor, and sent once the replayer's clock reaches it (with the default clock, via
+     * clock_nanosleep(TIMER_ABSTIME)). As deadlines don't depend on when the previous frame was sent, scheduling
+     * errors never accumulate. With a CanManualClock, hours of traffic are replayed without waiting. The difference between each deadline
+     * and the actual send time is kept in a histogram.
+     *
+     * Frames are routed to drivers by interface index (binary recordings) or interface name (candump logs and
+     * PCAP-NG captures). Replays run on the calling thread; @ref stop() may be called from any thread.
+     */
+    class CanReplayer {
+        public: // +++ Static +++
+            static constexpr double     AS_FAST_AS_POSSIBLE = 0; //!< Speed factor which sends frames without waiting
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanReplayer(const double speed = 1.0, const shared_ptr<CanClock>& clock = CanSteadyClock::getDefault()); //!< Constructor
+            virtual ~CanReplayer() = default;
+
+            CanReplayer(const CanReplayer&) = delete;
+            CanReplayer& operator=(const CanReplayer&) = delete;
+
+        public: // +++ Configuration +++
+            void                        mapInterface(const int32_t ifindex, CanDriver& driver); //!< Sends frames recorded on an interface index through a driver
+            void                        mapInterface(const string& name, CanDriver& driver); //!< Sends frames recorded on a named interface through a driver
+            void                        setSpeed(const double speed); //!< Sets the speed factor; 2.0 replays twice as fast
+
+        public: // +++ Replay +++
+            size_t                      replay(const CanRecordReader& reader, const CanRecordQuery& query = CanRecordQuery()); //!< Replays a binary recording
+            size_t                      replay(CanCandumpReader& reader); //!< Replays a candump log
+            size_t                      replay(CanPcapReader& reader); //!< Replays a PCAP-NG capture
+            void                        stop() { _stopping = true; } //!< Aborts the current replay
+
+        public: // +++ Getters +++
+            double                      getSpeed() const { return _speed; } //!< The speed factor
+            CanReplayStatistics         getStatistics() const { return _statistics; } //!< Gets the statistics of all replays
+            CanLatencyHistogram::Snapshot getTimingErrorHistogram() const { return _timingError.snapshot(); } //!< How late frames were sent relative to their deadline
+
+        private: // +++ Member Functions +++
+            void                        begin(); //!< Prepares a new replay
+            bool                        send(CanDriver* driver, const canid_t id, const uint8_t* data, const uint8_t length, const bool isFd, const int64_t timestamp);
+            bool                        waitUntil(const int64_t deadline); //!< Sleeps until a time on the replayer's clock, in nanoseconds
+
+        private: // +++ Variables +++
+            double                                  _speed{1.0};
+            shared_ptr<CanClock>                    _clock;
+            unordered_map<int32_t, CanDriver*>      _driversByIndex{};
+            unordered_map<string, CanDriver*>       _driversByName{};
+
+            atomic<bool>                            _stopping{false};
+            bool                                    _started{false};
+            int64_t                                 _firstTimestamp{0};    //!< The timestamp of the replay's first frame
+            int64_t                                 _replayStart{0};       //!< When the first frame was due, on the replayer's clock
+
+            CanReplayStatistics                     _statistics{};
+            CanLatencyHistogram                     _timingError{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANREPLAYER_HPP
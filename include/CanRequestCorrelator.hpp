@@ -0,0 +1,135 @@
+/**
+ * @file CanRequestCorrelator.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for matching CAN responses to outstanding requests.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANREQUESTCORRELATOR_HPP
+#define LIBSOCKCANPP_INCLUDE_CANREQUESTCORRELATOR_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanDriver.hpp"
+#include "CanId.hpp"
+#include "CanMessage.hpp"
+#include "CanTimerWheel.hpp"
+
+namespace sockcanpp {
+
+    using std::function;
+    using std::future;
+    using std::list;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::unordered_map;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    using requestid_t = uint64_t; //!< Identifies an outstanding request
+    using responsehandler_t = function<void(const CanMessage* response)>; //!< Invoked with the response, or nullptr if the request timed out
+
+    /**
+     * @brief CanRequestCorrelator class; completes outstanding requests when their response arrives.
+     *
+     * Each request registers the ID (and mask) of the response it expects. Received messages are fed
+     * to @ref onMessage(), which completes the oldest matching request but never consumes the message;
+     * the caller remains free to hand it to other consumers.
+     *
+     * Timeouts are managed by a single hierarchical timer wheel, so registering, completing and expiring
+     * a request costs O(1) regardless of how many requests are outstanding.
+     *
+     * Handlers are invoked outside of the correlator's lock and may register new requests.
+     * Deadlines are measured by the correlator's clock, so a CanManualClock makes timeouts deterministic.
+     */
+    class CanRequestCorrelator {
+        public: // +++ Static +++
+            static constexpr canid_t EXACT_MATCH = CAN_EFF_FLAG | CAN_EFF_MASK; //!< Mask matching a single (standard or extended) ID
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanRequestCorrelator(const nanoseconds resolution = milliseconds(1), const shared_ptr<CanClock>& clock = CanSteadyClock::getDefault()); //!< Constructor
+            virtual ~CanRequestCorrelator() = default;
+
+            CanRequestCorrelator(const CanRequestCorrelator&) = delete;
+            CanRequestCorrelator& operator=(const CanRequestCorrelator&) = delete;
+
+        public: // +++ Requests +++
+            requestid_t                 expectResponse(const CanId responseId, const canid_t mask, const milliseconds timeout, const responsehandler_t& handler); //!< Registers an expected response
+            future<CanMessage>          expectResponse(const CanId responseId, const canid_t mask, const milliseconds timeout); //!< Registers an expected response
+
+            future<CanMessage>          sendRequest(CanDriver& driver, const CanMessage& request, const CanId responseId, const milliseconds timeout, const canid_t mask = EXACT_MATCH); //!< Registers the response, then sends the request
+
+            bool                        cancel(const requestid_t request); //!< Cancels an outstanding request without invoking its handler
+
+        public: // +++ Receive Path +++
+            bool                        onMessage(const CanMessage& message); //!< Completes the oldest request matching a received message
+            size_t                      expire(); //!< Times out all requests overdue by the correlator's clock
+            size_t                      expire(const steady_clock::time_point now); //!< Times out all overdue requests
+
+        public: // +++ Getters +++
+            size_t                      getPendingCount() const; //!< The amount of outstanding requests
+
+        private: // +++ Types +++
+            struct Pending {
+                canid_t                 id{0};
+                canid_t                 mask{0};
+                bool                    exact{false};
+                timerid_t               timer{CanTimerWheel::INVALID_TIMER};
+                responsehandler_t       handler{};
+                list<requestid_t>::iterator position{};
+            };
+
+        private: // +++ Member Functions +++
+            static bool                 isExactMask(const canid_t id, const canid_t mask);
+            bool                        remove(const requestid_t request, responsehandler_t* handler = nullptr); //!< Removes a request, optionally returning its handler
+
+        private: // +++ Variables +++
+            mutable mutex                                   _lock{};
+
+            shared_ptr<CanClock>                            _clock;
+            CanTimerWheel                                   _timeouts;
+            requestid_t                                     _nextRequest{1};
+
+            unordered_map<requestid_t, Pending>             _pending{};
+            unordered_map<canid_t, list<requestid_t>>       _exactRequests{};   //!< Requests for a single ID, oldest first
+            list<requestid_t>                               _maskedRequests{};  //!< Requests for ID ranges, oldest first
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANREQUESTCORRELATOR_HPP
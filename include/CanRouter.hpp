@@ -0,0 +1,182 @@
+/**
+ * @file CanRouter.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a high-throughput userspace CAN gateway.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANROUTER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANROUTER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanId.hpp"
+#include "CanLatencyHistogram.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::function;
+    using std::unique_ptr;
+    using std::unordered_map;
+    using std::vector;
+    using std::chrono::milliseconds;
+
+    using frametransform_t = function<bool(can_frame&)>; //!< Transforms a frame in-place; returns false to drop it
+
+    /**
+     * @brief The actions a route can perform on a matching frame.
+     */
+    enum class CanRouteAction: uint8_t {
+        Drop,       //!< Discard the frame
+        Forward,    //!< Send the frame unmodified on the target bus
+        RewriteId,  //!< Replace the frame's ID and send it on the target bus
+        Transform,  //!< Pass the frame through a transform function and send it on the target bus
+    };
+
+    /**
+     * @brief Describes a single route in a @ref CanRouter.
+     *
+     * A frame received on @ref sourceBus matches the route if (frame.can_id & mask) == (id & mask),
+     * just like a socketcan filter. The first matching route (in the order they were added) wins.
+     */
+    struct CanRoute {
+        size_t              sourceBus{0};                       //!< The bus index the route applies to
+        canid_t             id{0};                              //!< The ID to match (including CAN_EFF_FLAG for extended IDs)
+        canid_t             mask{CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_SFF_MASK}; //!< The mask to match with
+        CanRouteAction      action{CanRouteAction::Forward};    //!< What to do with matching frames
+        size_t              targetBus{0};                       //!< The bus index matching frames are sent on
+        CanId               newId{0};                           //!< The new ID for CanRouteAction::RewriteId
+        frametransform_t    transform{};                        //!< The transform for CanRouteAction::Transform
+
+        CanRoute() = default;
+        CanRoute(const size_t source, const canid_t id, const canid_t mask, const CanRouteAction action, const size_t target = 0):
+            sourceBus(source), id(id), mask(mask), action(action), targetBus(target) { }
+
+        CanRoute& setNewId(const CanId id) { newId = id; action = CanRouteAction::RewriteId; return *this; } //!< Rewrites the ID of matching frames
+        CanRoute& setTransform(const frametransform_t& func) { transform = func; action = CanRouteAction::Transform; return *this; } //!< Transforms matching frames
+    };
+
+    /**
+     * @brief A snapshot of the counters of a single route.
+     */
+    struct CanRouteStatistics {
+        uint64_t matched{0};    //!< Frames which matched the route
+        uint64_t forwarded{0};  //!< Frames sent on the target bus
+        uint64_t dropped{0};    //!< Frames discarded by the route (Drop or transform returned false)
+        uint64_t txFailed{0};   //!< Frames which could not be sent because the target's queue was full
+    };
+
+    /**
+     * @brief CanRouter class; routes frames between buses in userspace using a precompiled routing table.
+     *
+     * All buses are serviced by the thread calling @ref processOnce() or @ref run().
+     * Frames are received and transmitted in batches; standard-ID lookups are a single table access,
+     * extended-ID lookups a single hash lookup for exact routes.
+     *
+     * @remarks
+     * Buses and routes must not be modified while the router is running.
+     * The drivers are not owned by the router and must outlive it.
+     */
+    class CanRouter {
+        public: // +++ Static +++
+            static constexpr uint16_t NO_ROUTE = UINT16_MAX; //!< Marks IDs without a route
+
+        public: // +++ Constructor / Destructor +++
+            CanRouter() = default;
+            virtual ~CanRouter() = default;
+
+            CanRouter(const CanRouter&) = delete;
+            CanRouter& operator=(const CanRouter&) = delete;
+
+        public: // +++ Configuration +++
+            size_t                      addBus(CanDriver& driver); //!< Adds a bus to the router; returns its index
+            size_t                      addRoute(const CanRoute& route); //!< Adds a route; returns its index
+
+            void                        compile(); //!< Builds the lookup tables
+
+        public: // +++ Processing +++
+            size_t                      processOnce(milliseconds timeout = milliseconds(100)); //!< Waits for and routes all pending frames
+            void                        run(); //!< Routes frames until stop() is called
+            void                        stop() { _running = false; } //!< Causes run() to return
+
+        public: // +++ Statistics +++
+            CanRouteStatistics          getRouteStatistics(const size_t route) const; //!< Gets the counters of a route
+            uint64_t                    getUnroutedFrameCount() const { return _unroutedFrames.load(std::memory_order_relaxed); } //!< Frames without a matching route
+            CanLatencyHistogram::Snapshot getProcessingTimeHistogram() const { return _processingTime.snapshot(); } //!< Time from reading a batch to having sent it; excludes time spent in the kernel's queues
+            void                        resetStatistics(); //!< Clears all counters
+
+        private: // +++ Types +++
+            struct RouteCounters {
+                atomic<uint64_t> matched{0};
+                atomic<uint64_t> forwarded{0};
+                atomic<uint64_t> dropped{0};
+                atomic<uint64_t> txFailed{0};
+            };
+
+            struct Bus {
+                CanDriver*                          driver{nullptr};
+                vector<uint16_t>                    standardIds{};  //!< Route per standard ID (data frames only)
+                unordered_map<canid_t, uint16_t>    extendedIds{};  //!< Routes matching exactly one extended ID
+                vector<uint16_t>                    maskedRoutes{}; //!< Remaining routes which may match extended IDs
+                vector<uint16_t>                    allRoutes{};    //!< All routes of this bus, for RTR/error frames
+
+                vector<can_frame>                   txFrames{};     //!< Frames waiting to be sent on this bus
+                vector<uint16_t>                    txRoutes{};     //!< The route of each waiting frame
+            };
+
+        private: // +++ Member Functions +++
+            uint16_t                    lookup(const Bus& bus, const canid_t id) const; //!< Finds the route for a frame
+            void                        flush(Bus& bus, const std::chrono::steady_clock::time_point batchRead); //!< Sends all waiting frames
+            static bool                 matches(const CanRoute& route, const canid_t id) { return (id & route.mask) == (route.id & route.mask); }
+            static void                 increment(atomic<uint64_t>& counter, const uint64_t value = 1) { counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed); }
+
+        private: // +++ Variables +++
+            vector<Bus>                     _buses{};
+            vector<CanRoute>                _routes{};
+            vector<unique_ptr<RouteCounters>> _counters{};
+            vector<pollfd>                  _pollFds{};
+
+            atomic<uint64_t>                _unroutedFrames{0};
+            CanLatencyHistogram             _processingTime{};
+
+            atomic<bool>                    _running{false};
+            bool                            _compiled{false};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANROUTER_HPP
@@ -0,0 +1,127 @@
+/**
+ * @file CanScheduleAnalyser.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for the worst-case response-time analysis of periodic CAN messages.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANSCHEDULEANALYSER_HPP
+#define LIBSOCKCANPP_INCLUDE_CANSCHEDULEANALYSER_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanId.hpp"
+
+namespace sockcanpp {
+
+    using std::vector;
+    using std::chrono::nanoseconds;
+
+    /**
+     * @brief A periodic (or sporadic) message sent on the bus.
+     */
+    struct CanScheduledMessage {
+        CanId       id{0};              //!< The message's ID; IDs above 0x7FF are sent as extended IDs
+        nanoseconds period{0};          //!< The period, or the minimum interval between two instances of a sporadic message
+        uint8_t     length{8};          //!< The amount of payload bytes
+        nanoseconds jitter{0};          //!< The largest delay between the message's periodic release and it being queued for transmission
+        nanoseconds deadline{0};        //!< The latest acceptable response time; zero uses the period
+    };
+
+    /**
+     * @brief The worst-case timing of a single message.
+     */
+    struct CanMessageResponse {
+        CanId       id{0};                          //!< The message's ID
+        nanoseconds transmissionTime{0};            //!< C: the longest transmission, including worst-case stuffing and the interframe space
+        nanoseconds blocking{0};                    //!< B: the longest a lower priority frame already on the bus can delay the message
+        nanoseconds queuingDelay{0};                //!< w: the longest time between being queued and winning arbitration
+        nanoseconds responseTime{0};                //!< R: the longest time between release and the end of transmission (jitter + w + C)
+        nanoseconds deadline{0};                    //!< The deadline the response time was checked against
+        bool        schedulable{false};             //!< Whether or not responseTime is within the deadline
+        nanoseconds observedResponseTime{0};        //!< The longest response time seen when simulated; see CanScheduleAnalyser::validate()
+        uint64_t    observedFrames{0};              //!< The amount of instances transmitted when simulated
+    };
+
+    /**
+     * @brief The result of analysing a set of messages.
+     */
+    struct CanScheduleAnalysis {
+        double                      utilisation{0};     //!< The fraction of the bus used by the messages' worst-case transmissions
+        bool                        schedulable{false}; //!< Whether or not every message meets its deadline
+        vector<CanMessageResponse>  messages{};         //!< The timing of each message, highest priority first
+    };
+
+    /**
+     * @brief CanScheduleAnalyser class; computes worst-case queuing and response times of periodic messages.
+     *
+     * Implements the response-time analysis for CAN as revised by Davis, Burns, Bril and Lukkien (2007): each
+     * message may be blocked by the longest lower priority frame, suffers interference from all higher priority
+     * messages (including their jitter) and, where the priority level's busy period extends beyond its period,
+     * every instance within the busy period is checked. Transmission times assume worst-case bit stuffing
+     * (see CanFrameTiming::worstCaseFrameBits()); the bus is assumed to be error-free and all transmit buffers
+     * to be priority-ordered.
+     *
+     * @ref validate() replays the set on a CanSimulatedBus, starting at the critical instant with random jitter,
+     * and records the response times actually observed, which never exceed the analysed worst case.
+     */
+    class CanScheduleAnalyser {
+        public: // +++ Constructor / Destructor +++
+            explicit CanScheduleAnalyser(const uint32_t bitrate = 500000); //!< Constructor
+            virtual ~CanScheduleAnalyser() = default;
+
+        public: // +++ Analysis +++
+            CanScheduleAnalysis         analyse(const vector<CanScheduledMessage>& messages) const; //!< Computes the worst-case response time of each message
+            CanScheduleAnalysis         validate(const vector<CanScheduledMessage>& messages, const nanoseconds duration, const uint32_t seed = 1) const; //!< Analyses the messages and simulates them for the given duration
+
+        public: // +++ Getters +++
+            uint32_t                    getBitrate() const { return _bitrate; } //!< The bitrate used for the analysis
+            nanoseconds                 transmissionTime(const CanId id, const uint8_t length) const; //!< The worst-case transmission time of a frame, including the interframe space
+
+        private: // +++ Types +++
+            struct Entry {
+                canid_t                 id{0};          //!< Normalised; extended IDs carry CAN_EFF_FLAG
+                size_t                  index{0};       //!< The index in the input
+                int64_t                 period{0};
+                int64_t                 jitter{0};
+                int64_t                 deadline{0};
+                int64_t                 transmission{0};
+            };
+
+        private: // +++ Member Functions +++
+            vector<Entry>               prioritise(const vector<CanScheduledMessage>& messages) const;
+
+        private: // +++ Variables +++
+            uint32_t                    _bitrate{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANSCHEDULEANALYSER_HPP
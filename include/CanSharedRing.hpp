@@ -0,0 +1,173 @@
+/**
+ * @file CanSharedRing.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for distributing received frames to other processes via shared memory.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANSHAREDRING_HPP
+#define LIBSOCKCANPP_INCLUDE_CANSHAREDRING_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::string;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief A frame read from a shared ring.
+     */
+    struct CanSharedFrame {
+        can_frame                   frame{};        //!< The frame, as received
+        steady_clock::time_point    received{};     //!< When the publisher received the frame (CLOCK_MONOTONIC, comparable across processes)
+        uint64_t                    position{0};    //!< The frame's position in the ring's stream
+    };
+
+    /**
+     * @brief The layout of the shared memory region. Consumers validate the header before attaching.
+     */
+    struct CanSharedRingHeader {
+        uint64_t            magic;              //!< Always CanSharedRingHeader::MAGIC
+        uint32_t            version;            //!< The layout version
+        uint32_t            recordSize;         //!< sizeof(CanSharedRingRecord)
+        uint64_t            capacity;           //!< The amount of records; always a power of two
+        uint64_t            dataOffset;         //!< The offset of the first record from the start of the region
+
+        alignas(64) atomic<uint64_t> head;      //!< The position of the next frame to be written
+        alignas(64) atomic<uint32_t> notify;    //!< Futex word, incremented when waiting consumers must be woken
+        atomic<uint32_t>    waiters;            //!< The amount of consumers blocked in waitForFrames()
+
+        static constexpr uint64_t MAGIC = 0x474e495250534353; //!< "SCSPRING"
+        static constexpr uint32_t VERSION = 1;
+    };
+
+    /**
+     * @brief A single slot of the ring.
+     *
+     * The sequence is 2p + 1 while the frame at position p is written and 2p + 2 once it is complete,
+     * which lets consumers detect both missing and overwritten frames.
+     */
+    struct CanSharedRingRecord {
+        atomic<uint64_t>    sequence;
+        atomic<uint64_t>    words[2];   //!< The frame, as raw words
+        atomic<int64_t>     received;   //!< The receive time, in steady_clock ticks
+    };
+
+    /**
+     * @brief CanSharedRingPublisher class; receives frames once and shares them with any number of processes.
+     *
+     * Frames are written to a single-producer/multi-consumer ring in a sealed memfd. Consumers attach to the
+     * memfd (inherited across fork(), passed via SCM_RIGHTS or opened through /proc/<pid>/fd/<fd>) and read at
+     * their own pace. The publisher never waits for consumers: a consumer which falls more than a ring's length
+     * behind loses the oldest frames and is told how many it lost.
+     *
+     * Only a single thread may publish.
+     */
+    class CanSharedRingPublisher {
+        public: // +++ Constructor / Destructor +++
+            explicit CanSharedRingPublisher(const size_t capacity = 4096, const string& name = "sockcanpp-ring"); //!< Constructor
+            virtual ~CanSharedRingPublisher();
+
+            CanSharedRingPublisher(const CanSharedRingPublisher&) = delete;
+            CanSharedRingPublisher& operator=(const CanSharedRingPublisher&) = delete;
+
+        public: // +++ Publishing +++
+            void                        publish(const can_frame& frame, const steady_clock::time_point received = steady_clock::now()); //!< Publishes a single frame
+            void                        publish(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received = steady_clock::now()); //!< Publishes a batch of frames
+            size_t                      receiveFrom(CanDriver& driver, const milliseconds timeout = milliseconds(100)); //!< Waits for frames on a driver and publishes them
+
+        public: // +++ Getters +++
+            int32_t                     getFileDescriptor() const { return _memoryFd; } //!< The memfd consumers attach to
+            size_t                      getCapacity() const { return static_cast<size_t>(_header->capacity); } //!< The amount of frames held by the ring
+            uint64_t                    getPublishedCount() const { return _head; } //!< The amount of frames published
+
+        private: // +++ Member Functions +++
+            void                        write(const can_frame& frame, const int64_t received);
+            void                        commit();
+
+        private: // +++ Variables +++
+            int32_t                     _memoryFd{-1};
+            size_t                      _mappingSize{0};
+
+            CanSharedRingHeader*        _header{nullptr};
+            CanSharedRingRecord*        _records{nullptr};
+            uint64_t                    _mask{0};
+            uint64_t                    _head{0};
+    };
+
+    /**
+     * @brief CanSharedRingConsumer class; reads frames from a ring created by a @ref CanSharedRingPublisher.
+     *
+     * A consumer starts at the publisher's current position and only ever reads shared memory, with the exception
+     * of a waiter count used to avoid wake-up system calls while nobody is waiting. Each consumer may only be used
+     * by a single thread.
+     */
+    class CanSharedRingConsumer {
+        public: // +++ Constructor / Destructor +++
+            explicit CanSharedRingConsumer(const int32_t memoryFd); //!< Constructor
+            virtual ~CanSharedRingConsumer();
+
+            CanSharedRingConsumer(const CanSharedRingConsumer&) = delete;
+            CanSharedRingConsumer& operator=(const CanSharedRingConsumer&) = delete;
+
+        public: // +++ Reading +++
+            size_t                      read(CanSharedFrame* frames, const size_t maxFrames); //!< Reads the frames published since the last call
+            bool                        waitForFrames(const milliseconds timeout = milliseconds(3000)); //!< Waits until frames are available
+            void                        skipToLatest(); //!< Discards all unread frames
+
+        public: // +++ Getters +++
+            size_t                      getAvailableCount() const; //!< The amount of unread frames; may exceed the capacity after an overrun
+            uint64_t                    getLostCount() const { return _lostFrames; } //!< The amount of frames overwritten before they could be read
+            uint64_t                    getPosition() const { return _position; } //!< The position of the next frame to read
+
+        private: // +++ Member Functions +++
+            void                        resynchronise();
+
+        private: // +++ Variables +++
+            size_t                      _headerSize{0};
+            size_t                      _recordsSize{0};
+
+            CanSharedRingHeader*        _header{nullptr};
+            const CanSharedRingRecord*  _records{nullptr};
+            uint64_t                    _mask{0};
+            uint64_t                    _position{0};
+            uint64_t                    _lostFrames{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANSHAREDRING_HPP
@@ -0,0 +1,197 @@
+/**
+ * @file CanSimulatedBus.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a bit-timed CAN bus simulator running on simulated time.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANSIMULATEDBUS_HPP
+#define LIBSOCKCANPP_INCLUDE_CANSIMULATEDBUS_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanTransport.hpp"
+
+namespace sockcanpp {
+
+    using std::deque;
+    using std::function;
+    using std::priority_queue;
+    using std::shared_ptr;
+    using std::string;
+    using std::unordered_map;
+    using std::vector;
+    using std::chrono::nanoseconds;
+
+    /**
+     * @brief A frame transmitted on a @ref CanSimulatedBus.
+     */
+    struct CanSimulatedTransmission {
+        can_frame   frame{};            //!< The frame
+        int32_t     senderFd{-1};       //!< The socket which sent the frame
+        nanoseconds queued{0};          //!< When the frame was handed to the bus
+        nanoseconds started{0};         //!< When its start-of-frame bit was sent, i.e. it won arbitration
+        nanoseconds finished{0};        //!< When its last end-of-frame bit was sent and it was delivered
+        uint32_t    bits{0};            //!< The frame's length on the wire, including stuff bits; excluding the interframe space
+    };
+
+    /**
+     * @brief Statistics kept by a @ref CanSimulatedBus.
+     */
+    struct CanSimulatedBusStatistics {
+        uint64_t    frames{0};          //!< Frames transmitted
+        uint64_t    delivered{0};       //!< Frames delivered to receiving sockets
+        uint64_t    dropped{0};         //!< Deliveries dropped because a socket's receive queue was full
+        uint64_t    unsupported{0};     //!< FD frames, which the simulator doesn't transmit
+        nanoseconds busy{0};            //!< The time the bus spent transmitting frames and interframe spaces
+    };
+
+    using simulationaction_t = function<void()>; //!< Runs at a point in simulated time
+    using transmissionhandler_t = function<void(const CanSimulatedTransmission& transmission)>; //!< Invoked after each transmitted frame
+
+    /**
+     * @brief CanSimulatedBus class; a deterministic CAN bus with many nodes, running faster than real time.
+     *
+     * Like @ref CanVirtualBus, the simulator is a CanTransport: each node is a regular CanDriver whose socket is
+     * one end of a socketpair. Frames sent by a node are queued in that node's transmit FIFO when the simulation
+     * next runs. Whenever the bus is idle, the head frames of all nodes arbitrate bit by bit and the lowest
+     * arbitration field wins. The winner occupies the bus for its exact length on the wire (including stuff bits) at
+     * the configured bitrate, followed by the 3-bit interframe space, and is then delivered to all other nodes whose
+     * filters accept it.
+     *
+     * Time only advances in @ref runFor() / @ref runUntil(). Node behaviour is scripted with actions scheduled at
+     * simulated times (e.g. each ECU sending its cyclic frames) and with the transmission handler, which may read
+     * from and send with any node. Given the same script, every run produces the same sequence of transmissions.
+     *
+     * The simulated time is also available as a CanManualClock (see @ref getClock()), which can be given to the nodes'
+     * drivers, request correlators and cycle supervisors so their timeouts follow the simulation.
+     *
+     * @remarks
+     * The simulator is not thread-safe; create nodes, schedule actions and run it from a single thread.
+     * Only classic frames are transmitted, and error frames, bus errors and TX confirmation are not simulated.
+     */
+    class CanSimulatedBus: public CanTransport {
+        public: // +++ Static +++
+            static constexpr uint32_t INTERFRAME_BITS = 3; //!< The length of the interframe space; see CanFrameTiming
+
+            static uint32_t             frameBits(const can_frame& frame); //!< The exact length of a classic frame on the wire, including stuff bits; see CanFrameTiming
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanSimulatedBus(const uint32_t bitrate = 500000); //!< Constructor
+            virtual ~CanSimulatedBus();
+
+            CanSimulatedBus(const CanSimulatedBus&) = delete;
+            CanSimulatedBus& operator=(const CanSimulatedBus&) = delete;
+
+        public: // +++ Sockets +++
+            int32_t                     openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) override;
+            void                        closeSocket(const int32_t socketFd) override;
+
+        public: // +++ Socket Options +++
+            void                        setFilters(const int32_t socketFd, const vector<can_filter>& filters) override;
+            void                        setReceiveOwnMessages(const int32_t socketFd, const bool enabled) override;
+
+        public: // +++ Simulation +++
+            void                        schedule(const nanoseconds at, const simulationaction_t& action); //!< Runs an action at a point in simulated time
+            void                        every(const nanoseconds period, const simulationaction_t& action, const nanoseconds offset = nanoseconds(0)); //!< Runs an action periodically
+            void                        setTransmissionHandler(const transmissionhandler_t& handler) { _transmissionHandler = handler; } //!< Sets the handler invoked after each transmitted frame
+
+            size_t                      runUntil(const nanoseconds end); //!< Runs the simulation up to the given simulated time
+            size_t                      runFor(const nanoseconds duration) { return runUntil(_now + duration); } //!< Runs the simulation for the given simulated duration
+
+        public: // +++ Getters +++
+            nanoseconds                 now() const { return _now; } //!< The current simulated time, since the start of the simulation
+            shared_ptr<CanManualClock>  getClock() const { return _clock; } //!< A clock following the simulated time, starting at the steady_clock epoch
+            uint32_t                    getBitrate() const { return _bitrate; } //!< The bus's bitrate, in bits per second
+            size_t                      getPendingCount() const { return _pendingFrames; } //!< The amount of frames waiting for the bus
+            double                      getBusLoad() const; //!< The fraction of simulated time the bus was busy
+            CanSimulatedBusStatistics   getStatistics() const { return _statistics; } //!< Gets the simulator's statistics
+
+        private: // +++ Types +++
+            struct Queued {
+                can_frame               frame{};
+                nanoseconds             queued{0};
+            };
+
+            struct Node {
+                int32_t                 busFd{-1};      //!< The simulator's end of the socketpair; -1 once closed
+                int32_t                 socketFd{-1};   //!< The driver's end; -1 once closed
+                vector<can_filter>      filters{};
+                deque<Queued>           transmitQueue{};
+            };
+
+            struct Action {
+                nanoseconds             at{0};
+                uint64_t                sequence{0};    //!< Keeps actions scheduled for the same time in order
+                nanoseconds             period{0};      //!< Zero for one-shot actions
+                simulationaction_t      action{};
+
+                bool operator >(const Action& other) const { return at != other.at ? at > other.at : sequence > other.sequence; }
+            };
+
+        private: // +++ Member Functions +++
+            void                        collect();
+            void                        startTransmission();
+            void                        finishTransmission();
+            nanoseconds                 bitsToTime(const uint64_t bits) const;
+            void                        setNow(const nanoseconds now);
+
+        private: // +++ Variables +++
+            uint32_t                    _bitrate{0};
+            nanoseconds                 _now{0};
+            nanoseconds                 _busIdleAt{0};      //!< When the current frame's interframe space ends
+            shared_ptr<CanManualClock>  _clock{};
+
+            int32_t                     _epollFd{-1};
+            vector<Node>                _nodes{};
+            unordered_map<int32_t, size_t> _nodeIndex{};    //!< Driver socket -> node
+            size_t                      _pendingFrames{0};
+
+            priority_queue<Action, vector<Action>, std::greater<Action>> _actions{};
+            uint64_t                    _nextAction{0};
+
+            bool                        _transmitting{false};
+            size_t                      _transmitter{0};
+            CanSimulatedTransmission    _transmission{};
+
+            transmissionhandler_t       _transmissionHandler{};
+            CanSimulatedBusStatistics   _statistics{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANSIMULATEDBUS_HPP
@@ -0,0 +1,120 @@
+/**
+ * @file CanTimerWheel.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a hierarchical timer wheel.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANTIMERWHEEL_HPP
+#define LIBSOCKCANPP_INCLUDE_CANTIMERWHEEL_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace sockcanpp {
+
+    using std::function;
+    using std::vector;
+    using std::chrono::milliseconds;
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    using timerid_t = uint64_t; //!< Identifies a scheduled timer
+
+    /**
+     * @brief CanTimerWheel class; a hierarchical timer wheel with O(1) scheduling and cancellation.
+     *
+     * Timers are kept in four levels of 256 slots each; a timer only moves to a lower level when
+     * the wheel turns past its slot, so each timer is touched at most four times before it expires.
+     * Each timer carries an opaque 64-bit cookie which is handed back when it expires.
+     *
+     * Timers never expire early; they expire on the first call to @ref advance() at or after their
+     * deadline, rounded up to the wheel's resolution.
+     *
+     * @remarks
+     * This class is not thread-safe; owners must serialise access.
+     */
+    class CanTimerWheel {
+        public: // +++ Static +++
+            static constexpr timerid_t  INVALID_TIMER = 0; //!< Never returned by schedule()
+            static constexpr uint32_t   LEVEL_COUNT   = 4; //!< The amount of wheels
+            static constexpr uint32_t   SLOT_BITS     = 8; //!< log2 of the amount of slots per wheel
+            static constexpr uint32_t   SLOT_COUNT    = 1u << SLOT_BITS; //!< The amount of slots per wheel
+
+        public: // +++ Constructor / Destructor +++
+            explicit CanTimerWheel(const nanoseconds resolution = milliseconds(1), const steady_clock::time_point origin = steady_clock::now());
+
+        public: // +++ Timers +++
+            timerid_t                   schedule(const steady_clock::time_point deadline, const uint64_t cookie); //!< Schedules a timer
+            bool                        cancel(const timerid_t timer); //!< Cancels a pending timer
+
+            size_t                      advance(const steady_clock::time_point now, const function<void(uint64_t)>& onExpired); //!< Fires all timers due at the given time
+
+        public: // +++ Getters +++
+            size_t                      size() const { return _activeTimers; } //!< The amount of pending timers
+            bool                        empty() const { return _activeTimers == 0; } //!< Whether or not any timers are pending
+            nanoseconds                 getResolution() const { return _resolution; } //!< The duration of a single tick
+
+        private: // +++ Types +++
+            static constexpr uint8_t NO_LEVEL = UINT8_MAX;
+
+            struct Node {
+                uint32_t    prev{0};
+                uint32_t    next{0};
+                uint32_t    generation{1};
+                bool        active{false};
+                uint8_t     level{NO_LEVEL}; //!< The level whose slot the node is linked into
+                uint64_t    expires{0};
+                uint64_t    cookie{0};
+            };
+
+        private: // +++ Member Functions +++
+            uint32_t                    allocateNode();
+            void                        releaseNode(const uint32_t node);
+            void                        link(const uint32_t head, const uint32_t node);
+            void                        unlink(const uint32_t node);
+            void                        insert(const uint32_t node);
+            void                        cascade(const uint32_t level);
+            size_t                      fire(const function<void(uint64_t)>& onExpired);
+            uint32_t                    slotHead(const uint32_t level, const uint32_t slot) const { return level * SLOT_COUNT + slot; }
+
+        private: // +++ Variables +++
+            nanoseconds                 _resolution;
+            steady_clock::time_point    _origin;
+
+            uint64_t                    _nextTick{0};       //!< The next tick to be processed
+            size_t                      _activeTimers{0};
+
+            vector<Node>                _nodes{};           //!< Slot list heads, followed by the firing and overdue list heads and timer nodes
+            vector<uint32_t>            _freeNodes{};
+            vector<uint32_t>            _cascadeScratch{};
+            uint32_t                    _firingHead{0};     //!< Timers about to be fired
+            uint32_t                    _overdueHead{0};    //!< Timers scheduled in the past
+            size_t                      _levelCounts[LEVEL_COUNT]{}; //!< The amount of timers per level
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANTIMERWHEEL_HPP
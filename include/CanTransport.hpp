@@ -0,0 +1,102 @@
+/**
+ * @file CanTransport.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for the transports a CanDriver's socket can be created with.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANTRANSPORT_HPP
+#define LIBSOCKCANPP_INCLUDE_CANTRANSPORT_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sockcanpp {
+
+    using std::shared_ptr;
+    using std::string;
+    using std::vector;
+
+    /**
+     * @brief Applies a socket's filters to a frame ID the way CAN_RAW_FILTER does, including CAN_INV_FILTER.
+     *
+     * @param filters The socket's filters; an empty list accepts nothing.
+     * @param id The ID of the frame.
+     *
+     * @return true If any filter accepts the frame.
+     * @return false Otherwise.
+     */
+    inline bool canFiltersAccept(const vector<can_filter>& filters, const canid_t id) {
+        for (const auto& filter : filters) {
+            const auto inverted = (filter.can_id & CAN_INV_FILTER) != 0;
+            const auto matches = (id & filter.can_mask) == (filter.can_id & ~CAN_INV_FILTER & filter.can_mask);
+
+            if (matches != inverted) { return true; }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief CanTransport class; creates and configures the sockets used by a CanDriver.
+     *
+     * A transport hands out non-blocking, message-oriented sockets which carry one can_frame per message,
+     * so all of CanDriver's I/O (read/write, recvmmsg/sendmmsg, select/poll and FIONREAD) works unchanged.
+     * Only the CAN-specific socket options are delegated to the transport.
+     */
+    class CanTransport {
+        public: // +++ Destructor +++
+            virtual ~CanTransport() = default;
+
+        public: // +++ Sockets +++
+            virtual int32_t             openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) = 0; //!< Opens a non-blocking socket on an interface, with the given filters applied
+            virtual void                closeSocket(const int32_t socketFd) = 0; //!< Closes a socket opened by this transport
+
+        public: // +++ Socket Options +++
+            virtual void                setFilters(const int32_t socketFd, const vector<can_filter>& filters) = 0; //!< Replaces a socket's receive filters
+            virtual void                setReceiveOwnMessages(const int32_t socketFd, const bool enabled) = 0; //!< Enables or disables the echo of a socket's own frames (CAN_RAW_RECV_OWN_MSGS)
+    };
+
+    /**
+     * @brief CanSocketTransport class; the default transport, using SocketCAN raw sockets.
+     */
+    class CanSocketTransport: public CanTransport {
+        public: // +++ Static +++
+            static shared_ptr<CanTransport> getDefault(); //!< The transport used by drivers which weren't given one
+
+        public: // +++ Sockets +++
+            int32_t                     openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) override;
+            void                        closeSocket(const int32_t socketFd) override;
+
+        public: // +++ Socket Options +++
+            void                        setFilters(const int32_t socketFd, const vector<can_filter>& filters) override;
+            void                        setReceiveOwnMessages(const int32_t socketFd, const bool enabled) override;
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANTRANSPORT_HPP
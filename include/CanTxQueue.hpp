@@ -0,0 +1,179 @@
+/**
+ * @file CanTxQueue.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for a bounded, backpressure-aware transmit queue.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANTXQUEUE_HPP
+#define LIBSOCKCANPP_INCLUDE_CANTXQUEUE_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanDriver.hpp"
+#include "CanMessage.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::condition_variable;
+    using std::deque;
+    using std::mutex;
+    using std::shared_ptr;
+    using std::unordered_map;
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+    using std::chrono::steady_clock;
+
+    /**
+     * @brief What a @ref CanTxQueue does with a new frame while it is full.
+     */
+    enum class CanTxOverflowPolicy: uint8_t {
+        DropOldest, //!< Discard the oldest queued frame to make room
+        DropNewest, //!< Discard the new frame
+        Block,      //!< Wait for room until the block timeout expires, then discard the new frame
+    };
+
+    /**
+     * @brief The counters of a @ref CanTxQueue.
+     */
+    struct CanTxQueueStatistics {
+        uint64_t    enqueued{0};        //!< Frames accepted into the queue
+        uint64_t    coalesced{0};       //!< Frames which replaced the payload of a queued frame with the same ID
+        uint64_t    sent{0};            //!< Frames handed to the kernel
+        uint64_t    droppedOldest{0};   //!< Queued frames discarded to make room (DropOldest)
+        uint64_t    droppedNewest{0};   //!< New frames discarded because the queue was full (DropNewest, Block)
+        uint64_t    blockTimeouts{0};   //!< Enqueue calls which gave up waiting for room (Block)
+        uint64_t    expired{0};         //!< Queued frames discarded because their deadline passed before they could be sent
+        uint64_t    txBufferFull{0};    //!< Flushes stopped by a full socket buffer or interface queue
+        size_t      depth{0};           //!< Frames currently queued
+        size_t      highWaterMark{0};   //!< The largest depth seen
+    };
+
+    /**
+     * @brief CanTxQueue class; parks outgoing frames in userspace while the interface can't take them.
+     *
+     * A non-blocking CAN socket fails with EAGAIN once its send buffer is full and with ENOBUFS once the
+     * interface's queue is full. Instead of failing, frames are kept in a bounded queue and flushed in
+     * batches when the socket becomes writable again.
+     *
+     * The queue is flushed either by a dedicated thread calling @ref run(), or by an existing poll loop:
+     * add @ref getSocketFd() with POLLOUT while @ref isPending() and call @ref flush() when it is writable.
+     *
+     * With coalescing enabled, a frame whose ID is already queued replaces the queued frame's payload in place
+     * instead of being appended. Each ID keeps its position in the queue, so the transmission order of different
+     * IDs is unchanged, but only the newest payload is sent. This suits state-type messages, where an outdated
+     * value is useless once a newer one exists.
+     *
+     * Frames may carry a deadline. Frames still queued when their deadline passes are discarded instead of being
+     * sent late, and free their room in the queue. Deadlines and the back-off while the interface's queue is full
+     * are measured by the queue's clock.
+     *
+     * Frames may be enqueued from any thread.
+     *
+     * @remarks
+     * The driver is not owned by the queue and must outlive it.
+     */
+    class CanTxQueue {
+        public: // +++ Constructor / Destructor +++
+            CanTxQueue(CanDriver& driver, const size_t capacity = 1024, const CanTxOverflowPolicy policy = CanTxOverflowPolicy::DropOldest, const milliseconds blockTimeout = milliseconds(100), const shared_ptr<CanClock>& clock = CanSteadyClock::getDefault()); //!< Constructor
+            virtual ~CanTxQueue() = default;
+
+            CanTxQueue(const CanTxQueue&) = delete;
+            CanTxQueue& operator=(const CanTxQueue&) = delete;
+
+        public: // +++ Configuration +++
+            CanTxQueue&                 setCoalescing(const bool enabled); //!< Enables or disables latest-wins coalescing per ID
+            bool                        isCoalescing() const { return _coalescing; } //!< Whether queued frames are replaced by newer frames with the same ID
+
+        public: // +++ Enqueueing +++
+            bool                        enqueue(const can_frame& frame); //!< Queues a frame for transmission
+            bool                        enqueue(const can_frame& frame, const steady_clock::time_point deadline); //!< Queues a frame which must be sent before its deadline
+            bool                        enqueue(const CanMessage& message, bool forceExtended = false); //!< Queues a message for transmission
+            bool                        enqueue(const CanMessage& message, const steady_clock::time_point deadline, bool forceExtended = false); //!< Queues a message which must be sent before its deadline
+
+        public: // +++ Transmission +++
+            size_t                      flush(); //!< Sends as many queued frames as the interface accepts, without blocking
+            bool                        waitWritable(const milliseconds timeout); //!< Waits until the socket accepts more frames
+            void                        run(); //!< Flushes the queue until stop() is called
+            void                        stop(); //!< Causes run() to return
+
+        public: // +++ Getters +++
+            bool                        isPending() const; //!< Whether frames are waiting to be sent
+            size_t                      getDepth() const; //!< The amount of queued frames
+            size_t                      getCapacity() const { return _capacity; } //!< The maximum amount of queued frames
+            int32_t                     getSocketFd() const { return _driver.getSocketFd(); } //!< The socket to poll for POLLOUT
+            CanTxQueueStatistics        getStatistics() const; //!< Gets a snapshot of the counters
+            void                        resetStatistics(); //!< Clears all counters; the depth is kept
+
+        private: // +++ Types +++
+            struct Entry {
+                can_frame                   frame{};
+                uint64_t                    sequence{0};    //!< Position in the stream of queued frames
+                steady_clock::time_point    deadline{};     //!< The frame is discarded if it hasn't been sent by then
+            };
+
+        private: // +++ Member Functions +++
+            bool                        makeRoom(std::unique_lock<mutex>& locky); //!< Applies the overflow policy; the lock must be held
+            void                        popFront(const size_t count); //!< Removes frames from the front of the queue; the lock must be held
+            size_t                      removeExpired(const steady_clock::time_point now); //!< Discards frames past their deadline; the lock must be held
+
+        private: // +++ Variables +++
+            CanDriver&                  _driver;
+            const size_t                _capacity;
+            const CanTxOverflowPolicy   _policy;
+            const milliseconds          _blockTimeout;
+            const microseconds          _retryInterval{1000}; //!< Back-off while the interface queue is full
+            shared_ptr<CanClock>        _clock;
+
+            mutable mutex               _lock{};
+            condition_variable          _framesAvailable{};
+            condition_variable          _roomAvailable{};
+
+            deque<Entry>                _queue{};
+            uint64_t                    _headSequence{0}; //!< The sequence of the frame at the front of the queue
+            steady_clock::time_point    _nextDeadline{steady_clock::time_point::max()}; //!< No queued frame expires before this
+            bool                        _coalescing{false};
+            unordered_map<canid_t, uint64_t> _queuedIds{}; //!< The sequence of the queued frame per ID, while coalescing
+            CanTxQueueStatistics        _statistics{};
+            bool                        _interfaceFull{false}; //!< The last flush failed with ENOBUFS
+            atomic<bool>                _running{false};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANTXQUEUE_HPP
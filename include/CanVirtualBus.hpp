@@ -0,0 +1,135 @@
+/**
+ * @file CanVirtualBus.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the declarations for an in-process virtual CAN bus.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LIBSOCKCANPP_INCLUDE_CANVIRTUALBUS_HPP
+#define LIBSOCKCANPP_INCLUDE_CANVIRTUALBUS_HPP
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanTransport.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::mutex;
+    using std::string;
+    using std::thread;
+    using std::unordered_map;
+    using std::vector;
+
+    /**
+     * @brief Statistics kept by a @ref CanVirtualBus.
+     */
+    struct CanVirtualBusStatistics {
+        uint64_t    frames{0};      //!< Frames sent on the bus
+        uint64_t    delivered{0};   //!< Frames delivered to receiving sockets
+        uint64_t    dropped{0};     //!< Deliveries dropped because a socket's receive queue was full
+    };
+
+    /**
+     * @brief CanVirtualBus class; an in-process CAN bus which needs neither vcan nor any privileges.
+     *
+     * Each socket opened on the bus is one end of a socketpair(AF_UNIX, SOCK_SEQPACKET); the other end belongs
+     * to the bus. A background thread forwards every frame sent by one socket to all other sockets whose filters
+     * accept it, which mirrors SocketCAN's local loopback. Frame boundaries are preserved and a CanDriver uses the
+     * socket exactly like a raw CAN socket:
+     *
+     * @code
+     * auto bus = std::make_shared<CanVirtualBus>();
+     * CanDriver ecu("vcan0", CAN_RAW, bus);
+     * CanDriver tester("vcan0", CAN_RAW, bus);
+     * @endcode
+     *
+     * All sockets share the bus regardless of the interface name they were opened with. Filters follow
+     * CAN_RAW_FILTER semantics, including CAN_INV_FILTER; an empty filter list receives nothing.
+     * Error frames are not delivered, as with SocketCAN's default error mask.
+     *
+     * @remarks
+     * Echoing a socket's own frames (and thus CanDriver's TX confirmation) is not supported.
+     */
+    class CanVirtualBus: public CanTransport {
+        public: // +++ Constructor / Destructor +++
+            CanVirtualBus(); //!< Constructor
+            virtual ~CanVirtualBus();
+
+            CanVirtualBus(const CanVirtualBus&) = delete;
+            CanVirtualBus& operator=(const CanVirtualBus&) = delete;
+
+        public: // +++ Sockets +++
+            int32_t                     openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) override;
+            void                        closeSocket(const int32_t socketFd) override;
+
+        public: // +++ Socket Options +++
+            void                        setFilters(const int32_t socketFd, const vector<can_filter>& filters) override;
+            void                        setReceiveOwnMessages(const int32_t socketFd, const bool enabled) override;
+
+        public: // +++ Getters +++
+            size_t                      getSocketCount() const; //!< The amount of open sockets
+            CanVirtualBusStatistics     getStatistics() const; //!< Gets the bus's statistics
+
+        private: // +++ Types +++
+            struct Node {
+                int32_t                 busFd{-1};      //!< The bus's end of the socketpair
+                int32_t                 socketFd{-1};   //!< The driver's end; -1 once closed
+                vector<can_filter>      filters{};
+            };
+
+        private: // +++ Member Functions +++
+            void                        forwardLoop();
+            void                        forward(const uint64_t sender, const void* frame, const size_t length);
+            void                        wake();
+
+        private: // +++ Variables +++
+            mutable mutex                       _lock{};
+            unordered_map<uint64_t, Node>       _nodes{};
+            unordered_map<int32_t, uint64_t>    _nodeIndex{};   //!< Driver socket -> node
+            uint64_t                            _nextNode{0};
+            uint64_t                            _generation{0}; //!< Incremented whenever the set of nodes changes
+
+            int32_t                             _wakeFd{-1};
+            atomic<bool>                        _stopping{false};
+            thread                              _forwarder{};
+
+            atomic<uint64_t>                    _frames{0};
+            atomic<uint64_t>                    _delivered{0};
+            atomic<uint64_t>                    _dropped{0};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_INCLUDE_CANVIRTUALBUS_HPP
@@ -0,0 +1,452 @@
+/**
+ * @file CanCandump.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the candump log formatter and parser.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanCandump.hpp"
+#include "CanDriver.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::memchr;
+    using std::memcpy;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    constexpr size_t CanCandump::MAX_LINE_LENGTH;
+
+    namespace {
+
+        const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+        /**
+         * @brief Maps characters to their hex value, or -1.
+         */
+        struct HexTable {
+            HexTable() {
+                memset(values, -1, sizeof(values));
+                for (int32_t i = 0; i < 10; i++) { values['0' + i] = static_cast<int8_t>(i); }
+                for (int32_t i = 0; i < 6; i++) { values['A' + i] = values['a' + i] = static_cast<int8_t>(10 + i); }
+            }
+
+            int8_t values[256];
+        };
+
+        const HexTable HEX_TABLE{};
+
+        int32_t hexValue(const char c) { return HEX_TABLE.values[static_cast<uint8_t>(c)]; }
+
+        /**
+         * @brief Writes a value as a zero-padded decimal number.
+         */
+        char* putDecimal(char* out, uint64_t value, const size_t minDigits) {
+            char digits[20];
+            size_t count = 0;
+
+            do {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value);
+
+            for (auto i = count; i < minDigits; i++) { *out++ = '0'; }
+            while (count) { *out++ = digits[--count]; }
+
+            return out;
+        }
+
+        /**
+         * @brief Writes the lowest digitCount nibbles of a value as upper-case hex.
+         */
+        char* putHex(char* out, const uint32_t value, const size_t digitCount) {
+            for (size_t i = digitCount; i-- > 0;) { *out++ = HEX_DIGITS[(value >> (i * 4)) & 0xF]; }
+
+            return out;
+        }
+
+        char* putBytes(char* out, const uint8_t* data, const size_t length) {
+            for (size_t i = 0; i < length; i++) {
+                *out++ = HEX_DIGITS[data[i] >> 4];
+                *out++ = HEX_DIGITS[data[i] & 0xF];
+            }
+
+            return out;
+        }
+
+#if defined(__SSE2__)
+        /**
+         * @brief Decodes 16 hex digits into 8 bytes.
+         *
+         * @return true If all 16 characters were hex digits and the bytes were written.
+         * @return false Otherwise; nothing is written.
+         */
+        bool decodeHex16(const char* in, uint8_t* out) {
+            const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+
+            // Both differences lie in their range only for the matching characters, as the subtraction is a bijection
+            const auto digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+            const auto letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digits, _mm_set1_epi8(10)));
+            const auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(letters, _mm_set1_epi8(-1)), _mm_cmplt_epi8(letters, _mm_set1_epi8(6)));
+
+            if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) { return false; }
+
+            const auto nibbles = _mm_or_si128(_mm_and_si128(isDigit, digits), _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+
+            // Each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte
+            const auto bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(nibbles, 8));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(bytes, bytes));
+
+            return true;
+        }
+#endif
+
+        /**
+         * @brief Decodes hex byte pairs, optionally separated by dots, up to the end of the payload.
+         *
+         * Where SSE2 is available, undotted runs are decoded 16 digits at a time; the first chunk which isn't
+         * all hex digits (a dot, the end of the payload or a malformed character) hands over to the scalar loop.
+         *
+         * @return int32_t The amount of bytes decoded, or -1 if the payload is malformed or too long.
+         */
+        int32_t parseBytes(const char*& in, const char* end, uint8_t* data, const size_t maxLength) {
+            size_t length = 0;
+
+#if defined(__SSE2__)
+            while (end - in >= 16 && length + 8 <= maxLength && decodeHex16(in, data + length)) {
+                length += 8;
+                in += 16;
+            }
+#endif
+
+            while (in < end && *in != '_' && *in != ' ' && *in != '\t') {
+                if (*in == '.') {
+                    in++;
+                    continue;
+                }
+
+                if (end - in < 2 || length == maxLength) { return -1; }
+
+                const auto high = hexValue(in[0]);
+                const auto low = hexValue(in[1]);
+                if ((high | low) < 0) { return -1; }
+
+                data[length++] = static_cast<uint8_t>((high << 4) | low);
+                in += 2;
+            }
+
+            return static_cast<int32_t>(length);
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Formatting"
+    /**
+     * @brief Formats a classic frame as a candump log line, including the trailing newline.
+     *
+     * @param buffer Receives the NUL-terminated line.
+     * @param bufferSize The size of the buffer; MAX_LINE_LENGTH is always sufficient for short interface names.
+     * @param frame The frame.
+     * @param interface The name of the interface.
+     * @param timestamp The time stamp of the frame.
+     *
+     * @return size_t The length of the line, excluding the NUL, or 0 if the buffer is too small.
+     */
+    size_t CanCandump::format(char* buffer, const size_t bufferSize, const can_frame& frame, const char* interface, const system_clock::time_point timestamp) {
+        canfd_frame fdFrame{};
+        fdFrame.can_id = frame.can_id;
+        fdFrame.len = frame.can_dlc;
+        memcpy(fdFrame.data, frame.data, CAN_MAX_DLEN);
+
+        return formatFrame(buffer, bufferSize, fdFrame, false, interface, timestamp);
+    }
+
+    /**
+     * @brief Formats an FD frame as a candump log line, including the trailing newline.
+     *
+     * @param buffer Receives the NUL-terminated line.
+     * @param bufferSize The size of the buffer; MAX_LINE_LENGTH is always sufficient for short interface names.
+     * @param frame The frame.
+     * @param interface The name of the interface.
+     * @param timestamp The time stamp of the frame.
+     *
+     * @return size_t The length of the line, excluding the NUL, or 0 if the buffer is too small.
+     */
+    size_t CanCandump::format(char* buffer, const size_t bufferSize, const canfd_frame& frame, const char* interface, const system_clock::time_point timestamp) {
+        return formatFrame(buffer, bufferSize, frame, true, interface, timestamp);
+    }
+#pragma endregion
+
+#pragma region "Parsing"
+    /**
+     * @brief Parses a single candump log line.
+     *
+     * Accepts 3-digit standard and 8-digit extended/error IDs, dots between data bytes, and ignores a trailing
+     * length code ("_X") or direction marker.
+     *
+     * @param line The line, without the newline.
+     * @param length The length of the line.
+     * @param frame Receives the frame.
+     *
+     * @return true If the line is a valid candump line.
+     * @return false Otherwise; the frame is left in an unspecified state.
+     */
+    bool CanCandump::parse(const char* line, const size_t length, CanCandumpFrame& frame) {
+        auto in = line;
+        const auto end = line + length;
+
+        frame = CanCandumpFrame{};
+
+        // (seconds.fraction)
+        if (in == end || *in++ != '(') { return false; }
+
+        uint64_t seconds = 0;
+        const auto secondsStart = in;
+        while (in < end && *in >= '0' && *in <= '9') { seconds = seconds * 10 + static_cast<uint64_t>(*in++ - '0'); }
+        if (in == secondsStart || in == end || *in++ != '.') { return false; }
+
+        uint64_t fraction = 0;
+        size_t fractionDigits = 0;
+        while (in < end && *in >= '0' && *in <= '9') {
+            if (fractionDigits < 9) {
+                fraction = fraction * 10 + static_cast<uint64_t>(*in - '0');
+                fractionDigits++;
+            }
+            in++;
+        }
+
+        if (!fractionDigits || in == end || *in++ != ')') { return false; }
+        for (auto i = fractionDigits; i < 9; i++) { fraction *= 10; }
+
+        frame.timestamp = system_clock::time_point(duration_cast<system_clock::duration>(nanoseconds(seconds * 1000000000 + fraction)));
+
+        // Interface
+        while (in < end && *in == ' ') { in++; }
+        frame.interface = in;
+        while (in < end && *in != ' ') { in++; }
+        frame.interfaceLength = static_cast<size_t>(in - frame.interface);
+        if (!frame.interfaceLength) { return false; }
+        while (in < end && *in == ' ') { in++; }
+
+        // ID
+        uint32_t id = 0;
+        const auto idStart = in;
+        while (in < end && *in != '#') {
+            const auto digit = hexValue(*in++);
+            if (digit < 0) { return false; }
+            id = (id << 4) | static_cast<uint32_t>(digit);
+        }
+
+        const auto idLength = in - idStart;
+        if (in == end) { return false; }
+        in++;
+
+        if (idLength == 3) {
+            frame.frame.can_id = id & CAN_SFF_MASK;
+        } else if (idLength == 8) {
+            frame.frame.can_id = (id & CAN_ERR_FLAG) ? id : (id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+        } else {
+            return false;
+        }
+
+        // Payload
+        int32_t payloadLength = 0;
+
+        if (in < end && *in == '#') {
+            in++;
+            if (in == end || hexValue(*in) < 0) { return false; }
+
+            frame.isFd = true;
+            frame.frame.flags = static_cast<uint8_t>(hexValue(*in++));
+            payloadLength = parseBytes(in, end, frame.frame.data, CANFD_MAX_DLEN);
+        } else if (in < end && (*in == 'R' || *in == 'r')) {
+            in++;
+            frame.frame.can_id |= CAN_RTR_FLAG;
+
+            if (in < end && hexValue(*in) >= 0) {
+                payloadLength = hexValue(*in++);
+                if (payloadLength > CAN_MAX_DLEN) { return false; }
+            }
+        } else {
+            payloadLength = parseBytes(in, end, frame.frame.data, CAN_MAX_DLEN);
+        }
+
+        if (payloadLength < 0) { return false; }
+        frame.frame.len = static_cast<uint8_t>(payloadLength);
+
+        // Optional length code of classic frames, then nothing but trailing markers
+        if (in < end && *in == '_') { in = end - in > 2 ? in + 2 : end; }
+
+        return in >= end || *in == ' ' || *in == '\t';
+    }
+#pragma endregion
+
+#pragma region "Reader"
+    /**
+     * @brief Maps a candump log file.
+     *
+     * @param path The path of the log file.
+     */
+    CanCandumpReader::CanCandumpReader(const string& path) {
+        if ((_fileFd = open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        struct stat status{};
+        if (fstat(_fileFd, &status) < 0) {
+            const auto error = errno;
+            ::close(_fileFd);
+            throw CanInitException(formatString("FAILED to stat %s! Error: %d => %s", path.c_str(), error, strerror(error)));
+        }
+
+        _size = static_cast<size_t>(status.st_size);
+        if (!_size) { return; }
+
+        auto mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fileFd, 0);
+        if (mapping == MAP_FAILED) {
+            const auto error = errno;
+            ::close(_fileFd);
+            throw CanInitException(formatString("FAILED to map %s! Error: %d => %s", path.c_str(), error, strerror(error)));
+        }
+
+        madvise(mapping, _size, MADV_SEQUENTIAL);
+        _data = static_cast<const char*>(mapping);
+    }
+
+    /**
+     * @brief Unmaps and closes the log file.
+     */
+    CanCandumpReader::~CanCandumpReader() {
+        if (_data) { munmap(const_cast<char*>(_data), _size); }
+        ::close(_fileFd);
+    }
+
+    /**
+     * @brief Reads the next valid frame.
+     *
+     * @param frame Receives the frame. Its interface name points into the mapped file.
+     *
+     * @return true If a frame was read.
+     * @return false At the end of the file.
+     */
+    bool CanCandumpReader::next(CanCandumpFrame& frame) {
+        while (_position < _size) {
+            const auto start = _data + _position;
+            auto lineEnd = static_cast<const char*>(memchr(start, '\n', _size - _position));
+            if (!lineEnd) { lineEnd = _data + _size; }
+
+            _position = static_cast<size_t>(lineEnd - _data) + 1;
+
+            auto length = static_cast<size_t>(lineEnd - start);
+            if (length && start[length - 1] == '\r') { length--; }
+            if (!length) { continue; }
+
+            if (CanCandump::parse(start, length, frame)) { return true; }
+            _invalidLines++;
+        }
+
+        return false;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Formats a frame, as classic or FD frame.
+     */
+    size_t CanCandump::formatFrame(char* buffer, const size_t bufferSize, const canfd_frame& frame, const bool isFd, const char* interface, const system_clock::time_point timestamp) {
+        const auto interfaceLength = strlen(interface);
+        const size_t length = frame.len > (isFd ? CANFD_MAX_DLEN : CAN_MAX_DLEN) ? (isFd ? CANFD_MAX_DLEN : CAN_MAX_DLEN) : frame.len;
+
+        // "(" seconds "." micros ") " interface " " id "##" flags data "\n" NUL
+        if (bufferSize < 1 + 20 + 1 + 6 + 2 + interfaceLength + 1 + 8 + 3 + 2 * length + 2) { return 0; }
+
+        auto nanos = duration_cast<nanoseconds>(timestamp.time_since_epoch()).count();
+        if (nanos < 0) { nanos = 0; }
+
+        auto out = buffer;
+        *out++ = '(';
+        out = putDecimal(out, static_cast<uint64_t>(nanos / 1000000000), 10);
+        *out++ = '.';
+        out = putDecimal(out, static_cast<uint64_t>(nanos % 1000000000 / 1000), 6);
+        *out++ = ')';
+        *out++ = ' ';
+        memcpy(out, interface, interfaceLength);
+        out += interfaceLength;
+        *out++ = ' ';
+
+        if (frame.can_id & CAN_ERR_FLAG) {
+            out = putHex(out, frame.can_id & (CAN_ERR_MASK | CAN_ERR_FLAG), 8);
+        } else if (frame.can_id & CAN_EFF_FLAG) {
+            out = putHex(out, frame.can_id & CAN_EFF_MASK, 8);
+        } else {
+            out = putHex(out, frame.can_id & CAN_SFF_MASK, 3);
+        }
+
+        *out++ = '#';
+
+        if (isFd) {
+            *out++ = '#';
+            *out++ = HEX_DIGITS[frame.flags & 0xF];
+            out = putBytes(out, frame.data, length);
+        } else if (frame.can_id & CAN_RTR_FLAG) {
+            *out++ = 'R';
+            if (length) { *out++ = HEX_DIGITS[length]; }
+        } else {
+            out = putBytes(out, frame.data, length);
+        }
+
+        *out++ = '\n';
+        *out = '\0';
+
+        return static_cast<size_t>(out - buffer);
+    }
+
+} // namespace sockcanpp
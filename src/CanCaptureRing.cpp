@@ -0,0 +1,332 @@
+/**
+ * @file CanCaptureRing.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the crash-surviving capture ring.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanCaptureRing.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::atomic_thread_fence;
+    using std::memcpy;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    static_assert(sizeof(CanRecord) % sizeof(uint64_t) == 0, "CanRecord is expected to be a multiple of 8 bytes!");
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory requires lock-free atomics!");
+
+    constexpr uint64_t CanCaptureRingHeader::MAGIC;
+    constexpr uint32_t CanCaptureRingHeader::VERSION;
+
+    namespace {
+
+        constexpr size_t RECORD_WORDS = sizeof(CanRecord) / sizeof(uint64_t);
+        constexpr size_t RECORD_DATA_OFFSET = offsetof(CanRecord, data);
+
+        /**
+         * @brief Gets the size of the header area; slots start on the following page.
+         */
+        size_t headerAreaSize() {
+            const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            return ((sizeof(CanCaptureRingHeader) + pageSize - 1) / pageSize) * pageSize;
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Creates a new, empty ring at the given path.
+     *
+     * The ring is built in a temporary file next to the path and renamed into place once it is initialised.
+     * An existing ring at the path, e.g. that of a crashed process, is first moved to @ref getPreviousPath(),
+     * so its frames can still be extracted; processes reading it keep a valid mapping.
+     *
+     * @param path The file backing the ring, e.g. /dev/shm/can0.ring or a file on a hugetlbfs mount.
+     * @param capacity The amount of frames the ring holds. Rounded up to the next power of two.
+     */
+    CanCaptureRing::CanCaptureRing(const string& path, const size_t capacity): _path(path) {
+        uint64_t slotCount = 2;
+        while (slotCount < capacity) { slotCount <<= 1; }
+
+        auto temporaryPath = path + ".XXXXXX";
+        if ((_fileFd = mkostemp(&temporaryPath[0], O_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to create %s! Error: %d => %s", temporaryPath.c_str(), errno, strerror(errno)));
+        }
+
+        const auto fail = [this, &temporaryPath](const char* what, const int32_t error) {
+            close(_fileFd);
+            unlink(temporaryPath.c_str());
+            return CanInitException(formatString("FAILED to %s %s! Error: %d => %s", what, _path.c_str(), error, strerror(error)));
+        };
+
+        if (fchmod(_fileFd, 0644) < 0) { throw fail("create", errno); }
+
+        // hugetlbfs only accepts multiples of its page size, which it reports as the block size
+        struct statfs fileSystem{};
+        const auto blockSize = fstatfs(_fileFd, &fileSystem) == 0 && fileSystem.f_bsize > 0 ? static_cast<size_t>(fileSystem.f_bsize) : size_t(1);
+
+        const auto dataOffset = headerAreaSize();
+        _mappingSize = dataOffset + slotCount * sizeof(CanCaptureRingSlot);
+        _mappingSize = ((_mappingSize + blockSize - 1) / blockSize) * blockSize;
+
+        if (ftruncate(_fileFd, static_cast<off_t>(_mappingSize)) < 0) { throw fail("size", errno); }
+
+        // Pre-fault the whole ring so recording never takes a page fault
+        auto mapping = mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fileFd, 0);
+        if (mapping == MAP_FAILED) { throw fail("map", errno); }
+
+        // The new file is zero-filled, which is a valid state for all slots
+        _header = new (mapping) CanCaptureRingHeader;
+        _header->version = CanCaptureRingHeader::VERSION;
+        _header->slotSize = sizeof(CanCaptureRingSlot);
+        _header->capacity = slotCount;
+        _header->dataOffset = dataOffset;
+        _header->created = duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+        _header->pid = getpid();
+        _header->head.store(0, memory_order_relaxed);
+        _header->magic.store(CanCaptureRingHeader::MAGIC, memory_order_release);
+
+        _slots = reinterpret_cast<CanCaptureRingSlot*>(static_cast<uint8_t*>(mapping) + dataOffset);
+        _mask = slotCount - 1;
+
+        if ((rename(path.c_str(), getPreviousPath(path).c_str()) < 0 && errno != ENOENT) || rename(temporaryPath.c_str(), path.c_str()) < 0) {
+            const auto error = errno;
+            munmap(mapping, _mappingSize);
+            _header = nullptr;
+            throw fail("replace", error);
+        }
+    }
+
+    /**
+     * @brief Unmaps and closes the ring. The file and its contents are kept.
+     */
+    CanCaptureRing::~CanCaptureRing() {
+        if (_header) { munmap(_header, _mappingSize); }
+        if (_fileFd >= 0) { close(_fileFd); }
+    }
+#pragma endregion
+
+#pragma region "Recording"
+    /**
+     * @brief Records a classic frame.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received.
+     * @param flags Additional CanRecordFlags.
+     */
+    void CanCaptureRing::record(const can_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        write(frame.can_id, frame.data, std::min<uint8_t>(frame.can_dlc, CAN_MAX_DLEN), flags & ~CAN_RECORD_FD, ifindex, timestamp);
+    }
+
+    /**
+     * @brief Records an FD frame.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received.
+     * @param flags Additional CanRecordFlags; CAN_RECORD_FD is always set.
+     */
+    void CanCaptureRing::record(const canfd_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        write(frame.can_id, frame.data, std::min<uint8_t>(frame.len, CANFD_MAX_DLEN), canRecordFdFlags(frame, flags), ifindex, timestamp);
+    }
+
+    /**
+     * @brief Waits for frames on a driver and records all of them.
+     *
+     * @param driver The driver to read from.
+     * @param ifindex The index of the driver's interface.
+     * @param timeout The maximum time to wait for frames.
+     *
+     * @return size_t The amount of frames read.
+     */
+    size_t CanCaptureRing::receiveFrom(CanDriver& driver, const int32_t ifindex, const milliseconds timeout) {
+        if (!driver.waitForMessages(timeout)) { return 0; }
+
+        return readCanRecordBatches(driver, [&](const can_frame& frame, const system_clock::time_point timestamp) { record(frame, ifindex, timestamp); });
+    }
+#pragma endregion
+
+#pragma region "Extraction"
+    /**
+     * @brief Gets the path an existing ring is moved to when a new ring is created in its place.
+     *
+     * @param path The path of the ring.
+     */
+    string CanCaptureRing::getPreviousPath(const string& path) { return path + ".previous"; }
+
+    /**
+     * @brief Extracts the most recent frames from a ring.
+     *
+     * Works on the ring of a crashed (or exited) process as well as on a live one; slots which are
+     * being written while they're read are skipped and counted as torn.
+     *
+     * @param path The file backing the ring.
+     * @param maxRecords The maximum amount of frames to extract, newest first. Zero extracts the whole ring.
+     *
+     * @return CanCaptureDump The extracted frames, oldest first.
+     */
+    CanCaptureDump CanCaptureRing::extract(const string& path, const size_t maxRecords) {
+        const auto fileFd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileFd < 0) {
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        struct stat status{};
+        const auto headerSize = headerAreaSize();
+        if (fstat(fileFd, &status) < 0 || static_cast<size_t>(status.st_size) < headerSize) {
+            close(fileFd);
+            throw CanInitException(formatString("%s is not a capture ring!", path.c_str()));
+        }
+
+        const auto mappingSize = static_cast<size_t>(status.st_size);
+        auto mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fileFd, 0);
+        close(fileFd);
+
+        if (mapping == MAP_FAILED) {
+            throw CanInitException(formatString("FAILED to map %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        const auto header = static_cast<const CanCaptureRingHeader*>(mapping);
+        const auto capacity = header->capacity;
+        const auto valid = header->magic.load(memory_order_acquire) == CanCaptureRingHeader::MAGIC &&
+                           header->version == CanCaptureRingHeader::VERSION && header->slotSize == sizeof(CanCaptureRingSlot) &&
+                           header->dataOffset == headerSize && capacity >= 2 && (capacity & (capacity - 1)) == 0 &&
+                           static_cast<uint64_t>(mappingSize) >= headerSize + capacity * sizeof(CanCaptureRingSlot);
+
+        if (!valid) {
+            munmap(mapping, mappingSize);
+            throw CanInitException(formatString("%s does not contain a compatible capture ring!", path.c_str()));
+        }
+
+        const auto slots = reinterpret_cast<const CanCaptureRingSlot*>(static_cast<const uint8_t*>(mapping) + headerSize);
+        const auto head = header->head.load(memory_order_acquire);
+
+        auto count = std::min<uint64_t>(head, capacity);
+        if (maxRecords) { count = std::min<uint64_t>(count, maxRecords); }
+
+        CanCaptureDump dump{};
+        dump.pid = header->pid;
+        dump.written = head;
+        dump.records.reserve(static_cast<size_t>(count));
+
+        for (auto position = head - count; position < head; position++) {
+            const auto& slot = slots[position & (capacity - 1)];
+            const auto expected = 2 * position + 2;
+
+            if (slot.sequence.load(memory_order_acquire) != expected) {
+                dump.torn++;
+                continue;
+            }
+
+            uint64_t words[RECORD_WORDS];
+            for (size_t i = 0; i < RECORD_WORDS; i++) { words[i] = slot.words[i].load(memory_order_relaxed); }
+
+            atomic_thread_fence(memory_order_acquire);
+            if (slot.sequence.load(memory_order_relaxed) != expected) {
+                dump.torn++;
+                continue;
+            }
+
+            CanRecord record{};
+            memcpy(&record, words, sizeof(record));
+
+            // Only the valid part of the payload is written; clear what a previous, longer frame left behind
+            record.length = std::min<uint8_t>(record.length, CANFD_MAX_DLEN);
+            std::fill(record.data + record.length, record.data + CANFD_MAX_DLEN, uint8_t(0));
+            dump.records.push_back(record);
+        }
+
+        munmap(mapping, mappingSize);
+
+        return dump;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Writes a frame to the next slot and publishes the new head.
+     *
+     * Only the words covering the record's header and valid payload are stored.
+     */
+    void CanCaptureRing::write(const canid_t id, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp) {
+        CanRecord record{};
+        record.timestamp = duration_cast<nanoseconds>(timestamp.time_since_epoch()).count();
+        record.canId = id;
+        record.ifindex = ifindex;
+        record.length = length;
+        record.flags = flags;
+        memcpy(record.data, data, length);
+
+        uint64_t words[RECORD_WORDS];
+        memcpy(words, &record, sizeof(words));
+        const auto wordCount = (RECORD_DATA_OFFSET + length + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+        auto& slot = _slots[_head & _mask];
+
+        slot.sequence.store(2 * _head + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+
+        for (size_t i = 0; i < wordCount; i++) { slot.words[i].store(words[i], memory_order_relaxed); }
+
+        slot.sequence.store(2 * _head + 2, memory_order_release);
+        _header->head.store(++_head, memory_order_release);
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,195 @@
+/**
+ * @file CanClock.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the steady and manual clocks.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <poll.h>
+#include <time.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanClock.hpp"
+#include "CanDriver.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::make_shared;
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::this_thread::sleep_for;
+
+    namespace {
+
+        /**
+         * @brief Checks whether a file descriptor is readable, waiting up to timeoutMs milliseconds.
+         */
+        bool pollReadable(const int32_t fd, const int32_t timeoutMs) {
+            pollfd descriptor{};
+            descriptor.fd = fd;
+            descriptor.events = POLLIN;
+
+            int32_t result = 0;
+            while ((result = poll(&descriptor, 1, timeoutMs)) < 0 && errno == EINTR) { }
+
+            if (result < 0) { throw CanException(formatString("FAILED to wait for socket! Error: %d => %s", errno, strerror(errno)), fd); }
+
+            return result > 0;
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+    /**
+     * @brief Waits until the given point in time; times in the past return immediately.
+     *
+     * @param time The point in time to wait for.
+     */
+    void CanClock::sleepUntil(const steady_clock::time_point time) { sleepFor(duration_cast<nanoseconds>(time - now())); }
+
+    /**
+     * @brief Gets the clock used by objects which weren't given one.
+     */
+    shared_ptr<CanClock> CanSteadyClock::getDefault() {
+        static const shared_ptr<CanClock> defaultClock = make_shared<CanSteadyClock>();
+
+        return defaultClock;
+    }
+
+#pragma region "Steady Clock"
+    /**
+     * @brief Blocks the calling thread for the given duration.
+     *
+     * @param duration The duration to sleep for.
+     */
+    void CanSteadyClock::sleepFor(const nanoseconds duration) {
+        if (duration.count() > 0) { sleep_for(duration); }
+    }
+
+    /**
+     * @brief Blocks the calling thread until an absolute point in time.
+     *
+     * Sleeps on the absolute CLOCK_MONOTONIC time (which steady_clock uses on Linux), so being preempted
+     * between reading the clock and going to sleep doesn't delay the wakeup.
+     *
+     * @param time The point in time to wake up at.
+     */
+    void CanSteadyClock::sleepUntil(const steady_clock::time_point time) {
+        const auto deadline = duration_cast<nanoseconds>(time.time_since_epoch()).count();
+        if (deadline <= 0) { return; }
+
+        timespec wakeup{};
+        wakeup.tv_sec = static_cast<time_t>(deadline / 1000000000);
+        wakeup.tv_nsec = static_cast<long>(deadline % 1000000000);
+
+        int32_t result = 0;
+        while ((result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, nullptr)) == EINTR) { }
+
+        if (result != 0) { throw CanException(formatString("FAILED to sleep! Error: %d => %s", result, strerror(result)), -1); }
+    }
+
+    /**
+     * @brief Blocks until a file descriptor is readable or the timeout elapses.
+     *
+     * @param fd The file descriptor.
+     * @param timeout The maximum time to wait; rounded up to whole milliseconds.
+     *
+     * @return true If the file descriptor is readable.
+     * @return false If the timeout elapsed.
+     */
+    bool CanSteadyClock::waitReadable(const int32_t fd, const nanoseconds timeout) {
+        const auto timeoutMs = timeout.count() <= 0 ? 0 : duration_cast<milliseconds>(timeout + milliseconds(1) - nanoseconds(1)).count();
+
+        return pollReadable(fd, static_cast<int32_t>(timeoutMs));
+    }
+#pragma endregion
+
+#pragma region "Manual Clock"
+    /**
+     * @brief Constructs a new manual clock.
+     *
+     * @param start The time the clock starts at.
+     */
+    CanManualClock::CanManualClock(const steady_clock::time_point start): _now(duration_cast<nanoseconds>(start.time_since_epoch()).count()) { }
+
+    /**
+     * @brief Gets the clock's current time.
+     */
+    steady_clock::time_point CanManualClock::now() const {
+        return steady_clock::time_point(duration_cast<steady_clock::duration>(nanoseconds(_now.load())));
+    }
+
+    /**
+     * @brief Checks a file descriptor without blocking; if it isn't readable, advances the clock by the timeout.
+     *
+     * @param fd The file descriptor.
+     * @param timeout The time to advance the clock by if the descriptor isn't readable.
+     *
+     * @return true If the file descriptor is readable.
+     * @return false Otherwise.
+     */
+    bool CanManualClock::waitReadable(const int32_t fd, const nanoseconds timeout) {
+        if (pollReadable(fd, 0)) { return true; }
+
+        advance(timeout);
+
+        return pollReadable(fd, 0);
+    }
+
+    /**
+     * @brief Moves the clock forward.
+     *
+     * @param duration The duration to advance by; negative durations are ignored.
+     */
+    void CanManualClock::advance(const nanoseconds duration) {
+        if (duration.count() > 0) { _now += duration.count(); }
+    }
+
+    /**
+     * @brief Moves the clock forward to a point in time.
+     *
+     * @param time The new time; the clock never moves backwards.
+     */
+    void CanManualClock::advanceTo(const steady_clock::time_point time) {
+        const auto target = duration_cast<nanoseconds>(time.time_since_epoch()).count();
+        auto current = _now.load();
+
+        while (current < target && !_now.compare_exchange_weak(current, target)) { }
+    }
+#pragma endregion
+
+} // namespace sockcanpp
@@ -0,0 +1,293 @@
+/**
+ * @file CanCycleSupervisor.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the periodic-message supervisor.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanCycleSupervisor.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::unique_lock;
+    using std::chrono::duration_cast;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new supervisor.
+     *
+     * @param handler Receives all timeout, jitter and recovery events.
+     * @param resolution The granularity of timeout detection.
+     * @param clock The clock used when no time is passed explicitly.
+     */
+    CanCycleSupervisor::CanCycleSupervisor(const cycleeventhandler_t& handler, const nanoseconds resolution, const shared_ptr<CanClock>& clock):
+        _handler(handler), _clock(clock ? clock : CanSteadyClock::getDefault()), _timeouts(resolution, _clock->now()) { }
+#pragma endregion
+
+#pragma region "Configuration"
+    /**
+     * @brief Starts (or reconfigures) supervision of a cyclic message, as of the supervisor's clock's current time.
+     */
+    void CanCycleSupervisor::monitor(const CanId id, const nanoseconds period, const nanoseconds tolerance) { monitor(id, period, tolerance, _clock->now()); }
+
+    /**
+     * @brief Starts (or reconfigures) supervision of a cyclic message.
+     *
+     * The first timeout is raised if the message doesn't arrive within period + tolerance of now.
+     *
+     * @param id The ID of the cyclic message. IDs above 0x7FF are treated as extended IDs.
+     * @param period The expected cycle time.
+     * @param tolerance The allowed deviation from the cycle time.
+     * @param now The time supervision starts.
+     */
+    void CanCycleSupervisor::monitor(const CanId id, const nanoseconds period, const nanoseconds tolerance, const steady_clock::time_point now) {
+        if (period.count() <= 0) { throw CanException("Cycle time must be greater than zero!", -1); }
+
+        unique_lock<mutex> locky(_lock);
+
+        const auto key = normaliseCanId(*id);
+        auto existing = _monitorIndex.find(key);
+        uint64_t index = 0;
+
+        if (existing != _monitorIndex.end()) {
+            index = existing->second;
+            _timeouts.cancel(_monitors[index].timer);
+        } else if (!_freeMonitors.empty()) {
+            index = _freeMonitors.back();
+            _freeMonitors.pop_back();
+        } else {
+            index = _monitors.size();
+            _monitors.emplace_back();
+        }
+
+        auto& monitor = _monitors[index];
+        monitor = Monitor{};
+        monitor.id = key;
+        monitor.period = period;
+        monitor.tolerance = tolerance;
+
+        _monitorIndex[key] = index;
+        arm(monitor, index, now);
+    }
+
+    /**
+     * @brief Stops supervision of a message.
+     *
+     * @param id The ID of the message.
+     *
+     * @return true If the ID was monitored.
+     * @return false Otherwise.
+     */
+    bool CanCycleSupervisor::unmonitor(const CanId id) {
+        unique_lock<mutex> locky(_lock);
+
+        auto existing = _monitorIndex.find(normaliseCanId(*id));
+        if (existing == _monitorIndex.end()) { return false; }
+
+        const auto index = existing->second;
+        _timeouts.cancel(_monitors[index].timer);
+        _monitors[index] = Monitor{};
+        _freeMonitors.push_back(index);
+        _monitorIndex.erase(existing);
+
+        return true;
+    }
+#pragma endregion
+
+#pragma region "Receive Path"
+    /**
+     * @brief Records the arrival of a message at the supervisor's clock's current time.
+     */
+    bool CanCycleSupervisor::onMessage(const CanMessage& message) { return onMessage(message, _clock->now()); }
+
+    /**
+     * @brief Records the arrival of a message and checks its cycle time.
+     *
+     * @param message The received message.
+     * @param received The time the message was received.
+     *
+     * @return true If the message's ID is monitored.
+     * @return false Otherwise, or if the message is an error frame or remote request.
+     */
+    bool CanCycleSupervisor::onMessage(const CanMessage& message, const steady_clock::time_point received) {
+        // Neither carries the monitored signal; an error class could also alias a monitored standard ID
+        if (message.getCanId().hasErrorFrameFlag() || message.getCanId().hasRtrFrameFlag()) { return false; }
+
+        vector<CanCycleEvent> events{};
+
+        {
+            unique_lock<mutex> locky(_lock);
+
+            auto existing = _monitorIndex.find(normaliseCanId(*message.getCanId()));
+            if (existing == _monitorIndex.end()) { return false; }
+
+            const auto index = existing->second;
+            auto& monitor = _monitors[index];
+            auto& statistics = monitor.statistics;
+            statistics.received++;
+
+            if (monitor.hasArrived) {
+                const auto interval = duration_cast<nanoseconds>(received - monitor.lastArrival);
+                const auto deviation = interval > monitor.period ? interval - monitor.period : monitor.period - interval;
+
+                if (statistics.received == 2 || interval < statistics.minInterval) { statistics.minInterval = interval; }
+                if (interval > statistics.maxInterval) { statistics.maxInterval = interval; }
+
+                CanCycleEvent event{};
+                event.id = CanId(monitor.id);
+                event.expectedPeriod = monitor.period;
+                event.interval = interval;
+                event.time = received;
+
+                if (statistics.timedOut) {
+                    event.type = CanCycleEventType::Recovered;
+                    events.push_back(event);
+                } else if (deviation > monitor.tolerance) {
+                    event.type = CanCycleEventType::Jitter;
+                    statistics.jitterEvents++;
+                    events.push_back(event);
+                }
+            } else if (statistics.timedOut) {
+                CanCycleEvent event{};
+                event.type = CanCycleEventType::Recovered;
+                event.id = CanId(monitor.id);
+                event.expectedPeriod = monitor.period;
+                event.time = received;
+                events.push_back(event);
+            }
+
+            statistics.timedOut = false;
+            monitor.hasArrived = true;
+            monitor.lastArrival = received;
+
+            _timeouts.cancel(monitor.timer);
+            arm(monitor, index, received);
+        }
+
+        dispatch(events);
+
+        return true;
+    }
+
+    /**
+     * @brief Raises a timeout for every monitored message which is overdue by the supervisor's clock.
+     */
+    size_t CanCycleSupervisor::expire() { return expire(_clock->now()); }
+
+    /**
+     * @brief Raises a timeout for every monitored message which is overdue.
+     *
+     * @param now The current time.
+     *
+     * @return size_t The amount of timeouts raised.
+     */
+    size_t CanCycleSupervisor::expire(const steady_clock::time_point now) {
+        vector<CanCycleEvent> events{};
+
+        {
+            unique_lock<mutex> locky(_lock);
+
+            _timeouts.advance(now, [this, &events, now](uint64_t index) {
+                auto& monitor = _monitors[index];
+                monitor.timer = CanTimerWheel::INVALID_TIMER;
+                monitor.statistics.timedOut = true;
+                monitor.statistics.timeouts++;
+
+                CanCycleEvent event{};
+                event.type = CanCycleEventType::Timeout;
+                event.id = CanId(monitor.id);
+                event.expectedPeriod = monitor.period;
+                event.interval = monitor.hasArrived ? duration_cast<nanoseconds>(now - monitor.lastArrival) : nanoseconds(0);
+                event.time = now;
+                events.push_back(event);
+            });
+        }
+
+        dispatch(events);
+
+        return events.size();
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the statistics of a monitored message.
+     *
+     * @param id The ID of the message.
+     *
+     * @return CanCycleStatistics The message's statistics.
+     */
+    CanCycleStatistics CanCycleSupervisor::getStatistics(const CanId id) const {
+        unique_lock<mutex> locky(_lock);
+
+        auto existing = _monitorIndex.find(normaliseCanId(*id));
+        if (existing == _monitorIndex.end()) { throw CanException("ID is not monitored!", -1); }
+
+        return _monitors[existing->second].statistics;
+    }
+
+    /**
+     * @brief Gets the amount of monitored messages.
+     */
+    size_t CanCycleSupervisor::getMonitoredCount() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _monitorIndex.size();
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Schedules the next timeout of a monitored message. The lock must be held.
+     */
+    void CanCycleSupervisor::arm(Monitor& monitor, const uint64_t index, const steady_clock::time_point from) {
+        monitor.timer = _timeouts.schedule(from + monitor.period + monitor.tolerance, index);
+    }
+
+    /**
+     * @brief Delivers events to the handler. The lock must not be held.
+     */
+    void CanCycleSupervisor::dispatch(const vector<CanCycleEvent>& events) const {
+        if (!_handler) { return; }
+
+        for (const auto& event : events) { _handler(event); }
+    }
+
+} // namespace sockcanpp
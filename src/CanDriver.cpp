@@ -36,9 +36,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <future>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -63,16 +66,52 @@ namespace sockcanpp {
     using exceptions::CanInitException;
     using exceptions::InvalidSocketException;
 
+    using std::make_exception_ptr;
     using std::mutex;
     using std::queue;
     using std::string;
     using std::strncpy;
     using std::unique_lock;
     using std::unique_ptr;
+    using std::chrono::duration_cast;
     using std::chrono::milliseconds;
-    using std::this_thread::sleep_for;
+    using std::chrono::seconds;
     using std::vector;
 
+    constexpr size_t CanDriver::CAN_MAX_BATCH_SIZE;
+
+    namespace {
+
+        /**
+         * @brief Converts a filter map to the filters understood by the kernel.
+         */
+        vector<can_filter> toCanFilters(const filtermap_t& filters) {
+            vector<can_filter> canFilters{};
+
+            // Structured bindings only available with C++17
+            #if __cplusplus >= 201703L
+            for (const auto [id, filter] : filters) {
+                canFilters.push_back({id, filter});
+            }
+            #else
+            for (const auto& filterPair : filters) {
+                canFilters.push_back({filterPair.first, filterPair.second});
+            }
+            #endif
+
+            return canFilters;
+        }
+
+        /**
+         * @brief Ancillary data buffer for a single kernel timestamp, aligned for cmsghdr.
+         */
+        union TimestampControl {
+            char    buffer[CMSG_SPACE(sizeof(timespec))];
+            cmsghdr align;
+        };
+
+    }
+
     //////////////////////////////////////
     //      PUBLIC IMPLEMENTATION       //
     //////////////////////////////////////
@@ -89,12 +128,56 @@ namespace sockcanpp {
         _defaultSenderId(defaultSenderId), _canFilterMask(filters), _canProtocol(canProtocol), _canInterface(canInterface) {
         initialiseSocketCan();
     }
+
+    /**
+     * @brief Constructs a driver whose socket is created by the given transport.
+     *
+     * @param canInterface The interface to open.
+     * @param canProtocol The CAN protocol to use.
+     * @param transport The transport creating the socket, e.g. a CanVirtualBus.
+     * @param filters The filters to apply.
+     * @param defaultSenderId The ID to send messages with if no other ID was set.
+     */
+    CanDriver::CanDriver(const string& canInterface, const int32_t canProtocol, const shared_ptr<CanTransport>& transport, const filtermap_t& filters, const CanId defaultSenderId):
+        _defaultSenderId(defaultSenderId), _canFilterMask(filters), _canProtocol(canProtocol), _canInterface(canInterface), _transport(transport) {
+        initialiseSocketCan();
+    }
+#pragma endregion
+
+#pragma region "Getter / Setter"
+    /**
+     * @brief Sets the clock which times waitForMessages() and the delays of sendMessageQueue().
+     *
+     * A CanManualClock makes these return immediately and advance simulated time instead.
+     *
+     * @param clock The clock to use; nullptr restores the default steady clock.
+     *
+     * @return CanDriver& This instance.
+     */
+    CanDriver& CanDriver::setClock(const shared_ptr<CanClock>& clock) {
+        unique_lock<mutex> locky(_lock);
+
+        _clock = clock ? clock : CanSteadyClock::getDefault();
+
+        return *this;
+    }
+
+    /**
+     * @brief Gets the clock used for waiting and delays.
+     */
+    shared_ptr<CanClock> CanDriver::getClock() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _clock;
+    }
 #pragma endregion
 
 #pragma region "I / O"
     /**
      * @brief Blocks until one or more CAN messages appear on the bus, or until the timeout runs out.
      *
+     * The timeout is measured by the driver's clock; see @ref setClock().
+     *
      * @param timeout The time (in millis) to wait before timing out.
      *
      * @return true If messages are available on the bus.
@@ -105,14 +188,7 @@ namespace sockcanpp {
 
         unique_lock<mutex> locky(_lock);
 
-        fd_set readFileDescriptors;
-        timeval waitTime;
-        waitTime.tv_sec = timeout.count() / 1000;
-        waitTime.tv_usec = timeout.count() * 1000;
-
-        FD_ZERO(&readFileDescriptors);
-        FD_SET(_socketFd, &readFileDescriptors);
-        const auto fdsAvailable = select(_socketFd + 1, &readFileDescriptors, nullptr, nullptr, &waitTime);
+        const auto fdsAvailable = _clock->waitReadable(_socketFd, timeout);
 
         int32_t bytesAvailable{0};
         const auto retCode = ioctl(_socketFd, FIONREAD, &bytesAvailable);
@@ -122,7 +198,7 @@ namespace sockcanpp {
             _queueSize = 0;
         }
 
-        return fdsAvailable > 0;
+        return fdsAvailable;
     }
 
     /**
@@ -144,14 +220,11 @@ namespace sockcanpp {
         
         if (0 > _socketFd) { throw InvalidSocketException("Invalid socket!", _socketFd); }
 
-        ssize_t readBytes{0};
         can_frame canFrame{};
 
         memset(&canFrame, 0, sizeof(can_frame));
 
-        readBytes = read(_socketFd, &canFrame, sizeof(can_frame));
-
-        if (0 > readBytes) { throw CanException(formatString("FAILED to read from CAN! Error: %d => %s", errno, strerror(errno)), _socketFd); }
+        if (!receiveFrame(canFrame)) { throw CanException(formatString("FAILED to read from CAN! Error: %d => %s", errno, strerror(errno)), _socketFd); }
 
         return CanMessage{canFrame};
     }
@@ -190,7 +263,7 @@ namespace sockcanpp {
      * @brief Attempts to send a queue of messages on the associated CAN bus.
      *
      * @param messages A queue containing the messages to be sent.
-     * @param delay If greater than 0, will delay the sending of the next message.
+     * @param delay If greater than 0, will delay the sending of the next message. Measured by the driver's clock.
      * @param forceExtended Whether or not to force use of an extended ID.
      *
      * @return int32_t The total amount of bytes sent.
@@ -199,10 +272,13 @@ namespace sockcanpp {
         if (_socketFd < 0) { throw InvalidSocketException("Invalid socket!", _socketFd); }
 
         ssize_t totalBytesWritten = 0;
+        const auto clock = getClock(); // setClock() may replace the clock while we're sleeping
 
         while (!messages.empty()) {
             totalBytesWritten += sendMessage(messages.front(), forceExtended);
             messages.pop();
+
+            if (!messages.empty() && delay.count() > 0) { clock->sleepFor(delay); }
         }
 
         return totalBytesWritten;
@@ -220,12 +296,115 @@ namespace sockcanpp {
         queue<CanMessage> messages{};
 
         for (int32_t i = _queueSize; 0 < i; --i) {
+            // The queue size includes TX confirmations, which are consumed without producing a message
+            if (_txConfirmation) {
+                can_frame canFrame{};
+                if (!receiveFrame(canFrame)) { break; }
+
+                messages.emplace(canFrame);
+                continue;
+            }
+
 	        messages.emplace(readMessageLock(false));
         }
 
         return messages;
     }
 
+    /**
+     * @brief Reads as many raw frames as are available (up to maxFrames) using a single system call.
+     *
+     * This does not block; if no frames are available, zero is returned.
+     *
+     * @param frames The buffer to read the frames into.
+     * @param maxFrames The capacity of the buffer. At most CAN_MAX_BATCH_SIZE frames are read per call.
+     *
+     * @return size_t The amount of frames read.
+     */
+    size_t CanDriver::readFrames(can_frame* frames, const size_t maxFrames) {
+        if (_socketFd < 0) { throw InvalidSocketException("Invalid socket!", _socketFd); }
+
+        unique_lock<mutex> locky{_lock};
+
+        const auto frameCount = maxFrames < CAN_MAX_BATCH_SIZE ? maxFrames : CAN_MAX_BATCH_SIZE;
+        const bool confirmations = _txConfirmation;
+        mmsghdr messages[CAN_MAX_BATCH_SIZE];
+        iovec buffers[CAN_MAX_BATCH_SIZE];
+        TimestampControl controls[CAN_MAX_BATCH_SIZE];
+
+        for (size_t i = 0; i < frameCount; i++) {
+            buffers[i] = { &frames[i], sizeof(can_frame) };
+            memset(&messages[i], 0, sizeof(mmsghdr));
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+
+            if (confirmations) {
+                messages[i].msg_hdr.msg_control = controls[i].buffer;
+                messages[i].msg_hdr.msg_controllen = sizeof(controls[i].buffer);
+            }
+        }
+
+        const auto framesRead = recvmmsg(_socketFd, messages, static_cast<uint32_t>(frameCount), MSG_DONTWAIT, nullptr);
+
+        if (framesRead < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) { return 0; }
+            throw CanException(formatString("FAILED to read from CAN! Error: %d => %s", errno, strerror(errno)), _socketFd);
+        }
+
+        if (!confirmations) { return static_cast<size_t>(framesRead); }
+
+        // Remove our own echoed frames from the batch
+        size_t receivedFrames = 0;
+        for (size_t i = 0; i < static_cast<size_t>(framesRead); i++) {
+            if (messages[i].msg_hdr.msg_flags & MSG_CONFIRM) {
+                confirmTransmission(frames[i], messages[i].msg_hdr);
+                continue;
+            }
+
+            if (receivedFrames != i) { frames[receivedFrames] = frames[i]; }
+            receivedFrames++;
+        }
+
+        return receivedFrames;
+    }
+
+    /**
+     * @brief Sends multiple raw frames using a single system call.
+     *
+     * Frames are sent as-is; no ID or length validation is performed.
+     * If the interface's transmit queue fills up, fewer frames than requested are sent.
+     *
+     * @param frames The frames to send.
+     * @param frameCount The amount of frames to send. At most CAN_MAX_BATCH_SIZE frames are sent per call.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t CanDriver::sendFrames(const can_frame* frames, const size_t frameCount) {
+        if (_socketFd < 0) { throw InvalidSocketException("Invalid socket!", _socketFd); }
+
+        unique_lock<mutex> locky(_lockSend);
+
+        const auto batchSize = frameCount < CAN_MAX_BATCH_SIZE ? frameCount : CAN_MAX_BATCH_SIZE;
+        mmsghdr messages[CAN_MAX_BATCH_SIZE];
+        iovec buffers[CAN_MAX_BATCH_SIZE];
+
+        for (size_t i = 0; i < batchSize; i++) {
+            buffers[i] = { const_cast<can_frame*>(&frames[i]), sizeof(can_frame) };
+            memset(&messages[i], 0, sizeof(mmsghdr));
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto framesSent = sendmmsg(_socketFd, messages, static_cast<uint32_t>(batchSize), MSG_DONTWAIT);
+
+        if (framesSent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS || errno == EINTR) { return 0; }
+            throw CanException(formatString("FAILED to write data to socket! Error: %d => %s", errno, strerror(errno)), _socketFd);
+        }
+
+        return static_cast<size_t>(framesSent);
+    }
+
     /**
      * @brief Attempts to set the filter mask for the associated CAN bus.
      *
@@ -245,22 +424,104 @@ namespace sockcanpp {
         if (_socketFd < 0) { throw InvalidSocketException("Invalid socket!", _socketFd); }
 
         unique_lock<mutex> locky(_lock);
-        vector<can_filter> canFilters{};
 
-        // Structured bindings only available with C++17
-        #if __cplusplus >= 201703L
-        for (const auto [id, filter] : filters) {
-            canFilters.push_back({id, filter});
+        _transport->setFilters(_socketFd, toCanFilters(filters));
+    }
+#pragma endregion
+
+#pragma region "TX Confirmation"
+    /**
+     * @brief Enables or disables confirmation of transmitted frames.
+     *
+     * While enabled, the socket receives its own frames once the interface has transmitted them
+     * (CAN_RAW_RECV_OWN_MSGS). These echoes complete the futures returned by @ref sendMessageConfirmed()
+     * and are never returned by the read functions, so frames must still be read for confirmations to arrive.
+     *
+     * Disabling confirmation fails all pending confirmations.
+     *
+     * @param enabled Whether or not to confirm transmitted frames.
+     *
+     * @return CanDriver& This instance.
+     */
+    CanDriver& CanDriver::setTxConfirmation(const bool enabled) {
+        if (_socketFd < 0) { throw InvalidSocketException("Invalid socket!", _socketFd); }
+
+        _transport->setReceiveOwnMessages(_socketFd, enabled);
+
+        _txConfirmation = enabled;
+
+        if (!enabled) {
+            deque<PendingConfirmation> abandoned{};
+            {
+                unique_lock<mutex> locky(_lockConfirm);
+                abandoned.swap(_pendingConfirmations);
+            }
+
+            for (auto& pending : abandoned) {
+                pending.confirmation.set_exception(make_exception_ptr(CanException("TX confirmation was disabled before the frame was confirmed!", _socketFd)));
+            }
         }
-        #else
-        for (const auto& filterPair : filters) {
-            canFilters.push_back({filterPair.first, filterPair.second});
+
+        return *this;
+    }
+
+    /**
+     * @brief Sends a message and tracks its transmission on the bus.
+     *
+     * Requires TX confirmation to be enabled. The returned future completes once the interface reports the
+     * frame as transmitted, which happens while received frames are being read.
+     *
+     * @param message The message to be sent.
+     * @param forceExtended Whether or not to force use of an extended ID.
+     *
+     * @return future<CanTxConfirmation> Resolves once the frame is on the bus.
+     */
+    future<CanTxConfirmation> CanDriver::sendMessageConfirmed(const CanMessage& message, bool forceExtended) {
+        if (!_txConfirmation) { throw CanException("TX confirmation is not enabled!", _socketFd); }
+
+        auto canFrame = message.getRawFrame();
+        if (forceExtended || ((uint32_t)message.getCanId() > CAN_SFF_MASK)) { canFrame.can_id |= CAN_EFF_FLAG; }
+
+        future<CanTxConfirmation> confirmation{};
+        uint64_t sequence = 0;
+
+        // Registered before sending; the echo may arrive before write() returns
+        {
+            unique_lock<mutex> locky(_lockConfirm);
+
+            _pendingConfirmations.emplace_back();
+            auto& pending = _pendingConfirmations.back();
+            pending.sequence = sequence = _nextConfirmation++;
+            pending.frame = canFrame;
+            pending.sent = system_clock::now();
+            confirmation = pending.confirmation.get_future();
         }
-        #endif
 
-        if (setsockopt(_socketFd, SOL_CAN_RAW, CAN_RAW_FILTER, canFilters.data(), canFilters.size() * sizeof(can_filter)) == -1) {
-            throw CanInitException(formatString("FAILED to set CAN filters on socket %d! Error: %d => %s", _socketFd, errno, strerror(errno)));
+        try {
+            sendMessage(message, forceExtended);
+        } catch (...) {
+            unique_lock<mutex> locky(_lockConfirm);
+
+            for (auto pending = _pendingConfirmations.begin(); pending != _pendingConfirmations.end(); ++pending) {
+                if (pending->sequence != sequence) { continue; }
+
+                _pendingConfirmations.erase(pending);
+                break;
+            }
+
+            throw;
         }
+
+        return confirmation;
+    }
+
+    /**
+     * @brief Gets the amount of frames sent with @ref sendMessageConfirmed() which haven't been confirmed yet.
+     */
+    size_t CanDriver::getPendingConfirmationCount() const {
+        unique_lock<mutex> locky(_lockConfirm);
+
+        return _pendingConfirmations.size();
     }
 #pragma endregion
 
@@ -274,55 +535,112 @@ namespace sockcanpp {
      * @brief Initialises the underlying CAN socket.
      */
     void CanDriver::initialiseSocketCan() {
-        // unique_lock<mutex> locky(_lock);
+        if (!_transport) { _transport = CanSocketTransport::getDefault(); }
+
+        _socketFd = _transport->openSocket(_canInterface, _canProtocol, toCanFilters(_canFilterMask));
+    }
 
-        struct sockaddr_can address;
-        struct ifreq ifaceRequest;
-        int64_t fdOptions = 0;
-        int32_t tmpReturn;
+    /**
+     * @brief Closes the underlying CAN socket.
+     */
+    void CanDriver::uninitialiseSocketCan() {
+        unique_lock<mutex> locky(_lock);
 
-        memset(&address, 0, sizeof(struct sockaddr_can));
-        memset(&ifaceRequest, 0, sizeof(struct ifreq));
+        if (_socketFd <= 0) { throw CanCloseException("Cannot close invalid socket!"); }
 
-        _socketFd = socket(PF_CAN, SOCK_RAW, _canProtocol);
+        const auto socketFd = _socketFd;
+        _socketFd = -1;
 
-        if (_socketFd == -1) {
-            throw CanInitException(formatString("FAILED to initialise socketcan! Error: %d => %s", errno, strerror(errno)));
-        }
+        _transport->closeSocket(socketFd);
+    }
 
-        strcpy(ifaceRequest.ifr_name, _canInterface.c_str());
+    /**
+     * @brief Receives a single message from the socket, including its flags and ancillary data.
+     *
+     * @param message Describes the buffers to receive into; msg_flags receives e.g. MSG_CONFIRM for echoed frames.
+     *
+     * @return ssize_t The amount of bytes received, or -1 with errno set.
+     */
+    ssize_t CanDriver::receiveMessage(msghdr& message) { return recvmsg(_socketFd, &message, 0); }
+#pragma endregion
 
-        if ((tmpReturn = ioctl(_socketFd, SIOCGIFINDEX, &ifaceRequest)) == -1) {
-            throw CanInitException(formatString("FAILED to perform IO control operation on socket %s! Error: %d => %s", _canInterface.c_str(), errno,
-                                    strerror(errno)));
-        }
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Reads a single frame. Echoed TX confirmations are consumed and skipped.
+     *
+     * @param frame Receives the frame.
+     *
+     * @return true If a frame was read.
+     * @return false If no frame is available (errno is set to EAGAIN).
+     */
+    bool CanDriver::receiveFrame(can_frame& frame) {
+        while (true) {
+            iovec buffer{ &frame, sizeof(can_frame) };
+            TimestampControl control;
 
-        fdOptions = fcntl(_socketFd, F_GETFL);
-        fdOptions |= O_NONBLOCK;
-        tmpReturn = fcntl(_socketFd, F_SETFL, fdOptions);
+            msghdr message{};
+            message.msg_iov = &buffer;
+            message.msg_iovlen = 1;
+            message.msg_control = control.buffer;
+            message.msg_controllen = sizeof(control.buffer);
 
-        address.can_family = AF_CAN;
-        address.can_ifindex = ifaceRequest.ifr_ifindex;
+            if (receiveMessage(message) < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) { return false; }
+                throw CanException(formatString("FAILED to read from CAN! Error: %d => %s", errno, strerror(errno)), _socketFd);
+            }
 
-        setCanFilters(_canFilterMask);
+            if (!(message.msg_flags & MSG_CONFIRM)) { return true; }
 
-        if ((tmpReturn = bind(_socketFd, (struct sockaddr*)&address, sizeof(address))) == -1) {
-            throw CanInitException(formatString("FAILED to bind to socket CAN! Error: %d => %s", errno, strerror(errno)));
+            confirmTransmission(frame, message);
         }
     }
 
     /**
-     * @brief Closes the underlying CAN socket.
+     * @brief Completes the oldest pending send whose frame matches an echoed frame.
+     *
+     * Echoes of frames sent without confirmation are ignored.
+     *
+     * @param frame The echoed frame.
+     * @param message The message the frame was received with; carries the kernel timestamp, if enabled.
      */
-    void CanDriver::uninitialiseSocketCan() {
-        unique_lock<mutex> locky(_lock);
+    void CanDriver::confirmTransmission(const can_frame& frame, const msghdr& message) {
+        auto confirmed = system_clock::now();
 
-        if (_socketFd <= 0) { throw CanCloseException("Cannot close invalid socket!"); }
+        for (auto header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(const_cast<msghdr*>(&message), header)) {
+            if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_TIMESTAMPNS) { continue; }
 
-        if (close(_socketFd) == -1) { throw CanCloseException(formatString("FAILED to close CAN socket! Error: %d => %s", errno, strerror(errno))); }
+            timespec timestamp{};
+            memcpy(&timestamp, CMSG_DATA(header), sizeof(timestamp));
+            confirmed = system_clock::time_point(duration_cast<system_clock::duration>(seconds(timestamp.tv_sec) + nanoseconds(timestamp.tv_nsec)));
+        }
 
-        _socketFd = -1;
+        PendingConfirmation completed{};
+        {
+            unique_lock<mutex> locky(_lockConfirm);
+
+            // Interfaces with several TX buffers may confirm frames out of order, so match by content rather than position
+            auto pending = _pendingConfirmations.begin();
+            for (; pending != _pendingConfirmations.end(); ++pending) {
+                const auto length = frame.can_dlc < CAN_MAX_DLEN ? frame.can_dlc : CAN_MAX_DLEN;
+                if (pending->frame.can_id == frame.can_id && pending->frame.can_dlc == frame.can_dlc && memcmp(pending->frame.data, frame.data, length) == 0) { break; }
+            }
+
+            if (pending == _pendingConfirmations.end()) { return; }
+
+            completed = std::move(*pending);
+            _pendingConfirmations.erase(pending);
+        }
+
+        CanTxConfirmation confirmation{};
+        confirmation.frame = completed.frame;
+        confirmation.sent = completed.sent;
+        confirmation.confirmed = confirmed;
+
+        _txLatency.record(confirmation.latency());
+        completed.confirmation.set_value(confirmation);
     }
-#pragma endregion
 
 } // namespace sockcanpp
@@ -0,0 +1,318 @@
+/**
+ * @file CanFlightRecorder.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the pre-trigger flight recorder.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanFlightRecorder.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::memory_order_seq_cst;
+    using std::unique_lock;
+    using std::chrono::duration_cast;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new flight recorder and starts its snapshot thread.
+     *
+     * @param handler Receives each snapshot on the background thread.
+     * @param capacity The amount of frames held by each region. Rounded up to the next power of two.
+     * @param preTrigger How much of the traffic before a trigger a snapshot contains, at most.
+     * @param regionCount The amount of regions; one records while the others hold snapshots being handled.
+     */
+    CanFlightRecorder::CanFlightRecorder(const snapshothandler_t& handler, const size_t capacity, const nanoseconds preTrigger, const size_t regionCount):
+        _handler(handler), _preTrigger(preTrigger) {
+        if (regionCount < 2) { throw CanInitException("A flight recorder requires at least two regions!"); }
+
+        uint64_t recordCount = 2;
+        while (recordCount < capacity) { recordCount <<= 1; }
+        _mask = recordCount - 1;
+
+        for (uint32_t i = 0; i < regionCount; i++) {
+            _regions.emplace_back(new Region());
+            _regions.back()->records.resize(recordCount);
+            if (i) { _spareRegions.push_back(i); }
+        }
+
+        _writer = thread(&CanFlightRecorder::writerLoop, this);
+    }
+
+    /**
+     * @brief Handles all pending snapshots and stops the snapshot thread.
+     */
+    CanFlightRecorder::~CanFlightRecorder() {
+        {
+            unique_lock<mutex> locky(_lock);
+            _stopping = true;
+        }
+
+        _snapshotsChanged.notify_all();
+        if (_writer.joinable()) { _writer.join(); }
+    }
+#pragma endregion
+
+#pragma region "Configuration"
+    /**
+     * @brief Adds a frame pattern which triggers a snapshot. Must not be called while frames are recorded.
+     *
+     * @param pattern The pattern to match.
+     */
+    void CanFlightRecorder::addTrigger(const CanFlightPattern& pattern) { _patterns.push_back(pattern); }
+#pragma endregion
+
+#pragma region "Recording"
+    /**
+     * @brief Records a classic frame and checks it against the triggers.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received.
+     * @param flags Additional CanRecordFlags.
+     *
+     * @return true If the frame triggered a snapshot.
+     * @return false Otherwise.
+     */
+    bool CanFlightRecorder::record(const can_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        return append(frame.can_id, frame.data, std::min<uint8_t>(frame.can_dlc, CAN_MAX_DLEN), flags & ~CAN_RECORD_FD, ifindex, timestamp);
+    }
+
+    /**
+     * @brief Records an FD frame and checks it against the triggers.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received.
+     * @param flags Additional CanRecordFlags; CAN_RECORD_FD is always set.
+     *
+     * @return true If the frame triggered a snapshot.
+     * @return false Otherwise.
+     */
+    bool CanFlightRecorder::record(const canfd_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        return append(frame.can_id, frame.data, std::min<uint8_t>(frame.len, CANFD_MAX_DLEN), canRecordFdFlags(frame, flags), ifindex, timestamp);
+    }
+
+    /**
+     * @brief Waits for frames on a driver and records all of them.
+     *
+     * @param driver The driver to read from.
+     * @param ifindex The index of the driver's interface.
+     * @param timeout The maximum time to wait for frames.
+     *
+     * @return size_t The amount of frames read.
+     */
+    size_t CanFlightRecorder::receiveFrom(CanDriver& driver, const int32_t ifindex, const milliseconds timeout) {
+        if (!driver.waitForMessages(timeout)) { return 0; }
+
+        return readCanRecordBatches(driver, [&](const can_frame& frame, const system_clock::time_point timestamp) { record(frame, ifindex, timestamp); });
+    }
+
+    /**
+     * @brief Freezes a snapshot of the traffic up to now.
+     *
+     * @return true If a snapshot was taken.
+     * @return false If no spare region was available; the trigger is counted as missed.
+     */
+    bool CanFlightRecorder::trigger() { return freeze(CanFlightTriggerReason::Manual, system_clock::now()); }
+
+    /**
+     * @brief Waits until the handler has been invoked for every snapshot triggered so far.
+     */
+    void CanFlightRecorder::waitForSnapshots() {
+        unique_lock<mutex> locky(_lock);
+
+        _snapshotsChanged.wait(locky, [this]() { return _pending.empty() && !_handling; });
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the recorder's statistics.
+     */
+    CanFlightRecorderStatistics CanFlightRecorder::getStatistics() const {
+        CanFlightRecorderStatistics statistics{};
+        statistics.recorded = _recorded.load(memory_order_relaxed);
+        statistics.triggers = _triggers.load(memory_order_relaxed);
+        statistics.missedTriggers = _missedTriggers.load(memory_order_relaxed);
+
+        return statistics;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Writes a frame into the active region, then checks the triggers.
+     */
+    bool CanFlightRecorder::append(const canid_t id, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp) {
+        while (true) {
+            const auto index = _activeRegion.load(memory_order_seq_cst);
+            auto& region = *_regions[index];
+
+            // Announce the write, then make sure the region wasn't swapped out in the meantime
+            region.writing.store(true, memory_order_seq_cst);
+            if (_activeRegion.load(memory_order_seq_cst) != index) {
+                region.writing.store(false, memory_order_release);
+                continue;
+            }
+
+            const auto head = region.head.load(memory_order_relaxed);
+            auto& record = region.records[head & _mask];
+            record.timestamp = duration_cast<nanoseconds>(timestamp.time_since_epoch()).count();
+            record.canId = id;
+            record.ifindex = ifindex;
+            record.length = length;
+            record.flags = flags;
+            memcpy(record.data, data, length);
+            memset(record.data + length, 0, CANFD_MAX_DLEN - length); // slots are reused; don't leak older, longer payloads
+
+            region.head.store(head + 1, memory_order_release);
+            region.writing.store(false, memory_order_release);
+            break;
+        }
+
+        _recorded.fetch_add(1, memory_order_relaxed);
+
+        if (_errorFrameTrigger && (id & CAN_ERR_FLAG)) { return freeze(CanFlightTriggerReason::ErrorFrame, timestamp); }
+
+        for (const auto& pattern : _patterns) {
+            if ((id & pattern.mask) != (pattern.id & pattern.mask)) { continue; }
+
+            bool matches = true;
+            for (size_t i = 0; i < CAN_MAX_DLEN && matches; i++) {
+                const auto value = i < length ? data[i] : uint8_t(0);
+                matches = (value & pattern.dataMask[i]) == (pattern.data[i] & pattern.dataMask[i]);
+            }
+
+            if (matches) { return freeze(CanFlightTriggerReason::Pattern, timestamp); }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Swaps a spare region in and queues the previously active region for the snapshot thread.
+     */
+    bool CanFlightRecorder::freeze(const CanFlightTriggerReason reason, const system_clock::time_point triggered) {
+        {
+            unique_lock<mutex> locky(_lock);
+
+            if (_spareRegions.empty()) {
+                _missedTriggers.fetch_add(1, memory_order_relaxed);
+                return false;
+            }
+
+            const auto spare = _spareRegions.back();
+            _spareRegions.pop_back();
+
+            const auto frozen = _activeRegion.exchange(spare, memory_order_seq_cst);
+
+            // A write which started before the swap may still be in progress; it's a matter of nanoseconds
+            while (_regions[frozen]->writing.load(memory_order_seq_cst)) { std::this_thread::yield(); }
+
+            Pending pending{};
+            pending.region = frozen;
+            pending.triggered = triggered;
+            pending.reason = reason;
+            _pending.push_back(pending);
+        }
+
+        _triggers.fetch_add(1, memory_order_relaxed);
+        _snapshotsChanged.notify_all();
+
+        return true;
+    }
+
+    /**
+     * @brief Extracts the pre-trigger window of each frozen region and passes it to the handler.
+     */
+    void CanFlightRecorder::writerLoop() {
+        while (true) {
+            Pending pending{};
+
+            {
+                unique_lock<mutex> locky(_lock);
+                _snapshotsChanged.wait(locky, [this]() { return _stopping || !_pending.empty(); });
+
+                if (_pending.empty()) { break; }
+
+                pending = _pending.front();
+                _pending.pop_front();
+                _handling++;
+            }
+
+            auto& region = *_regions[pending.region];
+            const auto head = region.head.load(memory_order_acquire);
+            const auto count = std::min<uint64_t>(head, _mask + 1);
+            const auto windowStart = duration_cast<nanoseconds>(pending.triggered.time_since_epoch() - _preTrigger).count();
+
+            CanFlightSnapshot snapshot{};
+            snapshot.triggered = pending.triggered;
+            snapshot.reason = pending.reason;
+            snapshot.records.reserve(static_cast<size_t>(count));
+
+            for (auto position = head - count; position < head; position++) {
+                const auto& record = region.records[position & _mask];
+                if (record.timestamp >= windowStart) { snapshot.records.push_back(record); }
+            }
+
+            if (_handler) { _handler(snapshot); }
+
+            region.head.store(0, memory_order_relaxed);
+
+            {
+                unique_lock<mutex> locky(_lock);
+                _spareRegions.push_back(pending.region);
+                _handling--;
+            }
+
+            _snapshotsChanged.notify_all();
+        }
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,525 @@
+/**
+ * @file CanFrameTiming.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the frame length calculator and the bus load meter.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanFrameTiming.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::chrono::duration_cast;
+
+    constexpr uint32_t CanFrameTiming::INTERFRAME_BITS;
+    constexpr size_t CanBusLoadMeter::BUCKET_COUNT;
+
+    namespace {
+
+        constexpr uint32_t CRC15_POLYNOMIAL = 0x4599;
+        constexpr uint32_t TRAILER_BITS = 10;       //!< CRC delimiter, ACK slot, ACK delimiter and end of frame; never stuffed
+        constexpr uint8_t  INITIAL_STATE = 8;       //!< No bits sent yet
+        constexpr uint8_t  STATE_MASK = 0x0F;
+        constexpr uint8_t  STUFF_SHIFT = 4;
+        constexpr uint8_t  LAST_BIT_STUFFED = 0x80; //!< The last bit of the chunk completed a run and was followed by a stuff bit
+
+        const uint8_t FD_LENGTHS[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+
+        /**
+         * @brief Advances the stuffing state by a single bit.
+         *
+         * States 0-7 hold the level of the last bit (bit 2) and the length of the current run minus one (bits 0-1);
+         * a run never reaches five bits, as the fifth bit is followed by a stuff bit of the opposite level.
+         *
+         * @return uint8_t The new state, with LAST_BIT_STUFFED set if a stuff bit follows the bit.
+         */
+        uint8_t stuffBit(const uint8_t state, const uint32_t bit) {
+            if (state == INITIAL_STATE || (state >> 2) != bit) { return static_cast<uint8_t>(bit << 2); }
+
+            const auto run = (state & 3) + 2;
+            if (run == 5) { return static_cast<uint8_t>(((bit ^ 1) << 2) | LAST_BIT_STUFFED); }
+
+            return static_cast<uint8_t>((bit << 2) | (run - 1));
+        }
+
+        /**
+         * @brief Lookup tables processing eight bits at a time.
+         */
+        struct Tables {
+            Tables() {
+                for (uint32_t value = 0; value < 256; value++) {
+                    uint32_t crc = value << 7;
+                    for (uint32_t bit = 0; bit < 8; bit++) { crc = (crc & 0x4000) ? ((crc << 1) ^ CRC15_POLYNOMIAL) : (crc << 1); }
+                    crc15[value] = static_cast<uint16_t>(crc & 0x7FFF);
+
+                    for (uint8_t state = 0; state <= INITIAL_STATE; state++) {
+                        uint8_t current = state;
+                        uint32_t stuffBits = 0;
+                        bool lastStuffed = false;
+
+                        for (uint32_t bit = 8; bit > 0; bit--) {
+                            current = stuffBit(current, (value >> (bit - 1)) & 1);
+                            lastStuffed = (current & LAST_BIT_STUFFED) != 0;
+                            if (lastStuffed) { stuffBits++; }
+                            current &= STATE_MASK;
+                        }
+
+                        stuffing[state][value] = static_cast<uint8_t>(current | (stuffBits << STUFF_SHIFT) | (lastStuffed ? LAST_BIT_STUFFED : 0));
+                    }
+                }
+            }
+
+            uint16_t    crc15[256];
+            uint8_t     stuffing[INITIAL_STATE + 1][256];   //!< Next state, stuff bits inserted and LAST_BIT_STUFFED
+        };
+
+        const Tables& tables() {
+            static const Tables instance{};
+
+            return instance;
+        }
+
+        /**
+         * @brief Feeds the dynamically stuffed part of a frame, counting its bits and stuff bits and computing the CRC-15.
+         */
+        struct Encoder {
+            explicit Encoder(const bool computeCrc): lookup(tables()), crcEnabled(computeCrc) { }
+
+            /**
+             * @brief Feeds the lowest width bits of value, most significant bit first.
+             */
+            void push(const uint64_t value, uint32_t width) {
+                while (width >= 8) {
+                    width -= 8;
+                    pushByte(static_cast<uint8_t>(value >> width));
+                }
+
+                while (width > 0) {
+                    width--;
+                    pushBit(static_cast<uint32_t>(value >> width) & 1);
+                }
+            }
+
+            void pushBytes(const uint8_t* data, const size_t length) {
+                for (size_t i = 0; i < length; i++) { pushByte(data[i]); }
+            }
+
+            void pushByte(const uint8_t byte) {
+                const auto entry = lookup.stuffing[state][byte];
+
+                state = entry & STATE_MASK;
+                stuffBits += (entry >> STUFF_SHIFT) & 0x07;
+                lastStuffed = (entry & LAST_BIT_STUFFED) != 0;
+                bits += 8;
+
+                if (crcEnabled) { crc = static_cast<uint16_t>(((crc << 8) ^ lookup.crc15[((crc >> 7) ^ byte) & 0xFF]) & 0x7FFF); }
+            }
+
+            void pushBit(const uint32_t bit) {
+                const auto next = stuffBit(state, bit);
+
+                state = next & STATE_MASK;
+                lastStuffed = (next & LAST_BIT_STUFFED) != 0;
+                if (lastStuffed) { stuffBits++; }
+                bits++;
+
+                if (crcEnabled) {
+                    const auto feedback = bit != ((crc >> 14) & 1u);
+                    crc = static_cast<uint16_t>((crc << 1) & 0x7FFF);
+                    if (feedback) { crc ^= CRC15_POLYNOMIAL; }
+                }
+            }
+
+            const Tables& lookup;
+            bool        crcEnabled{false};
+            uint8_t     state{INITIAL_STATE};
+            bool        lastStuffed{false};
+            uint32_t    bits{0};
+            uint32_t    stuffBits{0};
+            uint16_t    crc{0};
+        };
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Frame Timing"
+    /**
+     * @brief Computes the exact length of a frame on the wire.
+     *
+     * For classic frames, the DLC sent is length (up to 15) and at most eight bytes are sent; remote frames carry no data.
+     * FD payloads are padded with zeroes to the next valid FD length.
+     *
+     * @param id The ID, including CAN_EFF_FLAG and CAN_RTR_FLAG.
+     * @param data The payload; may be nullptr for remote frames or if length is 0.
+     * @param length The amount of payload bytes.
+     * @param fd Whether or not the frame is an FD frame.
+     * @param fdFlags CANFD_BRS and CANFD_ESI, for FD frames.
+     *
+     * @return CanFrameBits The frame's length.
+     */
+    CanFrameBits CanFrameTiming::frameBits(const canid_t id, const uint8_t* data, const uint8_t length, const bool fd, const uint8_t fdFlags) {
+        const auto extended = (id & CAN_EFF_FLAG) != 0;
+        Encoder encoder(!fd);
+        CanFrameBits result{};
+
+        encoder.pushBit(0); // start of frame
+
+        if (extended) {
+            const auto extendedId = id & CAN_EFF_MASK;
+            encoder.push(extendedId >> 18, 11);
+            encoder.push(3, 2);                     // SRR, IDE
+            encoder.push(extendedId & 0x3FFFF, 18);
+        } else {
+            encoder.push(id & CAN_SFF_MASK, 11);
+        }
+
+        if (!fd) {
+            const auto remote = (id & CAN_RTR_FLAG) != 0;
+
+            encoder.pushBit(remote ? 1 : 0);
+            encoder.push(0, 2);                     // IDE, r0 or r1, r0
+            encoder.push(std::min<uint8_t>(length, 15), 4);
+            if (!remote && data) { encoder.pushBytes(data, std::min<uint8_t>(length, CAN_MAX_DLEN)); }
+
+            const auto crc = encoder.crc;
+            encoder.push(crc, 15);
+
+            result.bits = encoder.bits + encoder.stuffBits + TRAILER_BITS;
+            result.stuffBits = encoder.stuffBits;
+
+            return result;
+        }
+
+        const auto dlc = fdLengthToDlc(length);
+        const auto paddedLength = fdDlcToLength(dlc);
+        const auto bitrateSwitch = (fdFlags & CANFD_BRS) != 0;
+
+        if (extended) {
+            encoder.push(0x1, 2);                   // RRS, FDF
+        } else {
+            encoder.push(0x1, 3);                   // RRS, IDE, FDF
+        }
+
+        encoder.pushBit(0);                         // res
+        encoder.pushBit(bitrateSwitch ? 1 : 0);
+
+        const auto nominalBits = encoder.bits + encoder.stuffBits;
+
+        encoder.pushBit((fdFlags & CANFD_ESI) ? 1 : 0);
+        encoder.push(dlc, 4);
+
+        const auto copied = std::min(length, paddedLength);
+        if (data) { encoder.pushBytes(data, copied); }
+        for (auto i = data ? copied : uint8_t(0); i < paddedLength; i++) { encoder.pushByte(0); }
+
+        // The fixed stuff bit preceding the stuff count replaces a dynamic stuff bit after the last data bit
+        const auto dynamicStuffBits = encoder.stuffBits - (encoder.lastStuffed ? 1 : 0);
+        const uint32_t crcBits = paddedLength > 16 ? 21 : 17;
+        const auto fixedStuffBits = (4 + crcBits + 3) / 4;      // one before the stuff count, then one every four bits
+
+        result.stuffBits = dynamicStuffBits + fixedStuffBits;
+        result.bits = encoder.bits + result.stuffBits + 4 + crcBits + TRAILER_BITS;
+        result.dataPhaseBits = bitrateSwitch ? result.bits - nominalBits - TRAILER_BITS : 0;
+
+        return result;
+    }
+
+    /**
+     * @brief Computes the exact length of a classic frame on the wire.
+     *
+     * @param frame The frame. A DLC of 9-15 is taken from len8_dlc where supported.
+     *
+     * @return CanFrameBits The frame's length.
+     */
+    CanFrameBits CanFrameTiming::frameBits(const can_frame& frame) {
+        auto dlc = frame.can_dlc;
+
+        #ifdef CAN_MAX_RAW_DLC
+        if (dlc == CAN_MAX_DLEN && frame.len8_dlc > CAN_MAX_DLEN && frame.len8_dlc <= CAN_MAX_RAW_DLC) { dlc = frame.len8_dlc; }
+        #endif
+
+        return frameBits(frame.can_id, frame.data, dlc, false);
+    }
+
+    /**
+     * @brief Computes the exact length of an FD frame on the wire.
+     *
+     * @param frame The frame; CANFD_BRS and CANFD_ESI are taken from its flags.
+     *
+     * @return CanFrameBits The frame's length.
+     */
+    CanFrameBits CanFrameTiming::frameBits(const canfd_frame& frame) { return frameBits(frame.can_id, frame.data, frame.len, true, frame.flags); }
+
+    /**
+     * @brief Computes the exact length of a message sent as a classic frame.
+     *
+     * @param message The message.
+     *
+     * @return CanFrameBits The frame's length.
+     */
+    CanFrameBits CanFrameTiming::frameBits(const CanMessage& message) {
+        auto frame = message.getRawFrame();
+
+        if (*message.getCanId() > CAN_SFF_MASK) { frame.can_id |= CAN_EFF_FLAG; }
+
+        return frameBits(frame);
+    }
+
+    /**
+     * @brief Gets the longest a classic frame with the given payload length can be on the wire.
+     *
+     * Uses the bound of Davis et al. for the worst-case stuffing of a frame: the stuffed part of the frame
+     * (g bits of header and CRC plus the payload) contains at most one stuff bit per four bits after the first.
+     *
+     * @param extended Whether or not the frame has an extended ID.
+     * @param length The amount of payload bytes, up to eight.
+     *
+     * @return uint32_t The length in bits, including stuff bits; excluding the interframe space.
+     */
+    uint32_t CanFrameTiming::worstCaseFrameBits(const bool extended, const uint8_t length) {
+        const uint32_t stuffedBits = (extended ? 54 : 34) + 8 * std::min<uint32_t>(length, CAN_MAX_DLEN);
+
+        return stuffedBits + TRAILER_BITS + (stuffedBits - 1) / 4;
+    }
+
+    /**
+     * @brief Computes the time a frame and the following interframe space occupy the bus.
+     *
+     * The bitrate switches at the BRS bit and back before the CRC delimiter.
+     *
+     * @param bits The frame's length.
+     * @param bitrate The nominal bitrate, in bits per second.
+     * @param dataBitrate The data bitrate of FD frames with BRS; 0 uses the nominal bitrate.
+     *
+     * @return nanoseconds The time the frame occupies the bus.
+     */
+    nanoseconds CanFrameTiming::frameTime(const CanFrameBits& bits, const uint32_t bitrate, const uint32_t dataBitrate) {
+        if (!bitrate) { throw CanException("The bitrate must be greater than zero!", -1); }
+
+        const uint64_t nominalBits = bits.bits - bits.dataPhaseBits + INTERFRAME_BITS;
+        const uint64_t picoseconds = nominalBits * 1000000000000ull / bitrate + uint64_t(bits.dataPhaseBits) * 1000000000000ull / (dataBitrate ? dataBitrate : bitrate);
+
+        return nanoseconds(static_cast<int64_t>(picoseconds / 1000));
+    }
+
+    /**
+     * @brief Builds the arbitration field as it appears on the wire; the lower value wins arbitration.
+     *
+     * Layout: base ID (11 bits), RTR or SRR, IDE, extended ID (18 bits), RTR of extended frames.
+     *
+     * @param id The ID, including CAN_EFF_FLAG and CAN_RTR_FLAG.
+     *
+     * @return uint64_t The arbitration key.
+     */
+    uint64_t CanFrameTiming::arbitrationKey(const canid_t id) {
+        const uint64_t remote = (id & CAN_RTR_FLAG) ? 1 : 0;
+
+        if (!(id & CAN_EFF_FLAG)) { return (static_cast<uint64_t>(id & CAN_SFF_MASK) << 21) | (remote << 20); }
+
+        const auto extendedId = id & CAN_EFF_MASK;
+
+        return (static_cast<uint64_t>(extendedId >> 18) << 21) | (uint64_t(1) << 20) | (uint64_t(1) << 19) | (static_cast<uint64_t>(extendedId & 0x3FFFF) << 1) | remote;
+    }
+
+    /**
+     * @brief Gets the DLC of the shortest FD payload which can hold the given amount of bytes.
+     */
+    uint8_t CanFrameTiming::fdLengthToDlc(const uint8_t length) {
+        if (length <= CAN_MAX_DLEN) { return length; }
+
+        uint8_t dlc = 9;
+        while (dlc < 15 && FD_LENGTHS[dlc] < length) { dlc++; }
+
+        return dlc;
+    }
+
+    /**
+     * @brief Gets the payload length of an FD DLC.
+     */
+    uint8_t CanFrameTiming::fdDlcToLength(const uint8_t dlc) { return FD_LENGTHS[dlc & 0x0F]; }
+#pragma endregion
+
+#pragma region "Bus Load"
+    /**
+     * @brief Constructs a new bus load meter.
+     *
+     * @param bitrate The nominal bitrate, in bits per second.
+     * @param dataBitrate The data bitrate of FD frames with BRS; 0 uses the nominal bitrate.
+     * @param window The duration the load is averaged over.
+     * @param clock The clock used by the overloads without a time point.
+     */
+    CanBusLoadMeter::CanBusLoadMeter(const uint32_t bitrate, const uint32_t dataBitrate, const nanoseconds window, const shared_ptr<CanClock>& clock):
+        _clock(clock ? clock : CanSteadyClock::getDefault()) {
+        if (!bitrate) { throw CanException("The bitrate must be greater than zero!", -1); }
+        if (window.count() < static_cast<int64_t>(BUCKET_COUNT)) { throw CanException("The measurement window is too short!", -1); }
+
+        _bitPicoseconds = 1000000000000ull / bitrate;
+        _dataBitPicoseconds = 1000000000000ull / (dataBitrate ? dataBitrate : bitrate);
+        _bucketWidth = window.count() / static_cast<int64_t>(BUCKET_COUNT);
+
+        reset();
+    }
+
+#pragma region "Recording"
+    void CanBusLoadMeter::add(const can_frame& frame) { add(frame, _clock->now()); }
+
+    /**
+     * @brief Adds a received classic frame.
+     *
+     * @param frame The frame.
+     * @param received When the frame was received.
+     */
+    void CanBusLoadMeter::add(const can_frame& frame, const steady_clock::time_point received) {
+        const auto bits = CanFrameTiming::frameBits(frame);
+
+        addBusy((bits.bits + CanFrameTiming::INTERFRAME_BITS) * _bitPicoseconds, received);
+    }
+
+    void CanBusLoadMeter::add(const canfd_frame& frame) { add(frame, _clock->now()); }
+
+    /**
+     * @brief Adds a received FD frame.
+     *
+     * @param frame The frame.
+     * @param received When the frame was received.
+     */
+    void CanBusLoadMeter::add(const canfd_frame& frame, const steady_clock::time_point received) {
+        const auto bits = CanFrameTiming::frameBits(frame);
+        const uint64_t nominalBits = bits.bits - bits.dataPhaseBits + CanFrameTiming::INTERFRAME_BITS;
+
+        addBusy(nominalBits * _bitPicoseconds + bits.dataPhaseBits * _dataBitPicoseconds, received);
+    }
+
+    void CanBusLoadMeter::add(const CanMessage& message) { add(message, _clock->now()); }
+
+    /**
+     * @brief Adds a received message.
+     *
+     * @param message The message.
+     * @param received When the message was received.
+     */
+    void CanBusLoadMeter::add(const CanMessage& message, const steady_clock::time_point received) {
+        const auto bits = CanFrameTiming::frameBits(message);
+
+        addBusy((bits.bits + CanFrameTiming::INTERFRAME_BITS) * _bitPicoseconds, received);
+    }
+
+    void CanBusLoadMeter::add(const can_frame* frames, const size_t frameCount) { add(frames, frameCount, _clock->now()); }
+
+    /**
+     * @brief Adds a batch of received classic frames, e.g. as returned by CanDriver::readFrames().
+     *
+     * @param frames The frames.
+     * @param frameCount The amount of frames.
+     * @param received When the frames were received.
+     */
+    void CanBusLoadMeter::add(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received) {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < frameCount; i++) { bits += CanFrameTiming::frameBits(frames[i]).bits + CanFrameTiming::INTERFRAME_BITS; }
+
+        addBusy(bits * _bitPicoseconds, received, frameCount);
+    }
+
+    /**
+     * @brief Forgets all frames added so far.
+     */
+    void CanBusLoadMeter::reset() {
+        _buckets.fill(0);
+        _bucketNumbers.fill(INT64_MIN);
+        _frames = 0;
+        _busyPicoseconds = 0;
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the bus load within the last window, as of the meter's clock's current time.
+     */
+    double CanBusLoadMeter::getLoad() const { return getLoad(_clock->now()); }
+
+    /**
+     * @brief Gets the bus load within the window ending at the given time.
+     *
+     * @param now The end of the window.
+     *
+     * @return double The fraction of the window the bus was busy, in the range [0, 1] for a consistent stream.
+     */
+    double CanBusLoadMeter::getLoad(const steady_clock::time_point now) const {
+        const auto time = duration_cast<nanoseconds>(now.time_since_epoch()).count();
+        const auto current = time >= 0 ? time / _bucketWidth : (time + 1) / _bucketWidth - 1;
+
+        uint64_t busy = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            if (_bucketNumbers[i] <= current && _bucketNumbers[i] > current - static_cast<int64_t>(BUCKET_COUNT)) { busy += _buckets[i]; }
+        }
+
+        // The current bucket has only been partially filled
+        const auto elapsed = static_cast<int64_t>(BUCKET_COUNT - 1) * _bucketWidth + (time - current * _bucketWidth);
+
+        return elapsed > 0 ? static_cast<double>(busy) / 1000.0 / static_cast<double>(elapsed) : 0;
+    }
+#pragma endregion
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Adds the time frames occupied the bus to the bucket covering their receive time.
+     */
+    void CanBusLoadMeter::addBusy(const uint64_t picoseconds, const steady_clock::time_point received, const size_t frameCount) {
+        const auto time = duration_cast<nanoseconds>(received.time_since_epoch()).count();
+        const auto number = time >= 0 ? time / _bucketWidth : (time + 1) / _bucketWidth - 1;
+        const auto slot = static_cast<size_t>(((number % static_cast<int64_t>(BUCKET_COUNT)) + static_cast<int64_t>(BUCKET_COUNT)) % static_cast<int64_t>(BUCKET_COUNT));
+
+        _frames += frameCount;
+        _busyPicoseconds += picoseconds;
+
+        if (_bucketNumbers[slot] > number) { return; } // Older than the window
+
+        if (_bucketNumbers[slot] != number) {
+            _bucketNumbers[slot] = number;
+            _buckets[slot] = 0;
+        }
+
+        _buckets[slot] += picoseconds;
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,432 @@
+/**
+ * @file CanGateway.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the kernel CAN gateway rule management.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+
+#include <linux/can.h>
+#include <linux/can/gw.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanGateway.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::mutex;
+    using std::string;
+    using std::unique_lock;
+    using std::vector;
+
+    namespace {
+
+        constexpr size_t NETLINK_BUFFER_SIZE = 8192; //!< Large enough for a request carrying every attribute
+
+        /**
+         * @brief Appends a netlink attribute to the message in the given buffer.
+         */
+        void appendAttribute(nlmsghdr* header, const size_t capacity, const uint16_t type, const void* data, const size_t length) {
+            const auto attributeLength = RTA_LENGTH(length);
+
+            if (NLMSG_ALIGN(header->nlmsg_len) + RTA_ALIGN(attributeLength) > capacity) {
+                throw CanException("Netlink request exceeds buffer size!", -1);
+            }
+
+            auto attribute = reinterpret_cast<rtattr*>(reinterpret_cast<char*>(header) + NLMSG_ALIGN(header->nlmsg_len));
+            attribute->rta_type = type;
+            attribute->rta_len = static_cast<uint16_t>(attributeLength);
+            memcpy(RTA_DATA(attribute), data, length);
+
+            header->nlmsg_len = NLMSG_ALIGN(header->nlmsg_len) + RTA_ALIGN(attributeLength);
+        }
+
+        /**
+         * @brief Resolves an interface name to its index.
+         */
+        uint32_t interfaceIndex(const string& name) {
+            const auto index = if_nametoindex(name.c_str());
+
+            if (index == 0) { throw CanException(formatString("FAILED to resolve interface %s! Error: %d => %s", name.c_str(), errno, strerror(errno)), -1); }
+
+            return index;
+        }
+
+        /**
+         * @brief Resolves an interface index to its name.
+         */
+        string interfaceName(const uint32_t index) {
+            char name[IF_NAMESIZE]{};
+
+            return if_indextoname(index, name) ? string(name) : formatString("if%u", index);
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    CanGateway::CanGateway() {
+        _netlinkFd = socket(PF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+
+        if (_netlinkFd == -1) {
+            throw CanInitException(formatString("FAILED to open rtnetlink socket! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        sockaddr_nl address{};
+        address.nl_family = AF_NETLINK;
+
+        if (bind(_netlinkFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1) {
+            const auto error = errno;
+            close(_netlinkFd);
+            _netlinkFd = -1;
+            throw CanInitException(formatString("FAILED to bind rtnetlink socket! Error: %d => %s", error, strerror(error)));
+        }
+    }
+
+    CanGateway::~CanGateway() {
+        if (_netlinkFd >= 0) { close(_netlinkFd); }
+    }
+#pragma endregion
+
+#pragma region "Rule Management"
+    /**
+     * @brief Adds a routing rule to the kernel's CAN gateway.
+     *
+     * If the rule has a non-zero modification UID and a rule with the same UID exists,
+     * the modifications of the existing rule are updated in-place.
+     *
+     * @param rule The rule to add.
+     */
+    void CanGateway::addRule(const CanGatewayRule& rule) { sendRequest(RTM_NEWROUTE, NLM_F_CREATE, &rule); }
+
+    /**
+     * @brief Removes a routing rule from the kernel's CAN gateway.
+     *
+     * The kernel only removes rules whose attributes match exactly.
+     *
+     * @param rule The rule to remove.
+     */
+    void CanGateway::removeRule(const CanGatewayRule& rule) { sendRequest(RTM_DELROUTE, 0, &rule); }
+
+    /**
+     * @brief Removes all routing rules from the kernel's CAN gateway.
+     */
+    void CanGateway::clearRules() { sendRequest(RTM_DELROUTE, 0, nullptr); }
+
+    /**
+     * @brief Reads all routing rules currently programmed into the kernel, along with their statistics.
+     *
+     * @return vector<CanGatewayRuleInfo> The rules and their frame counters.
+     */
+    vector<CanGatewayRuleInfo> CanGateway::getRules() {
+        unique_lock<mutex> locky(_lock);
+
+        struct {
+            nlmsghdr    header;
+            rtcanmsg    message;
+        } request{};
+
+        request.header.nlmsg_len = NLMSG_LENGTH(sizeof(rtcanmsg));
+        request.header.nlmsg_type = RTM_GETROUTE;
+        request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+        request.header.nlmsg_seq = ++_sequence;
+        request.message.can_family = AF_CAN;
+
+        if (send(_netlinkFd, &request, request.header.nlmsg_len, 0) == -1) {
+            throw CanException(formatString("FAILED to request CAN gateway rules! Error: %d => %s", errno, strerror(errno)), _netlinkFd);
+        }
+
+        vector<CanGatewayRuleInfo> rules{};
+        vector<char> buffer(NETLINK_BUFFER_SIZE * 4);
+
+        while (true) {
+            auto bytesRead = recv(_netlinkFd, buffer.data(), buffer.size(), 0);
+
+            if (bytesRead < 0) {
+                if (errno == EINTR) { continue; }
+                throw CanException(formatString("FAILED to read CAN gateway rules! Error: %d => %s", errno, strerror(errno)), _netlinkFd);
+            }
+
+            auto header = reinterpret_cast<nlmsghdr*>(buffer.data());
+            auto remaining = static_cast<uint32_t>(bytesRead);
+
+            for (; NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining)) {
+                if (header->nlmsg_seq != _sequence) { continue; }
+
+                if (header->nlmsg_type == NLMSG_DONE) { return rules; }
+
+                if (header->nlmsg_type == NLMSG_ERROR) {
+                    const auto error = reinterpret_cast<nlmsgerr*>(NLMSG_DATA(header))->error;
+                    throw CanException(formatString("FAILED to read CAN gateway rules! Error: %d => %s", -error, strerror(-error)), _netlinkFd);
+                }
+
+                if (header->nlmsg_type == RTM_NEWROUTE && header->nlmsg_len >= NLMSG_LENGTH(sizeof(rtcanmsg))) { rules.push_back(parseRule(header)); }
+            }
+        }
+    }
+
+    /**
+     * @brief Generates an MSB-first CRC8 lookup table for the given polynomial.
+     *
+     * @param polynomial The CRC8 polynomial, without the implicit x^8 term.
+     * @param table The table to fill.
+     */
+    void CanGateway::generateCrc8Table(const uint8_t polynomial, uint8_t (&table)[256]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint8_t crc = static_cast<uint8_t>(i);
+
+            for (int32_t bit = 0; bit < 8; bit++) { crc = static_cast<uint8_t>((crc & 0x80) ? (crc << 1) ^ polynomial : (crc << 1)); }
+
+            table[i] = crc;
+        }
+    }
+
+    /**
+     * @brief Appends the attributes describing a rule to a gateway request.
+     *
+     * @param header The request, whose rtcanmsg must already be initialised.
+     * @param capacity The size of the buffer holding the request.
+     * @param rule The rule to serialise.
+     */
+    void CanGateway::appendRule(nlmsghdr* header, const size_t capacity, const CanGatewayRule& rule) {
+        reinterpret_cast<rtcanmsg*>(NLMSG_DATA(header))->flags = rule.flags;
+
+        const uint32_t sourceIndex = interfaceIndex(rule.sourceInterface);
+        const uint32_t destinationIndex = interfaceIndex(rule.destinationInterface);
+        appendAttribute(header, capacity, CGW_SRC_IF, &sourceIndex, sizeof(sourceIndex));
+        appendAttribute(header, capacity, CGW_DST_IF, &destinationIndex, sizeof(destinationIndex));
+
+        if (rule.hasFilter) { appendAttribute(header, capacity, CGW_FILTER, &rule.filter, sizeof(rule.filter)); }
+
+        for (const auto& modification : rule.modifications) {
+            cgw_frame_mod mod{};
+            mod.cf = modification.frame;
+            mod.modtype = modification.elements;
+            appendAttribute(header, capacity, static_cast<uint16_t>(modification.op), &mod, CGW_MODATTR_LEN);
+        }
+
+        if (rule.xorChecksum.enabled) {
+            cgw_csum_xor checksum{};
+            checksum.from_idx = rule.xorChecksum.fromIndex;
+            checksum.to_idx = rule.xorChecksum.toIndex;
+            checksum.result_idx = rule.xorChecksum.resultIndex;
+            checksum.init_xor_val = rule.xorChecksum.initialValue;
+            appendAttribute(header, capacity, CGW_CS_XOR, &checksum, CGW_CS_XOR_LEN);
+        }
+
+        if (rule.crc8.enabled) {
+            cgw_csum_crc8 checksum{};
+            checksum.from_idx = rule.crc8.fromIndex;
+            checksum.to_idx = rule.crc8.toIndex;
+            checksum.result_idx = rule.crc8.resultIndex;
+            checksum.init_crc_val = rule.crc8.initialValue;
+            checksum.final_xor_val = rule.crc8.finalXor;
+            checksum.profile = rule.crc8.profile;
+            generateCrc8Table(rule.crc8.polynomial, checksum.crctab);
+            memcpy(checksum.profile_data, rule.crc8.profileData, sizeof(checksum.profile_data));
+            appendAttribute(header, capacity, CGW_CS_CRC8, &checksum, CGW_CS_CRC8_LEN);
+        }
+
+        if (rule.hopLimit) { appendAttribute(header, capacity, CGW_LIM_HOPS, &rule.hopLimit, sizeof(rule.hopLimit)); }
+        if (rule.modificationUid) { appendAttribute(header, capacity, CGW_MOD_UID, &rule.modificationUid, sizeof(rule.modificationUid)); }
+    }
+
+    /**
+     * @brief Appends the attributes addressing all rules to a gateway request.
+     *
+     * The kernel rejects requests without both interface attributes; indices of 0 for both, as sent by cangw -F,
+     * make an RTM_DELROUTE request remove every rule.
+     *
+     * @param header The request, whose rtcanmsg must already be initialised.
+     * @param capacity The size of the buffer holding the request.
+     */
+    void CanGateway::appendFlush(nlmsghdr* header, const size_t capacity) {
+        const uint32_t anyInterface = 0;
+        appendAttribute(header, capacity, CGW_SRC_IF, &anyInterface, sizeof(anyInterface));
+        appendAttribute(header, capacity, CGW_DST_IF, &anyInterface, sizeof(anyInterface));
+    }
+
+    /**
+     * @brief Parses the attributes of a single rule dumped by the kernel.
+     *
+     * Interface indices the local system does not know are reported as "if<index>".
+     *
+     * @param header The RTM_NEWROUTE message describing the rule.
+     *
+     * @return CanGatewayRuleInfo The rule and its frame counters.
+     */
+    CanGatewayRuleInfo CanGateway::parseRule(const nlmsghdr* header) {
+        CanGatewayRuleInfo info{};
+        auto canMessage = reinterpret_cast<const rtcanmsg*>(NLMSG_DATA(header));
+        info.rule.flags = canMessage->flags;
+
+        auto attribute = reinterpret_cast<const rtattr*>(reinterpret_cast<const char*>(canMessage) + NLMSG_ALIGN(sizeof(rtcanmsg)));
+        int32_t remaining = static_cast<int32_t>(header->nlmsg_len - NLMSG_LENGTH(sizeof(rtcanmsg)));
+
+        for (; RTA_OK(attribute, remaining); attribute = RTA_NEXT(attribute, remaining)) {
+            const auto data = RTA_DATA(attribute);
+            const auto length = RTA_PAYLOAD(attribute);
+
+            switch (attribute->rta_type) {
+                case CGW_SRC_IF:    info.rule.sourceInterface = interfaceName(*reinterpret_cast<const uint32_t*>(data)); break;
+                case CGW_DST_IF:    info.rule.destinationInterface = interfaceName(*reinterpret_cast<const uint32_t*>(data)); break;
+                case CGW_HANDLED:   info.handled = *reinterpret_cast<const uint32_t*>(data); break;
+                case CGW_DROPPED:   info.dropped = *reinterpret_cast<const uint32_t*>(data); break;
+                case CGW_DELETED:   info.deleted = *reinterpret_cast<const uint32_t*>(data); break;
+                case CGW_LIM_HOPS:  info.rule.hopLimit = *reinterpret_cast<const uint8_t*>(data); break;
+                case CGW_MOD_UID:   info.rule.modificationUid = *reinterpret_cast<const uint32_t*>(data); break;
+                case CGW_FILTER:
+                    if (length < sizeof(can_filter)) { break; }
+                    memcpy(&info.rule.filter, data, sizeof(can_filter));
+                    info.rule.hasFilter = true;
+                    break;
+                case CGW_MOD_AND:
+                case CGW_MOD_OR:
+                case CGW_MOD_XOR:
+                case CGW_MOD_SET: {
+                    if (length < CGW_MODATTR_LEN) { break; }
+                    cgw_frame_mod mod{};
+                    can_frame frame{};
+                    memcpy(&mod, data, CGW_MODATTR_LEN);
+                    memcpy(&frame, &mod.cf, sizeof(frame));
+                    info.rule.modifications.emplace_back(static_cast<CanGatewayModOp>(attribute->rta_type), mod.modtype, frame);
+                    break;
+                }
+                case CGW_CS_XOR: {
+                    if (length < CGW_CS_XOR_LEN) { break; }
+                    cgw_csum_xor checksum{};
+                    memcpy(&checksum, data, CGW_CS_XOR_LEN);
+                    auto& xorChecksum = info.rule.xorChecksum;
+                    xorChecksum.enabled = true;
+                    xorChecksum.fromIndex = checksum.from_idx;
+                    xorChecksum.toIndex = checksum.to_idx;
+                    xorChecksum.resultIndex = checksum.result_idx;
+                    xorChecksum.initialValue = checksum.init_xor_val;
+                    break;
+                }
+                case CGW_CS_CRC8: {
+                    if (length < CGW_CS_CRC8_LEN) { break; }
+                    cgw_csum_crc8 checksum{};
+                    memcpy(&checksum, data, CGW_CS_CRC8_LEN);
+                    auto& crc = info.rule.crc8;
+                    crc.enabled = true;
+                    crc.fromIndex = checksum.from_idx;
+                    crc.toIndex = checksum.to_idx;
+                    crc.resultIndex = checksum.result_idx;
+                    crc.initialValue = checksum.init_crc_val;
+                    crc.finalXor = checksum.final_xor_val;
+                    crc.polynomial = checksum.crctab[1]; // crctab[1] == polynomial for MSB-first tables
+                    crc.profile = checksum.profile;
+                    memcpy(crc.profileData, checksum.profile_data, sizeof(crc.profileData));
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        return info;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Builds a rule request, sends it to the kernel and waits for the acknowledgement.
+     *
+     * @param type The request type (RTM_NEWROUTE/RTM_DELROUTE).
+     * @param flags Additional netlink flags.
+     * @param rule The rule to send, or nullptr to address all rules (see @ref appendFlush()).
+     */
+    void CanGateway::sendRequest(const uint16_t type, const uint16_t flags, const CanGatewayRule* rule) {
+        unique_lock<mutex> locky(_lock);
+
+        vector<char> buffer(NETLINK_BUFFER_SIZE);
+        auto header = reinterpret_cast<nlmsghdr*>(buffer.data());
+        header->nlmsg_len = NLMSG_LENGTH(sizeof(rtcanmsg));
+        header->nlmsg_type = type;
+        header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | flags;
+        header->nlmsg_seq = ++_sequence;
+
+        auto canMessage = reinterpret_cast<rtcanmsg*>(NLMSG_DATA(header));
+        canMessage->can_family = AF_CAN;
+        canMessage->gwtype = CGW_TYPE_CAN_CAN;
+
+        if (rule) {
+            appendRule(header, buffer.size(), *rule);
+        } else {
+            appendFlush(header, buffer.size());
+        }
+
+        if (send(_netlinkFd, header, header->nlmsg_len, 0) == -1) {
+            throw CanException(formatString("FAILED to send CAN gateway request! Error: %d => %s", errno, strerror(errno)), _netlinkFd);
+        }
+
+        while (true) {
+            auto bytesRead = recv(_netlinkFd, buffer.data(), buffer.size(), 0);
+
+            if (bytesRead < 0) {
+                if (errno == EINTR) { continue; }
+                throw CanException(formatString("FAILED to read CAN gateway acknowledgement! Error: %d => %s", errno, strerror(errno)), _netlinkFd);
+            }
+
+            auto reply = reinterpret_cast<nlmsghdr*>(buffer.data());
+            auto remaining = static_cast<uint32_t>(bytesRead);
+
+            for (; NLMSG_OK(reply, remaining); reply = NLMSG_NEXT(reply, remaining)) {
+                if (reply->nlmsg_seq != _sequence || reply->nlmsg_type != NLMSG_ERROR) { continue; }
+
+                const auto error = reinterpret_cast<nlmsgerr*>(NLMSG_DATA(reply))->error;
+                if (error != 0) {
+                    throw CanException(formatString("CAN gateway request rejected! Error: %d => %s", -error, strerror(-error)), _netlinkFd);
+                }
+
+                return;
+            }
+        }
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,306 @@
+/**
+ * @file CanLatestValueCache.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the latest-value cache.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanLatestValueCache.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic_thread_fence;
+    using std::memcpy;
+    using std::memory_order_acq_rel;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+
+    static_assert(sizeof(can_frame) == 2 * sizeof(uint64_t), "can_frame is expected to be 16 bytes!");
+
+    constexpr size_t CanLatestValueCache::STANDARD_ID_COUNT;
+    constexpr uint32_t CanLatestValueCache::DEFAULT_SNAPSHOT_ATTEMPTS;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new, empty cache.
+     *
+     * @param extendedCapacity The maximum amount of distinct extended IDs to store.
+     */
+    CanLatestValueCache::CanLatestValueCache(const size_t extendedCapacity): _standardSlots(STANDARD_ID_COUNT), _extendedCapacity(extendedCapacity) {
+        if (!extendedCapacity) { return; }
+
+        // Keep the load factor at or below 50% so probe sequences stay short
+        size_t tableSize = 1;
+        while (tableSize < extendedCapacity * 2) { tableSize <<= 1; }
+
+        _extendedSlots = vector<Slot>(tableSize);
+        _extendedMask = tableSize - 1;
+    }
+#pragma endregion
+
+#pragma region "Writing"
+    /**
+     * @brief Stores a received frame as the latest value of its ID.
+     *
+     * May be called from several threads at once.
+     *
+     * @param frame The received frame.
+     * @param received The time the frame was received.
+     *
+     * @return true If the frame was stored.
+     * @return false If the frame is an error or remote frame, or the extended table is full.
+     */
+    bool CanLatestValueCache::update(const can_frame& frame, const steady_clock::time_point received) {
+        if (frame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) { return false; } // remote requests carry no value
+
+        auto slot = findSlot(normaliseCanId(frame.can_id));
+        if (!slot) {
+            _droppedFrames.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+
+        write(*slot, frame, received);
+
+        return true;
+    }
+
+    /**
+     * @brief Stores a received message as the latest value of its ID.
+     *
+     * @param message The received message.
+     * @param received The time the message was received.
+     *
+     * @return true If the message was stored.
+     * @return false If the message is an error or remote frame, or the extended table is full.
+     */
+    bool CanLatestValueCache::update(const CanMessage& message, const steady_clock::time_point received) {
+        return update(message.getRawFrame(), received);
+    }
+
+    /**
+     * @brief Stores a batch of received frames, e.g. as returned by CanDriver::readFrames().
+     *
+     * Later frames of the same ID overwrite earlier ones.
+     *
+     * @param frames The received frames.
+     * @param frameCount The amount of frames.
+     * @param received The time the frames were received.
+     *
+     * @return size_t The amount of frames stored.
+     */
+    size_t CanLatestValueCache::update(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received) {
+        size_t storedFrames = 0;
+
+        for (size_t i = 0; i < frameCount; i++) {
+            if (update(frames[i], received)) { storedFrames++; }
+        }
+
+        return storedFrames;
+    }
+#pragma endregion
+
+#pragma region "Reading"
+    /**
+     * @brief Reads the latest value of a single ID.
+     *
+     * @param id The ID to read. IDs above 0x7FF are treated as extended IDs.
+     * @param value Receives the latest value.
+     *
+     * @return true If a frame has been received for the ID.
+     * @return false Otherwise.
+     */
+    bool CanLatestValueCache::read(const CanId id, CanLatestValue& value) const {
+        value = CanLatestValue{};
+
+        auto slot = findSlot(normaliseCanId(*id));
+        if (!slot) { return false; }
+
+        readSlot(*slot, value);
+
+        return value.updates > 0;
+    }
+
+    /**
+     * @brief Reads the latest values of several IDs, such that all values were current at the same point in time.
+     *
+     * Each attempt reads all entries, then checks that none of them changed in the meantime.
+     * IDs for which no frame has been received yield a value with zero updates.
+     *
+     * @param ids The IDs to read.
+     * @param values Receives the latest values, in the same order as the IDs.
+     * @param attempts The maximum amount of attempts before giving up.
+     *
+     * @return true If the values form a consistent snapshot.
+     * @return false If the entries kept changing; each value is still consistent on its own.
+     */
+    bool CanLatestValueCache::snapshot(const vector<CanId>& ids, vector<CanLatestValue>& values, const uint32_t attempts) const {
+        values.resize(ids.size());
+
+        for (uint32_t attempt = 0; attempt < attempts; attempt++) {
+            for (size_t i = 0; i < ids.size(); i++) {
+                values[i] = CanLatestValue{};
+
+                auto slot = findSlot(normaliseCanId(*ids[i]));
+                if (slot) { readSlot(*slot, values[i]); }
+            }
+
+            bool consistent = true;
+            for (size_t i = 0; i < ids.size() && consistent; i++) {
+                auto slot = findSlot(normaliseCanId(*ids[i]));
+                consistent = !slot || slot->sequence.load(memory_order_acquire) == values[i].updates * 2;
+            }
+
+            if (consistent) { return true; }
+        }
+
+        return false;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Writes a frame to a slot under its sequence lock.
+     *
+     * Concurrent writers to the same slot serialise on the odd sequence; readers are never blocked.
+     */
+    void CanLatestValueCache::write(Slot& slot, const can_frame& frame, const steady_clock::time_point received) {
+        uint64_t words[2];
+        memcpy(words, &frame, sizeof(words));
+
+        uint64_t sequence = 0;
+        do {
+            sequence = slot.sequence.load(memory_order_relaxed);
+        } while ((sequence & 1) || !slot.sequence.compare_exchange_weak(sequence, sequence + 1, memory_order_acquire, memory_order_relaxed));
+
+        atomic_thread_fence(memory_order_release);
+
+        slot.words[0].store(words[0], memory_order_relaxed);
+        slot.words[1].store(words[1], memory_order_relaxed);
+        slot.received.store(received.time_since_epoch().count(), memory_order_relaxed);
+
+        slot.sequence.store(sequence + 2, memory_order_release);
+    }
+
+    /**
+     * @brief Reads a consistent copy of a slot, retrying while it is being written.
+     *
+     * @return uint64_t The sequence of the copy.
+     */
+    uint64_t CanLatestValueCache::readSlot(const Slot& slot, CanLatestValue& value) {
+        while (true) {
+            const auto sequence = slot.sequence.load(memory_order_acquire);
+            if (sequence & 1) { continue; }
+
+            uint64_t words[2] = { slot.words[0].load(memory_order_relaxed), slot.words[1].load(memory_order_relaxed) };
+            const auto received = slot.received.load(memory_order_relaxed);
+
+            atomic_thread_fence(memory_order_acquire);
+            if (slot.sequence.load(memory_order_relaxed) != sequence) { continue; }
+
+            memcpy(&value.frame, words, sizeof(words));
+            value.received = steady_clock::time_point(steady_clock::duration(received));
+            value.updates = sequence / 2;
+
+            return sequence;
+        }
+    }
+
+    /**
+     * @brief Gets the slot index an extended ID hashes to.
+     */
+    size_t CanLatestValueCache::hashId(const canid_t key) const {
+        auto hash = static_cast<uint32_t>(key * 0x9E3779B1u);
+        hash ^= hash >> 16;
+
+        return hash & _extendedMask;
+    }
+
+    /**
+     * @brief Finds the slot of an ID, claiming a free one for new extended IDs.
+     *
+     * @return Slot* The slot, or nullptr if the extended table is full.
+     */
+    CanLatestValueCache::Slot* CanLatestValueCache::findSlot(const canid_t key) {
+        if (!(key & CAN_EFF_FLAG)) { return &_standardSlots[key]; }
+        if (_extendedSlots.empty()) { return nullptr; }
+
+        auto index = hashId(key);
+        for (size_t probe = 0; probe < _extendedSlots.size(); probe++, index = (index + 1) & _extendedMask) {
+            auto& slot = _extendedSlots[index];
+            auto existing = slot.key.load(memory_order_acquire);
+
+            if (existing == key) { return &slot; }
+            if (existing != 0) { continue; }
+
+            if (_extendedCount.load(memory_order_relaxed) >= _extendedCapacity) { return nullptr; }
+
+            // Extended keys always carry CAN_EFF_FLAG, so zero marks a free slot
+            if (slot.key.compare_exchange_strong(existing, key, memory_order_acq_rel, memory_order_acquire)) {
+                _extendedCount.fetch_add(1, memory_order_relaxed);
+                return &slot;
+            }
+
+            if (existing == key) { return &slot; }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Finds the slot of an ID.
+     *
+     * @return const Slot* The slot, or nullptr if the ID has never been stored.
+     */
+    const CanLatestValueCache::Slot* CanLatestValueCache::findSlot(const canid_t key) const {
+        if (!(key & CAN_EFF_FLAG)) { return &_standardSlots[key]; }
+        if (_extendedSlots.empty()) { return nullptr; }
+
+        auto index = hashId(key);
+        for (size_t probe = 0; probe < _extendedSlots.size(); probe++, index = (index + 1) & _extendedMask) {
+            const auto existing = _extendedSlots[index].key.load(memory_order_acquire);
+
+            if (existing == key) { return &_extendedSlots[index]; }
+            if (existing == 0) { return nullptr; }
+        }
+
+        return nullptr;
+    }
+
+} // namespace sockcanpp
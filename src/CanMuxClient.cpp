@@ -0,0 +1,218 @@
+/**
+ * @file CanMuxClient.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the CAN multiplexer client.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanMuxClient.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Connects to a server and subscribes to a bus.
+     *
+     * @param socketPath The path of the server's socket.
+     * @param canInterface The name of the bus to subscribe to.
+     * @param filters The frames to receive, as socketcan filters (including CAN_INV_FILTER). By default, all frames are received; an empty list receives none.
+     * @param timeout The maximum time to wait for the server to accept the subscription.
+     */
+    CanMuxClient::CanMuxClient(const string& socketPath, const string& canInterface, const vector<can_filter>& filters, const milliseconds timeout):
+        _canInterface(canInterface), _datagram(CAN_MUX_MAX_DATAGRAM) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        CanMuxSubscription subscription{};
+
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) { throw CanInitException(formatString("Invalid socket path %s!", socketPath.c_str())); }
+        if (canInterface.empty() || canInterface.size() >= sizeof(subscription.interface)) { throw CanInitException(formatString("Invalid interface name %s!", canInterface.c_str())); }
+        if (filters.size() > CAN_MUX_MAX_FILTERS) { throw CanInitException(formatString("Too many filters; at most %zu are supported!", CAN_MUX_MAX_FILTERS)); }
+
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        strncpy(subscription.interface, canInterface.c_str(), sizeof(subscription.interface) - 1);
+
+        if ((_socketFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0)) < 0) {
+            throw CanInitException(formatString("FAILED to open multiplexer socket! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        if (connect(_socketFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            const auto error = errno;
+            close(_socketFd);
+            throw CanInitException(formatString("FAILED to connect to multiplexer %s! Error: %d => %s", socketPath.c_str(), error, strerror(error)));
+        }
+
+        CanMuxHeader header{ static_cast<uint16_t>(CanMuxMessageType::Subscribe), CAN_MUX_PROTOCOL_VERSION, static_cast<uint32_t>(filters.size()) };
+        vector<uint8_t> request(sizeof(header) + sizeof(subscription) + filters.size() * sizeof(can_filter));
+        memcpy(request.data(), &header, sizeof(header));
+        memcpy(request.data() + sizeof(header), &subscription, sizeof(subscription));
+        if (!filters.empty()) { memcpy(request.data() + sizeof(header) + sizeof(subscription), filters.data(), filters.size() * sizeof(can_filter)); }
+
+        string failure{};
+        if (send(_socketFd, request.data(), request.size(), MSG_NOSIGNAL) < 0) {
+            failure = formatString("FAILED to send subscription! Error: %d => %s", errno, strerror(errno));
+        } else if (!waitForFrames(timeout)) {
+            failure = "Timed out waiting for the multiplexer to accept the subscription!";
+        } else {
+            const auto length = recv(_socketFd, _datagram.data(), _datagram.size(), 0);
+            memcpy(&header, _datagram.data(), sizeof(header));
+
+            if (length < static_cast<ssize_t>(sizeof(header))) {
+                failure = "Multiplexer closed the connection!";
+            } else if (header.type == static_cast<uint16_t>(CanMuxMessageType::Reject)) {
+                failure = string(reinterpret_cast<char*>(_datagram.data()) + sizeof(header), static_cast<size_t>(length) - sizeof(header));
+            } else if (header.type != static_cast<uint16_t>(CanMuxMessageType::Acknowledge)) {
+                failure = "Unexpected response from multiplexer!";
+            }
+        }
+
+        if (!failure.empty()) {
+            close(_socketFd);
+            throw CanInitException(failure);
+        }
+    }
+
+    /**
+     * @brief Closes the connection; the server drops the subscription.
+     */
+    CanMuxClient::~CanMuxClient() {
+        if (_socketFd >= 0) { close(_socketFd); }
+    }
+#pragma endregion
+
+#pragma region "I/O"
+    /**
+     * @brief Waits for frames to arrive.
+     *
+     * @param timeout The maximum time to wait.
+     *
+     * @return true If data is available.
+     * @return false If the timeout elapsed.
+     */
+    bool CanMuxClient::waitForFrames(const milliseconds timeout) {
+        pollfd pollFd{ _socketFd, POLLIN, 0 };
+
+        const auto readyCount = poll(&pollFd, 1, static_cast<int>(timeout.count()));
+        if (readyCount < 0 && errno != EINTR) { throw CanException(formatString("FAILED to poll multiplexer socket! Error: %d => %s", errno, strerror(errno)), _socketFd); }
+
+        return readyCount > 0;
+    }
+
+    /**
+     * @brief Appends all frames which have arrived so far, without blocking.
+     *
+     * @param frames Receives the frames.
+     *
+     * @return size_t The amount of frames appended.
+     */
+    size_t CanMuxClient::readFrames(vector<CanMuxFrame>& frames) {
+        size_t framesRead = 0;
+
+        while (true) {
+            const auto length = recv(_socketFd, _datagram.data(), _datagram.size(), MSG_DONTWAIT);
+
+            if (length < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) { break; }
+                throw CanException(formatString("FAILED to read from multiplexer! Error: %d => %s", errno, strerror(errno)), _socketFd);
+            }
+
+            if (length < static_cast<ssize_t>(sizeof(CanMuxHeader))) { throw CanException("Multiplexer closed the connection!", _socketFd); }
+
+            CanMuxHeader header{};
+            memcpy(&header, _datagram.data(), sizeof(header));
+            const auto payloadLength = static_cast<size_t>(length) - sizeof(header);
+
+            if (header.type == static_cast<uint16_t>(CanMuxMessageType::Reject)) {
+                throw CanException(string(reinterpret_cast<char*>(_datagram.data()) + sizeof(header), payloadLength), _socketFd);
+            }
+
+            if (header.type != static_cast<uint16_t>(CanMuxMessageType::Frames) || payloadLength != header.count * sizeof(CanMuxFrame)) { continue; }
+
+            const auto offset = frames.size();
+            frames.resize(offset + header.count);
+            memcpy(frames.data() + offset, _datagram.data() + sizeof(header), payloadLength);
+            framesRead += header.count;
+        }
+
+        return framesRead;
+    }
+
+    /**
+     * @brief Sends frames on the subscribed bus, CAN_MUX_MAX_FRAMES frames per datagram.
+     *
+     * Transmit failures on the bus are reported asynchronously by the next call to @ref readFrames().
+     *
+     * @param frames The frames to send.
+     * @param frameCount The amount of frames.
+     *
+     * @return size_t The amount of frames handed to the server.
+     */
+    size_t CanMuxClient::sendFrames(const can_frame* frames, const size_t frameCount) {
+        size_t framesSent = 0;
+
+        while (framesSent < frameCount) {
+            const auto batchSize = frameCount - framesSent < CAN_MUX_MAX_FRAMES ? frameCount - framesSent : CAN_MUX_MAX_FRAMES;
+            CanMuxHeader header{ static_cast<uint16_t>(CanMuxMessageType::Send), CAN_MUX_PROTOCOL_VERSION, static_cast<uint32_t>(batchSize) };
+
+            memcpy(_datagram.data(), &header, sizeof(header));
+            memcpy(_datagram.data() + sizeof(header), frames + framesSent, batchSize * sizeof(can_frame));
+
+            if (send(_socketFd, _datagram.data(), sizeof(header) + batchSize * sizeof(can_frame), MSG_NOSIGNAL) < 0) {
+                throw CanException(formatString("FAILED to send to multiplexer! Error: %d => %s", errno, strerror(errno)), _socketFd);
+            }
+
+            framesSent += batchSize;
+        }
+
+        return framesSent;
+    }
+#pragma endregion
+
+} // namespace sockcanpp
@@ -0,0 +1,402 @@
+/**
+ * @file CanMuxServer.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the CAN multiplexer server.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanMuxServer.hpp"
+#include "CanTransport.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+    using std::unique_lock;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Creates the listening socket. A stale socket file at the same path is replaced.
+     *
+     * @param socketPath The filesystem path clients connect to.
+     */
+    CanMuxServer::CanMuxServer(const string& socketPath): _socketPath(socketPath), _datagram(CAN_MUX_MAX_DATAGRAM) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+            throw CanInitException(formatString("Invalid socket path %s!", socketPath.c_str()));
+        }
+
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+        if ((_listenFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0) {
+            throw CanInitException(formatString("FAILED to open multiplexer socket! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        unlink(socketPath.c_str());
+
+        if (bind(_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(_listenFd, SOMAXCONN) < 0) {
+            const auto error = errno;
+            close(_listenFd);
+            throw CanInitException(formatString("FAILED to bind multiplexer socket to %s! Error: %d => %s", socketPath.c_str(), error, strerror(error)));
+        }
+    }
+
+    /**
+     * @brief Disconnects all clients and removes the socket file.
+     */
+    CanMuxServer::~CanMuxServer() {
+        for (const auto& client : _clients) { close(client.fd); }
+
+        if (_listenFd >= 0) {
+            close(_listenFd);
+            unlink(_socketPath.c_str());
+        }
+    }
+#pragma endregion
+
+#pragma region "Configuration"
+    /**
+     * @brief Makes a bus available to clients under the given name.
+     *
+     * @param name The name clients subscribe with; usually the interface name.
+     * @param driver The driver receiving the bus's frames.
+     */
+    void CanMuxServer::addBus(const string& name, CanDriver& driver) {
+        unique_lock<mutex> locky(_lock);
+
+        Bus bus{};
+        bus.name = name;
+        bus.driver = &driver;
+
+        _buses.push_back(bus);
+    }
+#pragma endregion
+
+#pragma region "Processing"
+    /**
+     * @brief Waits for activity, then accepts new clients, handles requests and distributes received frames.
+     *
+     * @param timeout The maximum time to wait for activity.
+     *
+     * @return size_t The amount of frames received from the buses.
+     */
+    size_t CanMuxServer::processOnce(milliseconds timeout) {
+        unique_lock<mutex> locky(_lock);
+
+        // Layout: listening socket, one entry per bus, one entry per client
+        _pollFds.resize(1 + _buses.size() + _clients.size());
+        _pollFds[0] = { _listenFd, POLLIN, 0 };
+        for (size_t i = 0; i < _buses.size(); i++) { _pollFds[1 + i] = { _buses[i].driver->getSocketFd(), POLLIN, 0 }; }
+        for (size_t i = 0; i < _clients.size(); i++) { _pollFds[1 + _buses.size() + i] = { _clients[i].fd, POLLIN, 0 }; }
+
+        auto pollFds = _pollFds;
+        locky.unlock();
+
+        const auto readyCount = poll(pollFds.data(), pollFds.size(), static_cast<int>(timeout.count()));
+
+        if (readyCount < 0) {
+            if (errno == EINTR) { return 0; }
+            throw CanException(formatString("FAILED to poll multiplexer sockets! Error: %d => %s", errno, strerror(errno)), _listenFd);
+        }
+
+        if (readyCount == 0) { return 0; }
+
+        locky.lock();
+        size_t totalFrames = 0;
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE];
+
+        for (size_t i = 0; i < _buses.size(); i++) {
+            if (!(pollFds[1 + i].revents & POLLIN)) { continue; }
+
+            size_t frameCount = 0;
+            do {
+                frameCount = _buses[i].driver->readFrames(frames, CanDriver::CAN_MAX_BATCH_SIZE);
+                distribute(static_cast<int32_t>(i), frames, frameCount, steady_clock::now().time_since_epoch().count());
+                totalFrames += frameCount;
+            } while (frameCount == CanDriver::CAN_MAX_BATCH_SIZE);
+        }
+
+        // Clients accepted below aren't part of this poll round
+        const auto polledClients = pollFds.size() - 1 - _buses.size();
+        for (size_t i = 0; i < polledClients; i++) {
+            const auto events = pollFds[1 + _buses.size() + i].revents;
+
+            if (events & POLLIN) {
+                receiveRequest(_clients[i]);
+            } else if (events & (POLLHUP | POLLERR)) {
+                _clients[i].closed = true;
+            }
+        }
+
+        if (pollFds[0].revents & POLLIN) { acceptClients(); }
+
+        removeClosedClients();
+
+        return totalFrames;
+    }
+
+    /**
+     * @brief Serves clients until @ref stop() is called.
+     */
+    void CanMuxServer::run() {
+        _running = true;
+
+        while (_running) { processOnce(); }
+    }
+
+    /**
+     * @brief Delivers frames received by other means (e.g. a CanRouter) to the subscribers of a bus.
+     *
+     * May be called from any thread. Clients which disconnect are removed by the next call to @ref processOnce().
+     *
+     * @param bus The name of the bus.
+     * @param frames The frames to deliver.
+     * @param frameCount The amount of frames.
+     * @param received The time the frames were received.
+     */
+    void CanMuxServer::publish(const string& bus, const can_frame* frames, const size_t frameCount, const steady_clock::time_point received) {
+        unique_lock<mutex> locky(_lock);
+
+        for (size_t i = 0; i < _buses.size(); i++) {
+            if (_buses[i].name != bus) { continue; }
+
+            distribute(static_cast<int32_t>(i), frames, frameCount, received.time_since_epoch().count());
+        }
+    }
+
+    /**
+     * @brief Gets the amount of connected clients.
+     */
+    size_t CanMuxServer::getClientCount() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _clients.size();
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Accepts all pending connections. The lock must be held.
+     */
+    void CanMuxServer::acceptClients() {
+        int32_t clientFd = -1;
+
+        while ((clientFd = accept4(_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+            // A larger send buffer lets clients ride out short stalls without losing frames
+            const int32_t bufferSize = 1024 * 1024;
+            setsockopt(clientFd, SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize));
+
+            Client client{};
+            client.fd = clientFd;
+            _clients.push_back(client);
+        }
+    }
+
+    /**
+     * @brief Reads and handles a single request from a client. The lock must be held.
+     */
+    void CanMuxServer::receiveRequest(Client& client) {
+        const auto length = recv(client.fd, _datagram.data(), _datagram.size(), MSG_DONTWAIT);
+
+        if (length == 0 || (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            client.closed = true;
+            return;
+        }
+
+        if (length < static_cast<ssize_t>(sizeof(CanMuxHeader))) { return; }
+
+        CanMuxHeader header{};
+        memcpy(&header, _datagram.data(), sizeof(header));
+        const auto payload = _datagram.data() + sizeof(header);
+        const auto payloadLength = static_cast<size_t>(length) - sizeof(header);
+
+        if (header.version != CAN_MUX_PROTOCOL_VERSION) {
+            reject(client, formatString("Unsupported protocol version %u!", header.version));
+            return;
+        }
+
+        switch (static_cast<CanMuxMessageType>(header.type)) {
+            case CanMuxMessageType::Subscribe: {
+                if (header.count > CAN_MUX_MAX_FILTERS || payloadLength != sizeof(CanMuxSubscription) + header.count * sizeof(can_filter)) {
+                    reject(client, "Malformed subscription!");
+                    return;
+                }
+
+                CanMuxSubscription subscription{};
+                memcpy(&subscription, payload, sizeof(subscription));
+                const string name(subscription.interface, strnlen(subscription.interface, sizeof(subscription.interface)));
+
+                const auto bus = std::find_if(_buses.begin(), _buses.end(), [&name](const Bus& candidate) { return candidate.name == name; });
+                if (bus == _buses.end()) {
+                    reject(client, formatString("Unknown interface %s!", name.c_str()));
+                    return;
+                }
+
+                client.bus = static_cast<int32_t>(bus - _buses.begin());
+                client.filters.resize(header.count);
+                if (header.count) { memcpy(client.filters.data(), payload + sizeof(subscription), header.count * sizeof(can_filter)); }
+
+                CanMuxHeader acknowledgement{ static_cast<uint16_t>(CanMuxMessageType::Acknowledge), CAN_MUX_PROTOCOL_VERSION, 0 };
+                sendDatagram(client, &acknowledgement, sizeof(acknowledgement), 0);
+                break;
+            }
+            case CanMuxMessageType::Send: {
+                if (client.bus < 0) {
+                    reject(client, "Not subscribed to a bus!");
+                    return;
+                }
+
+                if (payloadLength != header.count * sizeof(can_frame)) {
+                    reject(client, "Malformed send request!");
+                    return;
+                }
+
+                vector<can_frame> frames(header.count);
+                if (header.count) { memcpy(frames.data(), payload, payloadLength); }
+
+                try {
+                    size_t framesSent = 0;
+                    while (framesSent < frames.size()) {
+                        const auto sent = _buses[client.bus].driver->sendFrames(frames.data() + framesSent, frames.size() - framesSent);
+                        if (!sent) { break; }
+                        framesSent += sent;
+                    }
+
+                    if (framesSent < frames.size()) { reject(client, formatString("Transmit queue full; %zu frames not sent!", frames.size() - framesSent)); }
+                } catch (CanException& ex) {
+                    reject(client, ex.what());
+                }
+                break;
+            }
+            default:
+                reject(client, formatString("Unsupported request %u!", header.type));
+                break;
+        }
+    }
+
+    /**
+     * @brief Sends frames to all clients subscribed to a bus whose filters match them. The lock must be held.
+     */
+    void CanMuxServer::distribute(const int32_t bus, const can_frame* frames, const size_t frameCount, const int64_t timestamp) {
+        if (!frameCount) { return; }
+
+        for (auto& client : _clients) {
+            if (client.bus != bus || client.closed) { continue; }
+
+            auto records = reinterpret_cast<CanMuxFrame*>(_datagram.data() + sizeof(CanMuxHeader));
+            size_t recordCount = 0;
+
+            for (size_t i = 0; i <= frameCount; i++) {
+                // Flush when the datagram is full or all frames have been filtered
+                if (recordCount && (i == frameCount || recordCount == CAN_MUX_MAX_FRAMES)) {
+                    CanMuxHeader header{ static_cast<uint16_t>(CanMuxMessageType::Frames), CAN_MUX_PROTOCOL_VERSION, static_cast<uint32_t>(recordCount) };
+                    memcpy(_datagram.data(), &header, sizeof(header));
+                    sendDatagram(client, _datagram.data(), sizeof(header) + recordCount * sizeof(CanMuxFrame), recordCount);
+                    recordCount = 0;
+                }
+
+                if (i == frameCount || !matches(client, frames[i])) { continue; }
+
+                records[recordCount].frame = frames[i];
+                records[recordCount].timestamp = timestamp;
+                recordCount++;
+            }
+        }
+    }
+
+    /**
+     * @brief Sends a datagram to a client without blocking. The lock must be held.
+     *
+     * If the client's queue is full, the datagram is dropped and its frames are counted as lost.
+     */
+    void CanMuxServer::sendDatagram(Client& client, const void* datagram, const size_t length, const size_t frameCount) {
+        if (send(client.fd, datagram, length, MSG_DONTWAIT | MSG_NOSIGNAL) >= 0) { return; }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+            _droppedFrames.fetch_add(frameCount, std::memory_order_relaxed);
+        } else {
+            client.closed = true;
+        }
+    }
+
+    /**
+     * @brief Tells a client that its last request failed. The lock must be held.
+     */
+    void CanMuxServer::reject(Client& client, const string& reason) {
+        vector<uint8_t> datagram(sizeof(CanMuxHeader) + reason.size());
+        CanMuxHeader header{ static_cast<uint16_t>(CanMuxMessageType::Reject), CAN_MUX_PROTOCOL_VERSION, static_cast<uint32_t>(reason.size()) };
+
+        memcpy(datagram.data(), &header, sizeof(header));
+        memcpy(datagram.data() + sizeof(header), reason.data(), reason.size());
+
+        sendDatagram(client, datagram.data(), datagram.size(), 0);
+    }
+
+    /**
+     * @brief Closes and forgets all disconnected clients. The lock must be held.
+     */
+    void CanMuxServer::removeClosedClients() {
+        for (const auto& client : _clients) {
+            if (client.closed) { close(client.fd); }
+        }
+
+        _clients.erase(std::remove_if(_clients.begin(), _clients.end(), [](const Client& client) { return client.closed; }), _clients.end());
+    }
+
+    /**
+     * @brief Checks a frame against a client's filters, with the semantics of CAN_RAW_FILTER.
+     */
+    bool CanMuxServer::matches(const Client& client, const can_frame& frame) { return canFiltersAccept(client.filters, frame.can_id); }
+
+} // namespace sockcanpp
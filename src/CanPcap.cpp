@@ -0,0 +1,487 @@
+/**
+ * @file CanPcap.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the PCAP-NG writer and reader.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanPcap.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+#ifndef CANFD_FDF
+#define CANFD_FDF 0x04 // older kernel headers lack the FD frame marker
+#endif
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    constexpr uint16_t CanPcapWriter::LINKTYPE_CAN_SOCKETCAN;
+
+    namespace {
+
+        constexpr uint32_t BLOCK_SECTION_HEADER         = 0x0A0D0D0A;
+        constexpr uint32_t BLOCK_INTERFACE_DESCRIPTION  = 0x00000001;
+        constexpr uint32_t BLOCK_ENHANCED_PACKET        = 0x00000006;
+        constexpr uint32_t BYTE_ORDER_MAGIC             = 0x1A2B3C4D;
+        constexpr uint32_t SWAPPED_BYTE_ORDER_MAGIC     = 0x4D3C2B1A;
+
+        constexpr uint16_t OPTION_END                   = 0;
+        constexpr uint16_t OPTION_IF_NAME               = 2;
+        constexpr uint16_t OPTION_IF_TSRESOL            = 9;
+
+        constexpr uint8_t  NANOSECOND_RESOLUTION        = 9;
+        constexpr size_t   SOCKETCAN_HEADER_SIZE        = 8;  //!< can_id (big-endian), length, flags, two reserved bytes
+
+        size_t padded(const size_t length) { return (length + 3) & ~size_t(3); }
+
+        void put16(uint8_t* data, const uint16_t value) { memcpy(data, &value, sizeof(value)); }
+        void put32(uint8_t* data, const uint32_t value) { memcpy(data, &value, sizeof(value)); }
+
+        /**
+         * @brief Converts a timestamp in units of the given if_tsresol into nanoseconds.
+         */
+        int64_t toNanoseconds(const uint64_t timestamp, const uint8_t resolution) {
+            const auto exponent = resolution & 0x7F;
+
+            if (resolution & 0x80) {
+                return static_cast<int64_t>(static_cast<long double>(timestamp) * 1000000000.0L / static_cast<long double>(uint64_t(1) << std::min(exponent, 63)));
+            }
+
+            uint64_t scale = 1;
+            for (auto i = std::min(exponent, 9); i < 9; i++) { scale *= 10; }
+            if (exponent <= 9) { return static_cast<int64_t>(timestamp * scale); }
+
+            for (auto i = 9; i < exponent && i < 28; i++) { scale *= 10; }
+            return static_cast<int64_t>(timestamp / scale);
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Writer"
+    /**
+     * @brief Creates (or truncates) a capture file and writes its section header.
+     *
+     * @param path The path of the capture file.
+     * @param bufferSize The amount of data collected before it is written to the file.
+     */
+    CanPcapWriter::CanPcapWriter(const string& path, const size_t bufferSize): _buffer(std::max<size_t>(bufferSize, 4096)) {
+        if ((_fileFd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)) < 0) {
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        const size_t length = 28;
+        auto block = reserve(length);
+        put32(block, BLOCK_SECTION_HEADER);
+        put32(block + 4, length);
+        put32(block + 8, BYTE_ORDER_MAGIC);
+        put16(block + 12, 1); // major version
+        put16(block + 14, 0); // minor version
+        put32(block + 16, UINT32_MAX); // section length: unknown
+        put32(block + 20, UINT32_MAX);
+        put32(block + 24, length);
+    }
+
+    /**
+     * @brief Flushes and closes the capture file.
+     */
+    CanPcapWriter::~CanPcapWriter() {
+        try {
+            close();
+        } catch (...) { }
+    }
+
+    /**
+     * @brief Describes a new interface. Frames refer to interfaces by the returned index.
+     *
+     * @param name The name of the interface, e.g. can0.
+     *
+     * @return uint32_t The index of the interface.
+     */
+    uint32_t CanPcapWriter::addInterface(const string& name) {
+        const auto nameOption = name.empty() ? 0 : 4 + padded(name.size());
+        const auto length = 8 + 8 + nameOption + 8 + 4 + 4;
+
+        auto block = reserve(length);
+        memset(block, 0, length);
+        put32(block, BLOCK_INTERFACE_DESCRIPTION);
+        put32(block + 4, static_cast<uint32_t>(length));
+        put16(block + 8, LINKTYPE_CAN_SOCKETCAN);
+        put32(block + 12, CANFD_MTU); // snap length
+
+        auto option = block + 16;
+        if (!name.empty()) {
+            put16(option, OPTION_IF_NAME);
+            put16(option + 2, static_cast<uint16_t>(name.size()));
+            memcpy(option + 4, name.data(), name.size());
+            option += nameOption;
+        }
+
+        put16(option, OPTION_IF_TSRESOL);
+        put16(option + 2, 1);
+        option[4] = NANOSECOND_RESOLUTION;
+        put16(option + 8, OPTION_END);
+        put32(block + length - 4, static_cast<uint32_t>(length));
+
+        return static_cast<uint32_t>(_interfaceCount++);
+    }
+
+    /**
+     * @brief Writes a classic CAN frame.
+     *
+     * @param interface The index returned by @ref addInterface().
+     * @param frame The frame.
+     * @param timestamp The capture time.
+     */
+    void CanPcapWriter::write(const uint32_t interface, const can_frame& frame, const system_clock::time_point timestamp) {
+        writePacket(interface, frame.can_id, std::min<uint8_t>(frame.can_dlc, CAN_MAX_DLEN), 0, frame.data, CAN_MAX_DLEN, timestamp);
+    }
+
+    /**
+     * @brief Writes a CAN FD frame.
+     *
+     * @param interface The index returned by @ref addInterface().
+     * @param frame The frame.
+     * @param timestamp The capture time.
+     */
+    void CanPcapWriter::write(const uint32_t interface, const canfd_frame& frame, const system_clock::time_point timestamp) {
+        writePacket(interface, frame.can_id, std::min<uint8_t>(frame.len, CANFD_MAX_DLEN), frame.flags | CANFD_FDF, frame.data, CANFD_MAX_DLEN, timestamp);
+    }
+
+    /**
+     * @brief Writes all buffered blocks to the file.
+     */
+    void CanPcapWriter::flush() {
+        size_t written = 0;
+
+        while (written < _bufferUsed) {
+            const auto result = ::write(_fileFd, _buffer.data() + written, _bufferUsed - written);
+
+            if (result < 0) {
+                if (errno == EINTR) { continue; }
+                throw CanException(formatString("FAILED to write capture! Error: %d => %s", errno, strerror(errno)), _fileFd);
+            }
+
+            written += static_cast<size_t>(result);
+        }
+
+        _bufferUsed = 0;
+    }
+
+    /**
+     * @brief Flushes and closes the capture file. Further writes are not allowed.
+     */
+    void CanPcapWriter::close() {
+        if (_fileFd < 0) { return; }
+
+        flush();
+        ::close(_fileFd);
+        _fileFd = -1;
+    }
+#pragma endregion
+
+#pragma region "Reader"
+    /**
+     * @brief Opens a capture file.
+     *
+     * @param path The path of the capture file.
+     * @param bufferSize The amount of data read from the file at a time.
+     */
+    CanPcapReader::CanPcapReader(const string& path, const size_t bufferSize): _buffer(std::max<size_t>(bufferSize, 4096)) {
+        if ((_fileFd = open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        // Peek at the section header, so other files fail early
+        if (!fill(12) || read32(_buffer.data() + _bufferStart) != BLOCK_SECTION_HEADER) {
+            ::close(_fileFd);
+            throw CanInitException(formatString("%s is not a PCAP-NG file!", path.c_str()));
+        }
+    }
+
+    /**
+     * @brief Closes the capture file.
+     */
+    CanPcapReader::~CanPcapReader() { ::close(_fileFd); }
+
+    /**
+     * @brief Reads the next CAN frame.
+     *
+     * @param frame Receives the frame.
+     *
+     * @return true If a frame was read.
+     * @return false At the end of the file.
+     */
+    bool CanPcapReader::next(CanPcapFrame& frame) {
+        uint32_t type = 0;
+        uint32_t length = 0;
+        const uint8_t* block = nullptr;
+
+        while ((block = nextBlock(type, length)) != nullptr) {
+            switch (type) {
+                case BLOCK_SECTION_HEADER:
+                    _interfaces.clear();
+                    break;
+                case BLOCK_INTERFACE_DESCRIPTION:
+                    parseInterface(block, length);
+                    break;
+                case BLOCK_ENHANCED_PACKET: {
+                    if (length < 32) { break; }
+
+                    const auto interface = read32(block + 8);
+                    const auto timestamp = (static_cast<uint64_t>(read32(block + 12)) << 32) | read32(block + 16);
+                    const auto capturedLength = std::min<uint32_t>(read32(block + 20), length - 32);
+
+                    if (parsePacket(block + 28, capturedLength, interface, timestamp, frame)) { return true; }
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        return false;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Makes room for a block at the end of the buffer, writing out the buffer if necessary.
+     */
+    uint8_t* CanPcapWriter::reserve(const size_t length) {
+        if (_fileFd < 0) { throw CanException("Capture is closed!", _fileFd); }
+
+        if (_bufferUsed + length > _buffer.size()) {
+            flush();
+            if (length > _buffer.size()) { _buffer.resize(length); }
+        }
+
+        auto block = _buffer.data() + _bufferUsed;
+        _bufferUsed += length;
+
+        return block;
+    }
+
+    /**
+     * @brief Writes an Enhanced Packet Block with the SocketCAN encapsulation.
+     *
+     * @param dataSize The size of the data area; CAN_MAX_DLEN for classic frames and CANFD_MAX_DLEN for FD frames.
+     */
+    void CanPcapWriter::writePacket(const uint32_t interface, const canid_t id, const uint8_t length, const uint8_t flags, const uint8_t* data, const size_t dataSize, const system_clock::time_point timestamp) {
+        if (interface >= _interfaceCount) { throw CanException("Unknown capture interface!", _fileFd); }
+
+        const auto packetLength = SOCKETCAN_HEADER_SIZE + dataSize;
+        const auto blockLength = 28 + padded(packetLength) + 4;
+        const auto time = static_cast<uint64_t>(duration_cast<nanoseconds>(timestamp.time_since_epoch()).count());
+
+        auto block = reserve(blockLength);
+        put32(block, BLOCK_ENHANCED_PACKET);
+        put32(block + 4, static_cast<uint32_t>(blockLength));
+        put32(block + 8, interface);
+        put32(block + 12, static_cast<uint32_t>(time >> 32));
+        put32(block + 16, static_cast<uint32_t>(time));
+        put32(block + 20, static_cast<uint32_t>(packetLength));
+        put32(block + 24, static_cast<uint32_t>(packetLength));
+
+        auto packet = block + 28;
+        put32(packet, htonl(id));
+        packet[4] = length;
+        packet[5] = flags;
+        packet[6] = 0;
+        packet[7] = 0;
+        memcpy(packet + SOCKETCAN_HEADER_SIZE, data, length);
+        memset(packet + SOCKETCAN_HEADER_SIZE + length, 0, blockLength - 28 - SOCKETCAN_HEADER_SIZE - length - 4);
+        put32(block + blockLength - 4, static_cast<uint32_t>(blockLength));
+
+        _frameCount++;
+    }
+
+    /**
+     * @brief Gets the next complete block and consumes it.
+     *
+     * @param type Receives the block type.
+     * @param length Receives the total length of the block.
+     *
+     * @return const uint8_t* The start of the block, valid until the next call; nullptr at the end of the file.
+     */
+    const uint8_t* CanPcapReader::nextBlock(uint32_t& type, uint32_t& length) {
+        if (!fill(12)) { return nullptr; }
+
+        const auto header = _buffer.data() + _bufferStart;
+        uint32_t rawType = 0;
+        memcpy(&rawType, header, sizeof(rawType));
+
+        // The section header's type reads the same in both byte orders; its magic tells them apart
+        if (rawType == BLOCK_SECTION_HEADER) {
+            uint32_t magic = 0;
+            memcpy(&magic, header + 8, sizeof(magic));
+
+            if (magic == BYTE_ORDER_MAGIC) {
+                _swapped = false;
+            } else if (magic == SWAPPED_BYTE_ORDER_MAGIC) {
+                _swapped = true;
+            } else {
+                throw CanException("Invalid PCAP-NG byte order magic!", _fileFd);
+            }
+        }
+
+        type = read32(header);
+        length = read32(header + 4);
+        if (length < 12 || length % 4) { throw CanException(formatString("Invalid PCAP-NG block length %u!", length), _fileFd); }
+
+        if (!fill(length)) { return nullptr; }
+
+        const auto block = _buffer.data() + _bufferStart;
+        _bufferStart += length;
+
+        return block;
+    }
+
+    /**
+     * @brief Ensures at least length bytes are buffered, reading more of the file if necessary.
+     *
+     * @return false If the file ends first.
+     */
+    bool CanPcapReader::fill(const size_t length) {
+        if (_bufferEnd - _bufferStart >= length) { return true; }
+
+        memmove(_buffer.data(), _buffer.data() + _bufferStart, _bufferEnd - _bufferStart);
+        _bufferEnd -= _bufferStart;
+        _bufferStart = 0;
+
+        if (length > _buffer.size()) { _buffer.resize(length); }
+
+        while (_bufferEnd < length) {
+            const auto result = ::read(_fileFd, _buffer.data() + _bufferEnd, _buffer.size() - _bufferEnd);
+
+            if (result < 0) {
+                if (errno == EINTR) { continue; }
+                throw CanException(formatString("FAILED to read capture! Error: %d => %s", errno, strerror(errno)), _fileFd);
+            }
+
+            if (result == 0) { return false; }
+            _bufferEnd += static_cast<size_t>(result);
+        }
+
+        return true;
+    }
+
+    uint16_t CanPcapReader::read16(const uint8_t* data) const {
+        uint16_t value = 0;
+        memcpy(&value, data, sizeof(value));
+
+        return _swapped ? static_cast<uint16_t>((value >> 8) | (value << 8)) : value;
+    }
+
+    uint32_t CanPcapReader::read32(const uint8_t* data) const {
+        uint32_t value = 0;
+        memcpy(&value, data, sizeof(value));
+
+        return _swapped ? __builtin_bswap32(value) : value;
+    }
+
+    /**
+     * @brief Adds the interface described by an Interface Description Block.
+     */
+    void CanPcapReader::parseInterface(const uint8_t* block, const uint32_t length) {
+        CanPcapInterface interface{};
+        if (length >= 20) { interface.linkType = read16(block + 8); }
+
+        // Options sit between the fixed fields and the trailing length
+        size_t offset = 16;
+        while (offset + 4 <= length - 4) {
+            const auto code = read16(block + offset);
+            const auto optionLength = read16(block + offset + 2);
+            const auto value = block + offset + 4;
+
+            if (code == OPTION_END || offset + 4 + optionLength > length - 4) { break; }
+
+            if (code == OPTION_IF_NAME) {
+                interface.name.assign(reinterpret_cast<const char*>(value), strnlen(reinterpret_cast<const char*>(value), optionLength));
+            } else if (code == OPTION_IF_TSRESOL && optionLength >= 1) {
+                interface.timestampResolution = value[0];
+            }
+
+            offset += 4 + padded(optionLength);
+        }
+
+        _interfaces.push_back(interface);
+    }
+
+    /**
+     * @brief Decodes a SocketCAN packet.
+     *
+     * @return true If the packet belongs to a SocketCAN interface and is long enough.
+     * @return false If it must be skipped.
+     */
+    bool CanPcapReader::parsePacket(const uint8_t* data, const uint32_t length, const uint32_t interface, const uint64_t timestamp, CanPcapFrame& frame) const {
+        if (interface >= _interfaces.size() || _interfaces[interface].linkType != CanPcapWriter::LINKTYPE_CAN_SOCKETCAN) { return false; }
+        if (length < SOCKETCAN_HEADER_SIZE) { return false; }
+
+        uint32_t id = 0;
+        memcpy(&id, data, sizeof(id));
+
+        frame = CanPcapFrame{};
+        frame.frame.can_id = ntohl(id);
+        frame.isFd = (data[5] & CANFD_FDF) || length > CAN_MTU;
+        frame.interface = interface;
+        frame.timestamp = system_clock::time_point(duration_cast<system_clock::duration>(nanoseconds(toNanoseconds(timestamp, _interfaces[interface].timestampResolution))));
+
+        const size_t maxLength = frame.isFd ? CANFD_MAX_DLEN : CAN_MAX_DLEN;
+        const auto payloadLength = std::min<size_t>(std::min<size_t>(data[4], maxLength), length - SOCKETCAN_HEADER_SIZE);
+
+        frame.frame.len = static_cast<uint8_t>(payloadLength);
+        frame.frame.flags = frame.isFd ? static_cast<uint8_t>(data[5] & (CANFD_BRS | CANFD_ESI)) : 0;
+        memcpy(frame.frame.data, data + SOCKETCAN_HEADER_SIZE, payloadLength);
+
+        return true;
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,225 @@
+/**
+ * @file CanRecordAnalyser.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the parallel recording analyser.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanFrameTiming.hpp"
+#include "CanRecordAnalyser.hpp"
+
+namespace sockcanpp {
+
+    using std::atomic;
+    using std::make_pair;
+    using std::pair;
+    using std::thread;
+    using std::unordered_map;
+
+    /**
+     * @brief The result of analysing a run of consecutive blocks.
+     */
+    struct CanRecordAnalyser::Partial {
+        uint64_t                                        records{0};
+        unordered_map<canid_t, CanIdAnalysis>           ids{};
+        map<pair<int32_t, int64_t>, CanBusLoadSample>   busLoad{};
+    };
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new analyser.
+     *
+     * @param reader The recording to analyse. Must outlive the analyser.
+     * @param options What to compute, and how many threads to use.
+     */
+    CanRecordAnalyser::CanRecordAnalyser(const CanRecordReader& reader, const CanRecordAnalysisOptions& options): _reader(reader), _options(options) {
+        if (!_options.blocksPerTask) { _options.blocksPerTask = 1; }
+        if (!_options.bitrate) { _options.bitrate = 1; }
+    }
+#pragma endregion
+
+#pragma region "Analysis"
+    /**
+     * @brief Analyses all records matching a query.
+     *
+     * @param query The records to include.
+     *
+     * @return CanRecordAnalysis The merged result.
+     */
+    CanRecordAnalysis CanRecordAnalyser::analyse(const CanRecordQuery& query) const {
+        const auto firstBlock = _reader.findFirstBlock(query.from);
+        const auto endBlock = _reader.findEndBlock(query.to);
+        const auto blockCount = endBlock > firstBlock ? endBlock - firstBlock : 0;
+        const auto runCount = (blockCount + _options.blocksPerTask - 1) / _options.blocksPerTask;
+
+        vector<Partial> partials(runCount);
+        atomic<size_t> nextRun{0};
+
+        const auto worker = [&]() {
+            for (auto run = nextRun.fetch_add(1); run < runCount; run = nextRun.fetch_add(1)) {
+                const auto first = firstBlock + run * _options.blocksPerTask;
+                analyseRun(first, std::min(first + _options.blocksPerTask, endBlock), query, partials[run]);
+            }
+        };
+
+        auto threadCount = _options.threads ? _options.threads : static_cast<size_t>(thread::hardware_concurrency());
+        threadCount = std::max<size_t>(1, std::min(threadCount, runCount));
+
+        vector<thread> workers{};
+        for (size_t i = 1; i < threadCount; i++) { workers.emplace_back(worker); }
+        worker();
+        for (auto& workerThread : workers) { workerThread.join(); }
+
+        // Merging in file order keeps the result independent of scheduling
+        Partial total{};
+        for (auto& partial : partials) { merge(total, partial); }
+
+        CanRecordAnalysis analysis{};
+        analysis.records = total.records;
+        for (auto& id : total.ids) { analysis.ids[id.first] = std::move(id.second); }
+
+        analysis.busLoad.reserve(total.busLoad.size());
+        for (auto& sample : total.busLoad) {
+            sample.second.load = static_cast<double>(sample.second.bits) / _options.bitrate;
+            analysis.busLoad.push_back(sample.second);
+        }
+
+        return analysis;
+    }
+
+    /**
+     * @brief Computes the amount of bits a frame occupies on the wire, including stuff bits and the interframe space.
+     *
+     * The lengths are exact (see CanFrameTiming), but the data phase of FD frames is counted at the nominal bitrate.
+     *
+     * @param record The recorded frame.
+     *
+     * @return uint64_t The amount of bits.
+     */
+    uint64_t CanRecordAnalyser::estimateFrameBits(const CanRecord& record) {
+        const auto fd = (record.flags & CAN_RECORD_FD) != 0;
+        const uint8_t fdFlags = ((record.flags & CAN_RECORD_BRS) ? CANFD_BRS : 0) | ((record.flags & CAN_RECORD_ESI) ? CANFD_ESI : 0);
+
+        return CanFrameTiming::frameBits(normaliseCanId(record.canId) | (record.canId & CAN_RTR_FLAG), record.data, record.length, fd, fdFlags).bits + CanFrameTiming::INTERFRAME_BITS;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Aggregates the matching records of the blocks [firstBlock, lastBlock).
+     */
+    void CanRecordAnalyser::analyseRun(const size_t firstBlock, const size_t lastBlock, const CanRecordQuery& query, Partial& partial) const {
+        const auto byteHistograms = _options.byteHistograms;
+
+        const auto handler = [&partial, byteHistograms](const CanRecord& record) {
+            const auto key = normaliseCanId(record.canId);
+            auto& id = partial.ids[key];
+
+            if (id.count) {
+                const auto interval = std::max<int64_t>(0, record.timestamp - id.lastTimestamp);
+                id.minInterval = std::min(id.minInterval, interval);
+                id.maxInterval = std::max(id.maxInterval, interval);
+            } else {
+                id.id = key;
+                id.firstTimestamp = record.timestamp;
+            }
+
+            id.count++;
+            id.lastTimestamp = record.timestamp;
+
+            if (byteHistograms) {
+                if (id.byteHistogram.size() < record.length * 256u) { id.byteHistogram.resize(record.length * 256u); }
+                for (uint32_t i = 0; i < record.length; i++) { id.byteHistogram[i * 256 + record.data[i]]++; }
+            }
+
+            const auto second = record.timestamp >= 0 ? record.timestamp / 1000000000 : (record.timestamp + 1) / 1000000000 - 1;
+            auto& sample = partial.busLoad[make_pair(record.ifindex, second)];
+            sample.ifindex = record.ifindex;
+            sample.second = second;
+            sample.frames++;
+            sample.bits += estimateFrameBits(record);
+
+            partial.records++;
+        };
+
+        for (auto block = firstBlock; block < lastBlock; block++) { _reader.scanBlock(block, query, handler); }
+    }
+
+    /**
+     * @brief Appends a partial result to the results of all preceding blocks.
+     *
+     * @param into The result of all earlier blocks.
+     * @param from The result of the directly following run of blocks. Left in an unspecified state.
+     */
+    void CanRecordAnalyser::merge(Partial& into, Partial& from) {
+        into.records += from.records;
+
+        for (auto& entry : from.ids) {
+            auto existing = into.ids.find(entry.first);
+            if (existing == into.ids.end()) {
+                into.ids.insert(std::move(entry));
+                continue;
+            }
+
+            auto& earlier = existing->second;
+            auto& later = entry.second;
+            const auto interval = std::max<int64_t>(0, later.firstTimestamp - earlier.lastTimestamp);
+
+            earlier.minInterval = std::min(std::min(earlier.minInterval, later.minInterval), interval);
+            earlier.maxInterval = std::max(std::max(earlier.maxInterval, later.maxInterval), interval);
+            earlier.count += later.count;
+            earlier.lastTimestamp = later.lastTimestamp;
+
+            if (earlier.byteHistogram.size() < later.byteHistogram.size()) { earlier.byteHistogram.resize(later.byteHistogram.size()); }
+            for (size_t i = 0; i < later.byteHistogram.size(); i++) { earlier.byteHistogram[i] += later.byteHistogram[i]; }
+        }
+
+        for (const auto& entry : from.busLoad) {
+            auto& sample = into.busLoad[entry.first];
+            sample.ifindex = entry.second.ifindex;
+            sample.second = entry.second.second;
+            sample.frames += entry.second.frames;
+            sample.bits += entry.second.bits;
+        }
+    }
+
+} // namespace sockcanpp
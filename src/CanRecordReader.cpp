@@ -0,0 +1,302 @@
+/**
+ * @file CanRecordReader.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the memory-mapped recording reader.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanRecordReader.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    namespace {
+
+        /**
+         * @brief A query with its IDs sorted and hashed, so it can be matched against many blocks.
+         */
+        struct PreparedQuery {
+            explicit PreparedQuery(const CanRecordQuery& query): from(query.from), to(query.to) {
+                for (const auto id : query.ids) {
+                    const auto bit = canRecordIdBit(id);
+                    bitmap[bit / 64] |= uint64_t(1) << (bit % 64);
+                    keys.push_back(normaliseCanId(id));
+                }
+
+                std::sort(keys.begin(), keys.end());
+            }
+
+            bool matchesBlock(const CanRecordBlockInfo& block) const {
+                if (block.maxTimestamp < from || block.minTimestamp > to) { return false; }
+                if (keys.empty()) { return true; }
+
+                return (block.idBitmap[0] & bitmap[0]) || (block.idBitmap[1] & bitmap[1]) || (block.idBitmap[2] & bitmap[2]) || (block.idBitmap[3] & bitmap[3]);
+            }
+
+            bool matchesRecord(const CanRecord& record) const {
+                if (record.timestamp < from || record.timestamp > to) { return false; }
+
+                return keys.empty() || std::binary_search(keys.begin(), keys.end(), normaliseCanId(record.canId));
+            }
+
+            int64_t         from{0};
+            int64_t         to{0};
+            uint64_t        bitmap[4]{};
+            vector<canid_t> keys{};
+        };
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a query for a time window.
+     *
+     * @param from The earliest time to match.
+     * @param to The latest time to match.
+     * @param ids The IDs to match. Empty matches all IDs.
+     */
+    CanRecordQuery::CanRecordQuery(const system_clock::time_point from, const system_clock::time_point to, const vector<canid_t>& ids):
+        from(duration_cast<nanoseconds>(from.time_since_epoch()).count()), to(duration_cast<nanoseconds>(to.time_since_epoch()).count()), ids(ids) { }
+
+    /**
+     * @brief Maps a recording and builds its block index.
+     *
+     * @param path The path of the recording.
+     */
+    CanRecordReader::CanRecordReader(const string& path) {
+        if ((_fileFd = open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), errno, strerror(errno)));
+        }
+
+        struct stat status{};
+        if (fstat(_fileFd, &status) < 0 || static_cast<size_t>(status.st_size) < CanRecordFileHeader::SIZE) {
+            ::close(_fileFd);
+            throw CanInitException(formatString("%s is not a CAN recording!", path.c_str()));
+        }
+
+        _mappingSize = static_cast<size_t>(status.st_size);
+        auto mapping = mmap(nullptr, _mappingSize, PROT_READ, MAP_SHARED, _fileFd, 0);
+        if (mapping == MAP_FAILED) {
+            const auto error = errno;
+            ::close(_fileFd);
+            throw CanInitException(formatString("FAILED to map %s! Error: %d => %s", path.c_str(), error, strerror(error)));
+        }
+
+        _mapping = static_cast<const uint8_t*>(mapping);
+        _header = reinterpret_cast<const CanRecordFileHeader*>(_mapping);
+
+        if (_header->magic != CanRecordFileHeader::MAGIC || _header->version != CanRecordFileHeader::VERSION ||
+            _header->recordSize != sizeof(CanRecord) || _header->headerSize < CanRecordFileHeader::SIZE || _header->headerSize > _mappingSize ||
+            _header->blockSize < sizeof(CanRecordBlockHeader) + sizeof(CanRecord)) {
+            munmap(mapping, _mappingSize);
+            ::close(_fileFd);
+            throw CanInitException(formatString("%s is not a supported CAN recording!", path.c_str()));
+        }
+
+        const auto recordsPerBlock = (_header->blockSize - sizeof(CanRecordBlockHeader)) / sizeof(CanRecord);
+        const auto blockCount = (_mappingSize - _header->headerSize) / _header->blockSize;
+        _blocks.reserve(blockCount);
+
+        for (size_t i = 0; i < blockCount; i++) {
+            const auto offset = _header->headerSize + i * _header->blockSize;
+            const auto block = reinterpret_cast<const CanRecordBlockHeader*>(_mapping + offset);
+
+            // Holes left by failed writes, and blocks which are still being written
+            if (block->magic != CanRecordBlockHeader::MAGIC || !block->recordCount || block->recordCount > recordsPerBlock) { continue; }
+
+            CanRecordBlockInfo info{};
+            info.offset = offset;
+            info.recordCount = block->recordCount;
+            info.minTimestamp = block->minTimestamp;
+            info.maxTimestamp = block->maxTimestamp;
+
+            memcpy(info.idBitmap, block->idBitmap, sizeof(info.idBitmap));
+
+            _blocks.push_back(info);
+            _recordCount += info.recordCount;
+        }
+
+        // Timestamps from several interfaces may interleave slightly, so seek on running extremes
+        _maxTimestampBefore.resize(_blocks.size());
+        _minTimestampAfter.resize(_blocks.size());
+
+        for (size_t i = 0; i < _blocks.size(); i++) {
+            _maxTimestampBefore[i] = i ? std::max(_maxTimestampBefore[i - 1], _blocks[i].maxTimestamp) : _blocks[i].maxTimestamp;
+        }
+
+        for (size_t i = _blocks.size(); i-- > 0;) {
+            _minTimestampAfter[i] = i + 1 < _blocks.size() ? std::min(_minTimestampAfter[i + 1], _blocks[i].minTimestamp) : _blocks[i].minTimestamp;
+        }
+    }
+
+    /**
+     * @brief Unmaps and closes the recording.
+     */
+    CanRecordReader::~CanRecordReader() {
+        munmap(const_cast<uint8_t*>(_mapping), _mappingSize);
+        ::close(_fileFd);
+    }
+#pragma endregion
+
+#pragma region "Queries"
+    /**
+     * @brief Passes all records matching a query to a handler, in file order.
+     *
+     * @param query The records to select.
+     * @param handler Invoked for each matching record.
+     *
+     * @return size_t The amount of matching records.
+     */
+    size_t CanRecordReader::query(const CanRecordQuery& query, const recordhandler_t& handler) const {
+        const PreparedQuery prepared(query);
+        size_t matchingRecords = 0;
+
+        const auto endBlock = findEndBlock(query.to);
+
+        for (auto block = findFirstBlock(query.from); block < endBlock; block++) {
+            if (!prepared.matchesBlock(_blocks[block])) { continue; }
+
+            const auto records = getRecords(block);
+            for (uint32_t i = 0; i < _blocks[block].recordCount; i++) {
+                if (!prepared.matchesRecord(records[i])) { continue; }
+
+                if (handler) { handler(records[i]); }
+                matchingRecords++;
+            }
+        }
+
+        return matchingRecords;
+    }
+
+    /**
+     * @brief Gets all records matching a query, in file order.
+     *
+     * @param query The records to select.
+     *
+     * @return vector<CanRecord> The matching records.
+     */
+    vector<CanRecord> CanRecordReader::query(const CanRecordQuery& query) const {
+        vector<CanRecord> records{};
+
+        this->query(query, [&records](const CanRecord& record) { records.push_back(record); });
+
+        return records;
+    }
+
+    /**
+     * @brief Passes the records of a single block which match a query to a handler.
+     *
+     * Allows blocks to be processed independently, e.g. by several threads.
+     *
+     * @param block The index of the block.
+     * @param query The records to select.
+     * @param handler Invoked for each matching record.
+     *
+     * @return size_t The amount of matching records.
+     */
+    size_t CanRecordReader::scanBlock(const size_t block, const CanRecordQuery& query, const recordhandler_t& handler) const {
+        const PreparedQuery prepared(query);
+        if (!prepared.matchesBlock(_blocks.at(block))) { return 0; }
+
+        const auto records = getRecords(block);
+        size_t matchingRecords = 0;
+
+        for (uint32_t i = 0; i < _blocks[block].recordCount; i++) {
+            if (!prepared.matchesRecord(records[i])) { continue; }
+
+            if (handler) { handler(records[i]); }
+            matchingRecords++;
+        }
+
+        return matchingRecords;
+    }
+
+    /**
+     * @brief Finds the first block which may contain records at or after the given time.
+     *
+     * @param from A timestamp, in nanoseconds since the epoch.
+     *
+     * @return size_t The index of the block, or getBlockCount() if there is none.
+     */
+    size_t CanRecordReader::findFirstBlock(const int64_t from) const {
+        return static_cast<size_t>(std::lower_bound(_maxTimestampBefore.begin(), _maxTimestampBefore.end(), from) - _maxTimestampBefore.begin());
+    }
+
+    /**
+     * @brief Finds the block from which on no block contains records at or before the given time.
+     *
+     * @param to A timestamp, in nanoseconds since the epoch.
+     *
+     * @return size_t The index one past the last block which may contain such records.
+     */
+    size_t CanRecordReader::findEndBlock(const int64_t to) const {
+        return static_cast<size_t>(std::upper_bound(_minTimestampAfter.begin(), _minTimestampAfter.end(), to) - _minTimestampAfter.begin());
+    }
+
+    /**
+     * @brief Determines from the index alone whether a block may contain records matching a query.
+     *
+     * @param block The index of the block.
+     * @param query The records to select.
+     *
+     * @return true If the block's time range overlaps the query and its ID bitmap matches one of the wanted IDs.
+     * @return false If the block can be skipped.
+     */
+    bool CanRecordReader::mayContain(const size_t block, const CanRecordQuery& query) const {
+        return PreparedQuery(query).matchesBlock(_blocks.at(block));
+    }
+
+    /**
+     * @brief Gets a pointer to the first record of a block; getBlock(block).recordCount records are valid.
+     */
+    const CanRecord* CanRecordReader::getRecords(const size_t block) const {
+        return reinterpret_cast<const CanRecord*>(_mapping + _blocks.at(block).offset + sizeof(CanRecordBlockHeader));
+    }
+#pragma endregion
+
+} // namespace sockcanpp
@@ -0,0 +1,464 @@
+/**
+ * @file CanRecorder.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the binary CAN recorder.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanRecorder.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::unique_lock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    constexpr size_t CanRecorder::DEFAULT_BLOCK_SIZE;
+    constexpr uint64_t CanRecordFileHeader::MAGIC;
+    constexpr uint32_t CanRecordFileHeader::VERSION;
+    constexpr size_t CanRecordFileHeader::SIZE;
+    constexpr uint32_t CanRecordBlockHeader::MAGIC;
+
+    namespace {
+
+        /**
+         * @brief Writes all buffers, retrying after partial writes and interruptions.
+         *
+         * @return true If everything was written.
+         * @return false If a write failed; errno is set.
+         */
+        bool writeFully(const int32_t fd, iovec* buffers, int32_t bufferCount, off_t offset) {
+            while (bufferCount > 0) {
+                const auto written = pwritev(fd, buffers, bufferCount, offset);
+
+                if (written < 0) {
+                    if (errno == EINTR) { continue; }
+                    return false;
+                }
+
+                offset += written;
+
+                auto remaining = static_cast<size_t>(written);
+                while (bufferCount > 0 && remaining >= buffers->iov_len) {
+                    remaining -= buffers->iov_len;
+                    buffers++;
+                    bufferCount--;
+                }
+
+                if (bufferCount > 0) {
+                    buffers->iov_base = static_cast<uint8_t*>(buffers->iov_base) + remaining;
+                    buffers->iov_len -= remaining;
+                }
+            }
+
+            return true;
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Creates (or truncates) a recording and starts its writer thread.
+     *
+     * @param path The path of the log file.
+     * @param blockSize The size of a block, in bytes. Must be a multiple of 4096.
+     * @param bufferCount The amount of block buffers. At least two; more buffers absorb longer disk stalls.
+     * @param syncInterval The maximum time between calls to fdatasync() while data is being written.
+     */
+    CanRecorder::CanRecorder(const string& path, const size_t blockSize, const size_t bufferCount, const milliseconds syncInterval):
+        _blockSize(blockSize), _syncInterval(syncInterval), _bufferCount(bufferCount) {
+        if (blockSize < CanRecordFileHeader::SIZE || blockSize % CanRecordFileHeader::SIZE != 0 || blockSize > UINT32_MAX) {
+            throw CanInitException("Block size must be a multiple of 4096!");
+        }
+
+        if (bufferCount < 2 || bufferCount > UINT32_MAX) { throw CanInitException("At least two block buffers are required!"); }
+
+        _recordsPerBlock = (blockSize - sizeof(CanRecordBlockHeader)) / sizeof(CanRecord);
+
+        void* buffers = nullptr;
+        if (posix_memalign(&buffers, CanRecordFileHeader::SIZE, blockSize * bufferCount) != 0) {
+            throw CanInitException("FAILED to allocate block buffers!");
+        }
+
+        _buffers = static_cast<uint8_t*>(buffers);
+        memset(_buffers, 0, blockSize * bufferCount);
+
+        if ((_fileFd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)) < 0) {
+            const auto error = errno;
+            free(_buffers);
+            throw CanInitException(formatString("FAILED to open %s! Error: %d => %s", path.c_str(), error, strerror(error)));
+        }
+
+        // Written through the first block buffer, which is still unused
+        auto header = reinterpret_cast<CanRecordFileHeader*>(_buffers);
+        header->magic = CanRecordFileHeader::MAGIC;
+        header->version = CanRecordFileHeader::VERSION;
+        header->headerSize = CanRecordFileHeader::SIZE;
+        header->blockSize = static_cast<uint32_t>(blockSize);
+        header->recordSize = sizeof(CanRecord);
+        header->created = duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+
+        if (pwrite(_fileFd, _buffers, CanRecordFileHeader::SIZE, 0) != static_cast<ssize_t>(CanRecordFileHeader::SIZE)) {
+            const auto error = errno;
+            ::close(_fileFd);
+            free(_buffers);
+            throw CanInitException(formatString("FAILED to write the header of %s! Error: %d => %s", path.c_str(), error, strerror(error)));
+        }
+
+        memset(_buffers, 0, CanRecordFileHeader::SIZE);
+        _bytesWritten = CanRecordFileHeader::SIZE;
+
+        _freeBlocks.slots.resize(bufferCount);
+        _fullBlocks.slots.resize(bufferCount);
+        for (uint32_t i = 0; i < bufferCount; i++) { _freeBlocks.push(i); }
+
+        _writer = thread(&CanRecorder::writerLoop, this);
+    }
+
+    /**
+     * @brief Writes all pending blocks and closes the recording.
+     */
+    CanRecorder::~CanRecorder() {
+        close();
+        free(_buffers);
+    }
+#pragma endregion
+
+#pragma region "Recording"
+    /**
+     * @brief Records a classic CAN frame.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received or sent.
+     * @param flags Additional CanRecordFlags, e.g. CAN_RECORD_TX.
+     *
+     * @return true If the frame was recorded.
+     * @return false If it was dropped because no block buffer was free, or the recording is closed.
+     */
+    bool CanRecorder::record(const can_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        const auto length = std::min<uint8_t>(frame.can_dlc, CAN_MAX_DLEN);
+
+        return append(frame.can_id, frame.data, length, flags & ~CAN_RECORD_FD, ifindex, timestamp);
+    }
+
+    /**
+     * @brief Records a CAN FD frame.
+     *
+     * CAN_RECORD_FD is always set; the bit rate switch and error state indicator are taken from the frame.
+     *
+     * @param frame The frame to record.
+     * @param ifindex The index of the interface the frame was seen on.
+     * @param timestamp The time the frame was received or sent.
+     * @param flags Additional CanRecordFlags, e.g. CAN_RECORD_TX.
+     *
+     * @return true If the frame was recorded.
+     * @return false If it was dropped because no block buffer was free, or the recording is closed.
+     */
+    bool CanRecorder::record(const canfd_frame& frame, const int32_t ifindex, const system_clock::time_point timestamp, const uint8_t flags) {
+        return append(frame.can_id, frame.data, std::min<uint8_t>(frame.len, CANFD_MAX_DLEN), canRecordFdFlags(frame, flags), ifindex, timestamp);
+    }
+
+    /**
+     * @brief Records a message.
+     *
+     * @param message The message to record.
+     * @param ifindex The index of the interface the message was seen on.
+     * @param timestamp The time the message was received or sent.
+     *
+     * @return true If the message was recorded.
+     * @return false If it was dropped because no block buffer was free, or the recording is closed.
+     */
+    bool CanRecorder::record(const CanMessage& message, const int32_t ifindex, const system_clock::time_point timestamp) {
+        return record(message.getRawFrame(), ifindex, timestamp);
+    }
+
+    /**
+     * @brief Waits for frames on a driver and records all of them.
+     *
+     * If no frames arrive within the timeout, the current block is flushed so idle periods don't hold back data.
+     *
+     * @param driver The driver to read from.
+     * @param ifindex The index of the driver's interface.
+     * @param timeout The maximum time to wait for frames.
+     *
+     * @return size_t The amount of frames read.
+     */
+    size_t CanRecorder::receiveFrom(CanDriver& driver, const int32_t ifindex, const milliseconds timeout) {
+        if (!driver.waitForMessages(timeout)) {
+            flush();
+            return 0;
+        }
+
+        return readCanRecordBatches(driver, [&](const can_frame& frame, const system_clock::time_point timestamp) { record(frame, ifindex, timestamp); });
+    }
+
+    /**
+     * @brief Hands the current block to the writer, even if it isn't full.
+     *
+     * Must be called from the recording thread.
+     */
+    void CanRecorder::flush() { sealBlock(); }
+
+    /**
+     * @brief Writes all pending blocks, syncs and closes the file. Further frames are rejected.
+     *
+     * Must be called from the recording thread, or once recording has stopped.
+     */
+    void CanRecorder::close() {
+        if (_fileFd < 0) { return; }
+
+        sealBlock();
+
+        {
+            unique_lock<mutex> locky(_lock);
+            _stopping = true;
+        }
+
+        _blocksAvailable.notify_one();
+        if (_writer.joinable()) { _writer.join(); }
+
+        ::close(_fileFd);
+        _fileFd = -1;
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the recorder's statistics.
+     */
+    CanRecorderStatistics CanRecorder::getStatistics() const {
+        CanRecorderStatistics statistics{};
+        statistics.recorded = _recorded.load(memory_order_relaxed);
+        statistics.dropped = _dropped.load(memory_order_relaxed);
+        statistics.blocksWritten = _blocksWritten.load(memory_order_relaxed);
+        statistics.bytesWritten = _bytesWritten.load(memory_order_relaxed);
+        statistics.syncs = _syncs.load(memory_order_relaxed);
+        statistics.writeErrors = _writeErrors.load(memory_order_relaxed);
+
+        return statistics;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Appends a buffer index. Only a single thread may push, and the queue must not be full.
+     */
+    void CanRecorder::IndexQueue::push(const uint32_t index) {
+        const auto position = tail.load(memory_order_relaxed);
+
+        slots[position % slots.size()] = index;
+        tail.store(position + 1, memory_order_release);
+    }
+
+    /**
+     * @brief Removes the oldest buffer index. Only a single thread may pop.
+     */
+    bool CanRecorder::IndexQueue::pop(uint32_t& index) {
+        const auto position = head.load(memory_order_relaxed);
+        if (position == tail.load(memory_order_acquire)) { return false; }
+
+        index = slots[position % slots.size()];
+        head.store(position + 1, memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Copies a frame into the next record of the current block, sealing the block once it is full.
+     */
+    bool CanRecorder::append(const uint32_t canId, const uint8_t* data, const uint8_t length, const uint8_t flags, const int32_t ifindex, const system_clock::time_point timestamp) {
+        if (_fileFd < 0) { return false; }
+
+        if (!_hasBlock) {
+            if (!_freeBlocks.pop(_currentBlock)) {
+                _dropped.fetch_add(1, memory_order_relaxed);
+                return false;
+            }
+
+            auto header = reinterpret_cast<CanRecordBlockHeader*>(_buffers + _currentBlock * _blockSize);
+            header->magic = CanRecordBlockHeader::MAGIC;
+            header->recordCount = 0;
+            header->sequence = _nextSequence++;
+            header->minTimestamp = INT64_MAX;
+            header->maxTimestamp = INT64_MIN;
+            _hasBlock = true;
+        }
+
+        auto block = _buffers + _currentBlock * _blockSize;
+        auto header = reinterpret_cast<CanRecordBlockHeader*>(block);
+        auto record = reinterpret_cast<CanRecord*>(block + sizeof(CanRecordBlockHeader)) + header->recordCount;
+
+        record->timestamp = duration_cast<nanoseconds>(timestamp.time_since_epoch()).count();
+        record->canId = canId;
+        record->ifindex = ifindex;
+        record->length = length;
+        record->flags = flags;
+        memcpy(record->data, data, length);
+
+        const auto bit = canRecordIdBit(canId);
+        header->idBitmap[bit / 64] |= uint64_t(1) << (bit % 64);
+
+        if (record->timestamp < header->minTimestamp) { header->minTimestamp = record->timestamp; }
+        if (record->timestamp > header->maxTimestamp) { header->maxTimestamp = record->timestamp; }
+
+        _recorded.fetch_add(1, memory_order_relaxed);
+        if (++header->recordCount == _recordsPerBlock) { sealBlock(); }
+
+        return true;
+    }
+
+    /**
+     * @brief Hands the current block to the writer thread, if it contains any records.
+     */
+    void CanRecorder::sealBlock() {
+        if (!_hasBlock || !reinterpret_cast<CanRecordBlockHeader*>(_buffers + _currentBlock * _blockSize)->recordCount) { return; }
+
+        {
+            // Only held for the hand-over; the writer never holds the lock while writing
+            unique_lock<mutex> locky(_lock);
+            _fullBlocks.push(_currentBlock);
+        }
+
+        _hasBlock = false;
+        _blocksAvailable.notify_one();
+    }
+
+    /**
+     * @brief Writes full blocks as they arrive and syncs the file at most once per sync interval.
+     */
+    void CanRecorder::writerLoop() {
+        vector<uint32_t> blocks{};
+        blocks.reserve(_bufferCount);
+
+        auto lastSync = steady_clock::now();
+        bool unsynced = false;
+
+        while (true) {
+            bool stopping = false;
+
+            {
+                unique_lock<mutex> locky(_lock);
+                _blocksAvailable.wait_for(locky, _syncInterval, [this]() { return _stopping || !_fullBlocks.empty(); });
+                stopping = _stopping;
+            }
+
+            uint32_t index = 0;
+            while (_fullBlocks.pop(index)) { blocks.push_back(index); }
+
+            if (!blocks.empty()) {
+                writeBlocks(blocks);
+                unsynced = true;
+
+                for (const auto block : blocks) {
+                    memset(_buffers + block * _blockSize, 0, _blockSize);
+                    _freeBlocks.push(block);
+                }
+
+                blocks.clear();
+            }
+
+            const auto now = steady_clock::now();
+            if (unsynced && (stopping || now - lastSync >= _syncInterval)) {
+                fdatasync(_fileFd);
+                _syncs.fetch_add(1, memory_order_relaxed);
+                lastSync = now;
+                unsynced = false;
+            }
+
+            if (stopping && _fullBlocks.empty()) { break; }
+        }
+    }
+
+    /**
+     * @brief Writes blocks to their place in the file, merging consecutive blocks into a single system call.
+     *
+     * A block which can't be written leaves a zeroed hole, which readers skip.
+     */
+    void CanRecorder::writeBlocks(const vector<uint32_t>& blocks) {
+        vector<iovec> buffers{};
+        buffers.reserve(blocks.size());
+
+        size_t first = 0;
+        while (first < blocks.size()) {
+            const auto firstSequence = reinterpret_cast<CanRecordBlockHeader*>(_buffers + blocks[first] * _blockSize)->sequence;
+            size_t count = 0;
+            buffers.clear();
+
+            while (first + count < blocks.size() && count < IOV_MAX) {
+                const auto block = _buffers + blocks[first + count] * _blockSize;
+                if (reinterpret_cast<CanRecordBlockHeader*>(block)->sequence != firstSequence + count) { break; }
+
+                iovec buffer{};
+                buffer.iov_base = block;
+                buffer.iov_len = _blockSize;
+                buffers.push_back(buffer);
+                count++;
+            }
+
+            const auto offset = static_cast<off_t>(CanRecordFileHeader::SIZE + firstSequence * _blockSize);
+
+            if (writeFully(_fileFd, buffers.data(), static_cast<int32_t>(count), offset)) {
+                _blocksWritten.fetch_add(count, memory_order_relaxed);
+                _bytesWritten.fetch_add(count * _blockSize, memory_order_relaxed);
+            } else {
+                _writeErrors.fetch_add(1, memory_order_relaxed);
+            }
+
+            first += count;
+        }
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,259 @@
+/**
+ * @file CanReplayer.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the timing-faithful replay engine.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanReplayer.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::memcpy;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    constexpr double CanReplayer::AS_FAST_AS_POSSIBLE;
+
+    namespace {
+
+        constexpr int64_t MAX_SLEEP_NS = 100000000; //!< Long gaps are slept in slices, so stop() takes effect quickly
+        constexpr int64_t SEND_RETRY_NS = 100000;   //!< The pause between attempts while the driver's TX buffer is full
+        constexpr int32_t SEND_RETRY_LIMIT = 100;
+
+        int64_t toNanoseconds(const system_clock::time_point timestamp) { return duration_cast<nanoseconds>(timestamp.time_since_epoch()).count(); }
+
+        int64_t toNanoseconds(const steady_clock::time_point time) { return duration_cast<nanoseconds>(time.time_since_epoch()).count(); }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new replayer.
+     *
+     * @param speed The speed factor; AS_FAST_AS_POSSIBLE ignores the recorded timing.
+     * @param clock The clock frames are scheduled on.
+     */
+    CanReplayer::CanReplayer(const double speed, const shared_ptr<CanClock>& clock): _clock(clock ? clock : CanSteadyClock::getDefault()) { setSpeed(speed); }
+#pragma endregion
+
+#pragma region "Configuration"
+    /**
+     * @brief Sends frames recorded on an interface index through a driver.
+     *
+     * @param ifindex The interface index stored in the recording.
+     * @param driver The driver to send with. Must outlive the replayer.
+     */
+    void CanReplayer::mapInterface(const int32_t ifindex, CanDriver& driver) { _driversByIndex[ifindex] = &driver; }
+
+    /**
+     * @brief Sends frames recorded on a named interface through a driver.
+     *
+     * @param name The interface name stored in the log or capture.
+     * @param driver The driver to send with. Must outlive the replayer.
+     */
+    void CanReplayer::mapInterface(const string& name, CanDriver& driver) { _driversByName[name] = &driver; }
+
+    /**
+     * @brief Sets the speed factor.
+     *
+     * @param speed 1.0 replays in real time, 0.5 at half speed and 100.0 a hundred times faster.
+     *              AS_FAST_AS_POSSIBLE sends frames back to back.
+     */
+    void CanReplayer::setSpeed(const double speed) {
+        if (!(speed >= 0)) { throw CanException("Replay speed must not be negative!", -1); }
+
+        _speed = speed;
+    }
+#pragma endregion
+
+#pragma region "Replay"
+    /**
+     * @brief Replays the records of a binary recording matching a query.
+     *
+     * @param reader The recording.
+     * @param query The records to replay.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t CanReplayer::replay(const CanRecordReader& reader, const CanRecordQuery& query) {
+        begin();
+        size_t framesSent = 0;
+
+        reader.query(query, [this, &framesSent](const CanRecord& record) {
+            if (_stopping) { return; }
+
+            const auto driver = _driversByIndex.find(record.ifindex);
+            const auto isFd = (record.flags & CAN_RECORD_FD) != 0;
+            if (send(driver == _driversByIndex.end() ? nullptr : driver->second, record.canId, record.data, record.length, isFd, record.timestamp)) { framesSent++; }
+        });
+
+        return framesSent;
+    }
+
+    /**
+     * @brief Replays a candump log from its current position.
+     *
+     * @param reader The log.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t CanReplayer::replay(CanCandumpReader& reader) {
+        begin();
+        CanCandumpFrame frame{};
+        size_t framesSent = 0;
+        string interface{};
+
+        while (!_stopping && reader.next(frame)) {
+            interface.assign(frame.interface, frame.interfaceLength);
+
+            const auto driver = _driversByName.find(interface);
+            if (send(driver == _driversByName.end() ? nullptr : driver->second, frame.frame.can_id, frame.frame.data, frame.frame.len, frame.isFd, toNanoseconds(frame.timestamp))) {
+                framesSent++;
+            }
+        }
+
+        return framesSent;
+    }
+
+    /**
+     * @brief Replays a PCAP-NG capture from its current position.
+     *
+     * @param reader The capture.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t CanReplayer::replay(CanPcapReader& reader) {
+        begin();
+        CanPcapFrame frame{};
+        size_t framesSent = 0;
+
+        while (!_stopping && reader.next(frame)) {
+            CanDriver* driver = nullptr;
+
+            if (frame.interface < reader.getInterfaces().size()) {
+                const auto mapped = _driversByName.find(reader.getInterfaces()[frame.interface].name);
+                if (mapped != _driversByName.end()) { driver = mapped->second; }
+            }
+
+            if (send(driver, frame.frame.can_id, frame.frame.data, frame.frame.len, frame.isFd, toNanoseconds(frame.timestamp))) { framesSent++; }
+        }
+
+        return framesSent;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Resets the timing reference, so the next frame is sent immediately.
+     */
+    void CanReplayer::begin() {
+        _stopping = false;
+        _started = false;
+    }
+
+    /**
+     * @brief Waits for a frame's deadline and sends it.
+     *
+     * @return true If the frame was sent.
+     * @return false If it was skipped, not accepted, or the replay was stopped.
+     */
+    bool CanReplayer::send(CanDriver* driver, const canid_t id, const uint8_t* data, const uint8_t length, const bool isFd, const int64_t timestamp) {
+        if (!driver) {
+            _statistics.unmapped++;
+            return false;
+        }
+
+        if (isFd) {
+            _statistics.unsupported++;
+            return false;
+        }
+
+        if (!_started) {
+            _started = true;
+            _firstTimestamp = timestamp;
+            _replayStart = toNanoseconds(_clock->now());
+        }
+
+        auto deadline = _replayStart;
+        if (_speed != AS_FAST_AS_POSSIBLE) {
+            deadline += static_cast<int64_t>(static_cast<double>(timestamp - _firstTimestamp) / _speed);
+            if (!waitUntil(deadline)) { return false; }
+        }
+
+        can_frame frame{};
+        frame.can_id = id;
+        frame.can_dlc = std::min<uint8_t>(length, CAN_MAX_DLEN);
+        memcpy(frame.data, data, frame.can_dlc);
+
+        for (int32_t attempt = 0; !driver->sendFrames(&frame, 1); attempt++) {
+            if (attempt == SEND_RETRY_LIMIT || _stopping) {
+                _statistics.failed++;
+                return false;
+            }
+
+            _clock->sleepFor(nanoseconds(SEND_RETRY_NS));
+        }
+
+        if (_speed != AS_FAST_AS_POSSIBLE) { _timingError.record(nanoseconds(toNanoseconds(_clock->now()) - deadline)); }
+        _statistics.sent++;
+
+        return true;
+    }
+
+    /**
+     * @brief Sleeps until an absolute time on the replayer's clock.
+     *
+     * @return true If the deadline was reached.
+     * @return false If the replay was stopped first.
+     */
+    bool CanReplayer::waitUntil(const int64_t deadline) {
+        while (!_stopping) {
+            const auto now = toNanoseconds(_clock->now());
+            if (now >= deadline) { return true; }
+
+            _clock->sleepUntil(steady_clock::time_point(duration_cast<steady_clock::duration>(nanoseconds(std::min(deadline, now + MAX_SLEEP_NS)))));
+        }
+
+        return false;
+    }
+
+} // namespace sockcanpp
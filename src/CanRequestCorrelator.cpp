@@ -0,0 +1,322 @@
+/**
+ * @file CanRequestCorrelator.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the request/response correlator.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanRequestCorrelator.hpp"
+#include "exceptions/CanTimeoutException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanTimeoutException;
+
+    using std::make_exception_ptr;
+    using std::make_shared;
+    using std::promise;
+    using std::unique_lock;
+
+    using std::shared_ptr;
+
+    constexpr canid_t CanRequestCorrelator::EXACT_MATCH;
+
+    namespace {
+
+        /**
+         * @brief Creates a handler which fulfils the given promise.
+         */
+        responsehandler_t promiseHandler(const shared_ptr<promise<CanMessage>>& response) {
+            return [response](const CanMessage* message) {
+                if (message) {
+                    response->set_value(*message);
+                } else {
+                    response->set_exception(make_exception_ptr(CanTimeoutException("Timed out waiting for response!")));
+                }
+            };
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new correlator.
+     *
+     * @param resolution The granularity of request timeouts.
+     * @param clock The clock measuring request timeouts.
+     */
+    CanRequestCorrelator::CanRequestCorrelator(const nanoseconds resolution, const shared_ptr<CanClock>& clock):
+        _clock(clock ? clock : CanSteadyClock::getDefault()), _timeouts(resolution, _clock->now()) { }
+#pragma endregion
+
+#pragma region "Requests"
+    /**
+     * @brief Registers an expected response.
+     *
+     * A received message matches if (id & mask) == (responseId & mask). IDs above 0x7FF are treated
+     * as extended IDs, whether or not CAN_EFF_FLAG is set.
+     *
+     * @param responseId The ID of the expected response.
+     * @param mask The mask applied when matching; EXACT_MATCH matches a single ID.
+     * @param timeout The time after which the request fails.
+     * @param handler Invoked with the response, or with nullptr if the request timed out.
+     *
+     * @return requestid_t The ID of the request, which can be used to cancel it.
+     */
+    requestid_t CanRequestCorrelator::expectResponse(const CanId responseId, const canid_t mask, const milliseconds timeout, const responsehandler_t& handler) {
+        unique_lock<mutex> locky(_lock);
+
+        const auto request = _nextRequest++;
+        auto& pending = _pending[request];
+        pending.id = normaliseCanId(*responseId);
+        pending.mask = mask;
+        pending.exact = isExactMask(pending.id, mask);
+        pending.handler = handler;
+        pending.timer = _timeouts.schedule(_clock->now() + timeout, request);
+
+        if (pending.exact) {
+            auto& requests = _exactRequests[pending.id & EXACT_MATCH];
+            pending.position = requests.insert(requests.end(), request);
+        } else {
+            pending.position = _maskedRequests.insert(_maskedRequests.end(), request);
+        }
+
+        return request;
+    }
+
+    /**
+     * @brief Registers an expected response.
+     *
+     * @param responseId The ID of the expected response.
+     * @param mask The mask applied when matching; EXACT_MATCH matches a single ID.
+     * @param timeout The time after which the request fails.
+     *
+     * @return future<CanMessage> Resolves to the response, or throws CanTimeoutException.
+     */
+    future<CanMessage> CanRequestCorrelator::expectResponse(const CanId responseId, const canid_t mask, const milliseconds timeout) {
+        auto response = make_shared<promise<CanMessage>>();
+
+        expectResponse(responseId, mask, timeout, promiseHandler(response));
+
+        return response->get_future();
+    }
+
+    /**
+     * @brief Registers the expected response and sends a request.
+     *
+     * The response is registered before the request is sent, so a fast response can't be missed.
+     * If sending fails, the registration is removed and the exception is propagated.
+     *
+     * @param driver The driver to send the request with.
+     * @param request The request to send.
+     * @param responseId The ID of the expected response.
+     * @param timeout The time after which the request fails.
+     * @param mask The mask applied when matching.
+     *
+     * @return future<CanMessage> Resolves to the response, or throws CanTimeoutException.
+     */
+    future<CanMessage> CanRequestCorrelator::sendRequest(CanDriver& driver, const CanMessage& request, const CanId responseId, const milliseconds timeout, const canid_t mask) {
+        auto response = make_shared<promise<CanMessage>>();
+        auto result = response->get_future();
+
+        const auto requestId = expectResponse(responseId, mask, timeout, promiseHandler(response));
+
+        try {
+            driver.sendMessage(request);
+        } catch (...) {
+            cancel(requestId);
+            throw;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Cancels an outstanding request. Its handler is not invoked.
+     *
+     * @param request The ID of the request.
+     *
+     * @return true If the request was outstanding.
+     * @return false Otherwise.
+     */
+    bool CanRequestCorrelator::cancel(const requestid_t request) {
+        unique_lock<mutex> locky(_lock);
+
+        return remove(request);
+    }
+#pragma endregion
+
+#pragma region "Receive Path"
+    /**
+     * @brief Completes the oldest outstanding request matching a received message.
+     *
+     * The message is not consumed; it should still be passed on to any other consumers.
+     * Error frames never complete a request.
+     *
+     * @param message The received message.
+     *
+     * @return true If the message completed a request.
+     * @return false Otherwise.
+     */
+    bool CanRequestCorrelator::onMessage(const CanMessage& message) {
+        if (message.getCanId().hasErrorFrameFlag()) { return false; }
+
+        const auto id = normaliseCanId(*message.getCanId());
+        responsehandler_t handler{};
+
+        {
+            unique_lock<mutex> locky(_lock);
+            requestid_t match = 0;
+
+            const auto exact = _exactRequests.find(id & EXACT_MATCH);
+            if (exact != _exactRequests.end() && !exact->second.empty()) { match = exact->second.front(); }
+
+            // Ranged requests only win if they were registered earlier
+            for (const auto request : _maskedRequests) {
+                if (match && request > match) { break; }
+
+                const auto& pending = _pending.at(request);
+                if ((id & pending.mask) == (pending.id & pending.mask)) {
+                    match = request;
+                    break;
+                }
+            }
+
+            if (!match) { return false; }
+
+            remove(match, &handler);
+        }
+
+        if (handler) { handler(&message); }
+
+        return true;
+    }
+
+    /**
+     * @brief Times out all requests whose deadline has passed, according to the correlator's clock.
+     *
+     * @return size_t The amount of requests which timed out.
+     */
+    size_t CanRequestCorrelator::expire() { return expire(_clock->now()); }
+
+    /**
+     * @brief Times out all requests whose deadline has passed.
+     *
+     * Call this periodically, e.g. after each call to CanDriver::waitForMessages().
+     *
+     * @param now The current time.
+     *
+     * @return size_t The amount of requests which timed out.
+     */
+    size_t CanRequestCorrelator::expire(const steady_clock::time_point now) {
+        vector<responsehandler_t> expired{};
+
+        {
+            unique_lock<mutex> locky(_lock);
+
+            _timeouts.advance(now, [this, &expired](uint64_t request) {
+                auto entry = _pending.find(request);
+                if (entry == _pending.end()) { return; }
+
+                entry->second.timer = CanTimerWheel::INVALID_TIMER; // already fired
+                expired.emplace_back();
+                remove(request, &expired.back());
+            });
+        }
+
+        for (const auto& handler : expired) {
+            if (handler) { handler(nullptr); }
+        }
+
+        return expired.size();
+    }
+
+    /**
+     * @brief Gets the amount of outstanding requests.
+     */
+    size_t CanRequestCorrelator::getPendingCount() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _pending.size();
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Determines whether a mask selects exactly one ID.
+     */
+    bool CanRequestCorrelator::isExactMask(const canid_t id, const canid_t mask) {
+        const canid_t required = (id & CAN_EFF_FLAG) ? (CAN_EFF_FLAG | CAN_EFF_MASK) : (CAN_EFF_FLAG | CAN_SFF_MASK);
+
+        return (mask & required) == required;
+    }
+
+    /**
+     * @brief Removes a request from all indices. The lock must be held.
+     *
+     * @param request The request to remove.
+     * @param handler If not nullptr, receives the request's handler.
+     *
+     * @return true If the request was outstanding.
+     * @return false Otherwise.
+     */
+    bool CanRequestCorrelator::remove(const requestid_t request, responsehandler_t* handler) {
+        auto entry = _pending.find(request);
+        if (entry == _pending.end()) { return false; }
+
+        auto& pending = entry->second;
+
+        if (pending.timer != CanTimerWheel::INVALID_TIMER) { _timeouts.cancel(pending.timer); }
+
+        if (pending.exact) {
+            auto requests = _exactRequests.find(pending.id & EXACT_MATCH);
+            requests->second.erase(pending.position);
+            if (requests->second.empty()) { _exactRequests.erase(requests); }
+        } else {
+            _maskedRequests.erase(pending.position);
+        }
+
+        if (handler) { *handler = std::move(pending.handler); }
+        _pending.erase(entry);
+
+        return true;
+    }
+
+} // namespace sockcanpp
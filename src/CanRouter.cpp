@@ -0,0 +1,329 @@
+/**
+ * @file CanRouter.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the userspace CAN gateway.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanRouter.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::chrono::steady_clock;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    constexpr uint16_t CanRouter::NO_ROUTE;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Configuration"
+    /**
+     * @brief Adds a bus to the router.
+     *
+     * @param driver The driver for the bus. Must outlive the router.
+     *
+     * @return size_t The index of the bus, used when adding routes.
+     */
+    size_t CanRouter::addBus(CanDriver& driver) {
+        Bus bus{};
+        bus.driver = &driver;
+        bus.txFrames.reserve(CanDriver::CAN_MAX_BATCH_SIZE);
+        bus.txRoutes.reserve(CanDriver::CAN_MAX_BATCH_SIZE);
+
+        _buses.push_back(std::move(bus));
+        _pollFds.push_back({ driver.getSocketFd(), POLLIN, 0 });
+        _compiled = false;
+
+        return _buses.size() - 1;
+    }
+
+    /**
+     * @brief Adds a route to the router.
+     *
+     * Routes are matched in the order they were added.
+     *
+     * @param route The route to add.
+     *
+     * @return size_t The index of the route, used to query its statistics.
+     */
+    size_t CanRouter::addRoute(const CanRoute& route) {
+        if (route.sourceBus >= _buses.size() || (route.action != CanRouteAction::Drop && route.targetBus >= _buses.size())) {
+            throw CanException("Route references an unknown bus!", -1);
+        }
+
+        if (_routes.size() >= NO_ROUTE) { throw CanException("Too many routes!", -1); }
+
+        if (route.action == CanRouteAction::Transform && !route.transform) { throw CanException("Transform route has no transform!", -1); }
+
+        _routes.push_back(route);
+        _counters.emplace_back(new RouteCounters());
+        _compiled = false;
+
+        return _routes.size() - 1;
+    }
+
+    /**
+     * @brief Builds the per-bus lookup tables from the configured routes.
+     *
+     * This is called automatically by @ref processOnce() if the configuration changed,
+     * but may be called beforehand to keep the first call fast.
+     */
+    void CanRouter::compile() {
+        constexpr canid_t exactExtendedMask = CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG | CAN_EFF_MASK;
+
+        for (auto& bus : _buses) {
+            bus.standardIds.assign(CAN_SFF_MASK + 1, NO_ROUTE);
+            bus.extendedIds.clear();
+            bus.maskedRoutes.clear();
+            bus.allRoutes.clear();
+        }
+
+        for (uint16_t i = 0; i < _routes.size(); i++) {
+            const auto& route = _routes[i];
+            auto& bus = _buses[route.sourceBus];
+
+            bus.allRoutes.push_back(i);
+
+            for (canid_t id = 0; id <= CAN_SFF_MASK; id++) {
+                if (bus.standardIds[id] == NO_ROUTE && matches(route, id)) { bus.standardIds[id] = i; }
+            }
+
+            // Routes which match exactly one extended data frame are hashed; the first route wins
+            if ((route.mask & exactExtendedMask) == exactExtendedMask && (route.id & CAN_EFF_FLAG) && !(route.id & (CAN_RTR_FLAG | CAN_ERR_FLAG))) {
+                bus.extendedIds.insert({ route.id & (CAN_EFF_FLAG | CAN_EFF_MASK), i });
+            } else if (matches(route, (route.id & CAN_EFF_MASK) | CAN_EFF_FLAG)) {
+                bus.maskedRoutes.push_back(i);
+            }
+        }
+
+        _compiled = true;
+    }
+#pragma endregion
+
+#pragma region "Processing"
+    /**
+     * @brief Waits for frames on any bus, then routes all pending frames.
+     *
+     * @param timeout The maximum time to wait for frames.
+     *
+     * @return size_t The amount of frames received.
+     */
+    size_t CanRouter::processOnce(milliseconds timeout) {
+        if (!_compiled) { compile(); }
+
+        const auto readyCount = poll(_pollFds.data(), _pollFds.size(), static_cast<int>(timeout.count()));
+
+        if (readyCount < 0) {
+            if (errno == EINTR) { return 0; }
+            throw CanException(formatString("FAILED to poll CAN buses! Error: %d => %s", errno, strerror(errno)), -1);
+        }
+
+        size_t totalFrames = 0;
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE];
+
+        for (size_t busIndex = 0; busIndex < _buses.size() && readyCount > 0; busIndex++) {
+            if (!(_pollFds[busIndex].revents & POLLIN)) { continue; }
+
+            auto& source = _buses[busIndex];
+            size_t frameCount = 0;
+
+            do {
+                frameCount = source.driver->readFrames(frames, CanDriver::CAN_MAX_BATCH_SIZE);
+                const auto batchRead = steady_clock::now();
+                totalFrames += frameCount;
+
+                for (size_t i = 0; i < frameCount; i++) {
+                    auto& frame = frames[i];
+                    const auto routeIndex = lookup(source, frame.can_id);
+
+                    if (routeIndex == NO_ROUTE) {
+                        increment(_unroutedFrames);
+                        continue;
+                    }
+
+                    const auto& route = _routes[routeIndex];
+                    auto& counters = *_counters[routeIndex];
+                    increment(counters.matched);
+
+                    switch (route.action) {
+                        case CanRouteAction::Drop:
+                            increment(counters.dropped);
+                            continue;
+                        case CanRouteAction::RewriteId:
+                            frame.can_id = (frame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)) | *route.newId;
+                            if ((*route.newId & CAN_EFF_MASK) > CAN_SFF_MASK) { frame.can_id |= CAN_EFF_FLAG; }
+                            break;
+                        case CanRouteAction::Transform:
+                            if (!route.transform(frame)) {
+                                increment(counters.dropped);
+                                continue;
+                            }
+                            break;
+                        case CanRouteAction::Forward:
+                        default: break;
+                    }
+
+                    auto& target = _buses[route.targetBus];
+                    target.txFrames.push_back(frame);
+                    target.txRoutes.push_back(routeIndex);
+
+                    if (target.txFrames.size() == CanDriver::CAN_MAX_BATCH_SIZE) { flush(target, batchRead); }
+                }
+
+                for (auto& target : _buses) {
+                    if (!target.txFrames.empty()) { flush(target, batchRead); }
+                }
+            } while (frameCount == CanDriver::CAN_MAX_BATCH_SIZE);
+        }
+
+        return totalFrames;
+    }
+
+    /**
+     * @brief Routes frames until @ref stop() is called from another thread.
+     */
+    void CanRouter::run() {
+        _running = true;
+
+        while (_running) { processOnce(); }
+    }
+#pragma endregion
+
+#pragma region "Statistics"
+    /**
+     * @brief Gets a snapshot of the counters of a route.
+     *
+     * @param route The index of the route, as returned by @ref addRoute().
+     *
+     * @return CanRouteStatistics The route's counters.
+     */
+    CanRouteStatistics CanRouter::getRouteStatistics(const size_t route) const {
+        if (route >= _counters.size()) { throw CanException("Unknown route!", -1); }
+
+        const auto& counters = *_counters[route];
+        CanRouteStatistics statistics{};
+        statistics.matched = counters.matched.load(std::memory_order_relaxed);
+        statistics.forwarded = counters.forwarded.load(std::memory_order_relaxed);
+        statistics.dropped = counters.dropped.load(std::memory_order_relaxed);
+        statistics.txFailed = counters.txFailed.load(std::memory_order_relaxed);
+
+        return statistics;
+    }
+
+    /**
+     * @brief Clears all route counters and the processing time histogram.
+     */
+    void CanRouter::resetStatistics() {
+        for (auto& counters : _counters) {
+            counters->matched = 0;
+            counters->forwarded = 0;
+            counters->dropped = 0;
+            counters->txFailed = 0;
+        }
+
+        _unroutedFrames = 0;
+        _processingTime.reset();
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Finds the first route matching a frame ID on the given bus.
+     *
+     * @param bus The bus the frame was received on.
+     * @param id The raw ID of the frame, including flags.
+     *
+     * @return uint16_t The index of the route, or NO_ROUTE.
+     */
+    uint16_t CanRouter::lookup(const Bus& bus, const canid_t id) const {
+        if (!(id & (CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG))) { return bus.standardIds[id & CAN_SFF_MASK]; }
+
+        if ((id & (CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG)) == CAN_EFF_FLAG) {
+            const auto exact = bus.extendedIds.find(id);
+            const auto best = exact == bus.extendedIds.end() ? NO_ROUTE : exact->second;
+
+            for (const auto routeIndex : bus.maskedRoutes) {
+                if (routeIndex > best) { break; }
+                if (matches(_routes[routeIndex], id)) { return routeIndex; }
+            }
+
+            return best;
+        }
+
+        for (const auto routeIndex : bus.allRoutes) {
+            if (matches(_routes[routeIndex], id)) { return routeIndex; }
+        }
+
+        return NO_ROUTE;
+    }
+
+    /**
+     * @brief Sends all frames waiting for the given bus and updates the counters.
+     *
+     * Frames which cannot be sent because the interface's queue is full are dropped.
+     *
+     * @param bus The bus to flush.
+     * @param batchRead The time the frames' batch was read from its source bus.
+     */
+    void CanRouter::flush(Bus& bus, const steady_clock::time_point batchRead) {
+        size_t sent = 0;
+
+        while (sent < bus.txFrames.size()) {
+            const auto batchSent = bus.driver->sendFrames(bus.txFrames.data() + sent, bus.txFrames.size() - sent);
+            if (batchSent == 0) { break; }
+            sent += batchSent;
+        }
+
+        if (sent) { _processingTime.record(duration_cast<nanoseconds>(steady_clock::now() - batchRead), sent); }
+
+        for (size_t i = 0; i < bus.txRoutes.size(); i++) {
+            increment(i < sent ? _counters[bus.txRoutes[i]]->forwarded : _counters[bus.txRoutes[i]]->txFailed);
+        }
+
+        bus.txFrames.clear();
+        bus.txRoutes.clear();
+    }
+
+} // namespace sockcanpp
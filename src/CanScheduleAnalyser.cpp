@@ -0,0 +1,291 @@
+/**
+ * @file CanScheduleAnalyser.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the response-time analysis.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanFrameTiming.hpp"
+#include "CanScheduleAnalyser.hpp"
+#include "CanSimulatedBus.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::deque;
+    using std::make_shared;
+    using std::mt19937;
+    using std::shared_ptr;
+    using std::uniform_int_distribution;
+    using std::unordered_map;
+
+    namespace {
+
+        int64_t ceilDiv(const int64_t value, const int64_t divisor) { return value <= 0 ? 0 : (value + divisor - 1) / divisor; }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new analyser.
+     *
+     * @param bitrate The bus's bitrate, in bits per second.
+     */
+    CanScheduleAnalyser::CanScheduleAnalyser(const uint32_t bitrate): _bitrate(bitrate) {
+        if (!bitrate) { throw CanException("The bitrate must be greater than zero!", -1); }
+    }
+#pragma endregion
+
+#pragma region "Analysis"
+    /**
+     * @brief Computes the worst-case queuing and response time of each message.
+     *
+     * @param messages The messages sent on the bus. IDs must be unique and periods greater than zero.
+     *
+     * @return CanScheduleAnalysis The timing of each message, highest priority first.
+     */
+    CanScheduleAnalysis CanScheduleAnalyser::analyse(const vector<CanScheduledMessage>& messages) const {
+        const auto entries = prioritise(messages);
+        const int64_t bitTime = (1000000000 + _bitrate - 1) / _bitrate; // rounded up, so the analysis stays pessimistic
+
+        CanScheduleAnalysis analysis{};
+        analysis.schedulable = true;
+
+        for (const auto& entry : entries) { analysis.utilisation += static_cast<double>(entry.transmission) / static_cast<double>(entry.period); }
+
+        int64_t lowerPriorityBlocking = 0;
+        vector<int64_t> blocking(entries.size(), 0);
+        for (auto i = entries.size(); i > 0; i--) {
+            blocking[i - 1] = lowerPriorityBlocking;
+            lowerPriorityBlocking = std::max(lowerPriorityBlocking, entries[i - 1].transmission);
+        }
+
+        double higherUtilisation = 0;
+
+        for (size_t m = 0; m < entries.size(); m++) {
+            const auto& message = entries[m];
+            const auto transmission = message.transmission;
+
+            CanMessageResponse response{};
+            response.id = CanId(message.id);
+            response.transmissionTime = nanoseconds(transmission);
+            response.blocking = nanoseconds(blocking[m]);
+            response.deadline = nanoseconds(message.deadline);
+
+            higherUtilisation += static_cast<double>(transmission) / static_cast<double>(message.period);
+
+            if (higherUtilisation >= 1.0) {
+                // The busy period never ends; this and all lower priority messages are starved
+                response.queuingDelay = response.responseTime = nanoseconds::max();
+                analysis.schedulable = false;
+                analysis.messages.push_back(response);
+                continue;
+            }
+
+            // The longest busy period of priority m and higher
+            int64_t busyPeriod = transmission;
+            while (true) {
+                int64_t next = blocking[m];
+                for (size_t k = 0; k <= m; k++) { next += ceilDiv(busyPeriod + entries[k].jitter, entries[k].period) * entries[k].transmission; }
+
+                if (next == busyPeriod) { break; }
+                busyPeriod = next;
+            }
+
+            // Every instance released within the busy period may be the one with the longest response time
+            const auto instances = ceilDiv(busyPeriod + message.jitter, message.period);
+            int64_t worstQueuingDelay = 0;
+            int64_t worstResponse = 0;
+
+            for (int64_t q = 0; q < instances && worstResponse <= message.deadline; q++) {
+                const auto ownInstances = blocking[m] + q * transmission;
+                auto queuing = ownInstances;
+
+                while (true) {
+                    // A higher priority message released up to one bit time after w still wins arbitration
+                    auto next = ownInstances;
+                    for (size_t k = 0; k < m; k++) { next += ceilDiv(queuing + entries[k].jitter + bitTime, entries[k].period) * entries[k].transmission; }
+
+                    if (next == queuing) { break; }
+                    queuing = next;
+
+                    if (message.jitter + queuing - q * message.period + transmission > message.deadline) { break; }
+                }
+
+                worstQueuingDelay = std::max(worstQueuingDelay, queuing - q * message.period);
+                worstResponse = std::max(worstResponse, message.jitter + queuing - q * message.period + transmission);
+            }
+
+            response.queuingDelay = nanoseconds(worstQueuingDelay);
+            response.responseTime = nanoseconds(worstResponse);
+            response.schedulable = worstResponse <= message.deadline;
+            analysis.schedulable = analysis.schedulable && response.schedulable;
+
+            analysis.messages.push_back(response);
+        }
+
+        return analysis;
+    }
+
+    /**
+     * @brief Analyses the messages, then simulates them on a CanSimulatedBus and records the observed response times.
+     *
+     * All messages are released at time zero (the critical instant) and then periodically; each instance is
+     * queued after a random delay of up to its jitter. The response time of an instance is measured from its
+     * periodic release to the end of its transmission.
+     *
+     * @param messages The messages sent on the bus.
+     * @param duration The simulated duration.
+     * @param seed Seeds the random jitter, so runs are reproducible.
+     *
+     * @return CanScheduleAnalysis The analysis, with observedResponseTime and observedFrames filled in.
+     */
+    CanScheduleAnalysis CanScheduleAnalyser::validate(const vector<CanScheduledMessage>& messages, const nanoseconds duration, const uint32_t seed) const {
+        auto analysis = analyse(messages);
+        const auto entries = prioritise(messages);
+
+        auto bus = make_shared<CanSimulatedBus>(_bitrate);
+        vector<shared_ptr<CanDriver>> nodes{};
+        vector<deque<int64_t>> releases(entries.size());
+        unordered_map<int32_t, size_t> senders{};
+        mt19937 random(seed);
+
+        const auto simulation = bus.get(); // actions must not own the bus they're scheduled on
+
+        for (size_t i = 0; i < entries.size(); i++) {
+            // Nodes only send; an empty filter list keeps the other nodes' frames out of their sockets
+            nodes.push_back(make_shared<CanDriver>("sim0", CAN_RAW, bus, filtermap_t{}));
+            senders[nodes.back()->getSocketFd()] = i;
+
+            const auto node = nodes.back().get();
+            const auto& entry = entries[i];
+            auto& released = releases[i];
+
+            can_frame frame{};
+            frame.can_id = entry.id;
+            frame.can_dlc = messages[entry.index].length;
+
+            const auto send = [node, frame]() { node->sendFrames(&frame, 1); };
+
+            bus->every(nanoseconds(entry.period), [simulation, send, &released, &random, entry]() {
+                const auto now = simulation->now().count();
+                const auto delay = entry.jitter ? uniform_int_distribution<int64_t>(0, entry.jitter)(random) : 0;
+
+                released.push_back(now);
+                if (delay) {
+                    simulation->schedule(nanoseconds(now + delay), send);
+                } else {
+                    send();
+                }
+            });
+        }
+
+        bus->setTransmissionHandler([&](const CanSimulatedTransmission& transmission) {
+            const auto sender = senders.find(transmission.senderFd);
+            if (sender == senders.end() || releases[sender->second].empty()) { return; }
+
+            auto& response = analysis.messages[sender->second];
+            const auto responseTime = nanoseconds(transmission.finished.count() - releases[sender->second].front());
+            releases[sender->second].pop_front();
+
+            response.observedResponseTime = std::max(response.observedResponseTime, responseTime);
+            response.observedFrames++;
+        });
+
+        bus->runFor(duration);
+
+        return analysis;
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the worst-case transmission time of a classic frame, including the interframe space.
+     *
+     * @param id The frame's ID. IDs above 0x7FF are treated as extended IDs.
+     * @param length The amount of payload bytes.
+     */
+    nanoseconds CanScheduleAnalyser::transmissionTime(const CanId id, const uint8_t length) const {
+        const auto bits = CanFrameTiming::worstCaseFrameBits((normaliseCanId(*id) & CAN_EFF_FLAG) != 0, length) + CanFrameTiming::INTERFRAME_BITS;
+
+        return nanoseconds((static_cast<int64_t>(bits) * 1000000000 + _bitrate - 1) / _bitrate);
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Validates the messages and sorts them by priority, highest first.
+     */
+    vector<CanScheduleAnalyser::Entry> CanScheduleAnalyser::prioritise(const vector<CanScheduledMessage>& messages) const {
+        vector<Entry> entries{};
+        entries.reserve(messages.size());
+
+        for (size_t i = 0; i < messages.size(); i++) {
+            const auto& message = messages[i];
+            if (message.period.count() <= 0) { throw CanException("Message periods must be greater than zero!", -1); }
+            if (message.length > CAN_MAX_DLEN) { throw CanException("Classic CAN frames carry at most 8 bytes!", -1); }
+
+            Entry entry{};
+            entry.id = normaliseCanId(*message.id);
+            entry.index = i;
+            entry.period = message.period.count();
+            entry.jitter = std::max(message.jitter.count(), int64_t(0));
+            entry.deadline = message.deadline.count() > 0 ? message.deadline.count() : entry.period;
+            entry.transmission = transmissionTime(CanId(entry.id), message.length).count();
+            entries.push_back(entry);
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            return CanFrameTiming::arbitrationKey(lhs.id) < CanFrameTiming::arbitrationKey(rhs.id);
+        });
+
+        for (size_t i = 1; i < entries.size(); i++) {
+            if (entries[i].id == entries[i - 1].id) { throw CanException("Message IDs must be unique!", -1); }
+        }
+
+        return entries;
+    }
+
+} // namespace sockcanpp
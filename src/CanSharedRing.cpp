@@ -0,0 +1,406 @@
+/**
+ * @file CanSharedRing.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the shared-memory frame distribution ring.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <string>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanSharedRing.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanInitException;
+
+    using std::atomic_thread_fence;
+    using std::memcpy;
+    using std::memory_order_acquire;
+    using std::memory_order_relaxed;
+    using std::memory_order_release;
+    using std::memory_order_seq_cst;
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    static_assert(sizeof(can_frame) == 2 * sizeof(uint64_t), "can_frame is expected to be 16 bytes!");
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2, "Shared memory requires lock-free atomics!");
+
+    constexpr uint64_t CanSharedRingHeader::MAGIC;
+    constexpr uint32_t CanSharedRingHeader::VERSION;
+
+    namespace {
+
+        /**
+         * @brief Gets the size of the header area; records start on the following page.
+         */
+        size_t headerAreaSize() {
+            const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            return ((sizeof(CanSharedRingHeader) + pageSize - 1) / pageSize) * pageSize;
+        }
+
+        /**
+         * @brief Wrapper for the futex system call, which glibc doesn't expose.
+         */
+        long futex(atomic<uint32_t>* word, const int32_t operation, const uint32_t value, const timespec* timeout) {
+            return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), operation, value, timeout, nullptr, 0);
+        }
+
+    }
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Publisher"
+    /**
+     * @brief Creates a new, empty ring in a sealed memfd.
+     *
+     * @param capacity The amount of frames the ring holds. Rounded up to the next power of two.
+     * @param name The name of the memfd, as shown in /proc/<pid>/fd.
+     */
+    CanSharedRingPublisher::CanSharedRingPublisher(const size_t capacity, const string& name) {
+        uint64_t recordCount = 2;
+        while (recordCount < capacity) { recordCount <<= 1; }
+
+        const auto dataOffset = headerAreaSize();
+        _mappingSize = dataOffset + recordCount * sizeof(CanSharedRingRecord);
+
+        if ((_memoryFd = memfd_create(name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING)) < 0) {
+            throw CanInitException(formatString("FAILED to create shared memory! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        // Sealing the size prevents consumers from truncating the region under everybody else's feet
+        if (ftruncate(_memoryFd, static_cast<off_t>(_mappingSize)) < 0 || fcntl(_memoryFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0) {
+            const auto error = errno;
+            close(_memoryFd);
+            throw CanInitException(formatString("FAILED to size shared memory! Error: %d => %s", error, strerror(error)));
+        }
+
+        auto mapping = mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _memoryFd, 0);
+        if (mapping == MAP_FAILED) {
+            const auto error = errno;
+            close(_memoryFd);
+            throw CanInitException(formatString("FAILED to map shared memory! Error: %d => %s", error, strerror(error)));
+        }
+
+        // The memfd is zero-filled, which is a valid state for all records
+        _header = new (mapping) CanSharedRingHeader;
+        _header->magic = CanSharedRingHeader::MAGIC;
+        _header->version = CanSharedRingHeader::VERSION;
+        _header->recordSize = sizeof(CanSharedRingRecord);
+        _header->capacity = recordCount;
+        _header->dataOffset = dataOffset;
+        _header->head.store(0, memory_order_relaxed);
+        _header->notify.store(0, memory_order_relaxed);
+        _header->waiters.store(0, memory_order_release);
+
+        _records = reinterpret_cast<CanSharedRingRecord*>(static_cast<uint8_t*>(mapping) + dataOffset);
+        _mask = recordCount - 1;
+    }
+
+    /**
+     * @brief Unmaps and closes the ring. Attached consumers keep their mappings.
+     */
+    CanSharedRingPublisher::~CanSharedRingPublisher() {
+        if (_header) { munmap(_header, _mappingSize); }
+        if (_memoryFd >= 0) { close(_memoryFd); }
+    }
+
+    /**
+     * @brief Publishes a single frame.
+     *
+     * @param frame The frame to publish.
+     * @param received The time the frame was received.
+     */
+    void CanSharedRingPublisher::publish(const can_frame& frame, const steady_clock::time_point received) {
+        write(frame, received.time_since_epoch().count());
+        commit();
+    }
+
+    /**
+     * @brief Publishes a batch of frames, waking waiting consumers at most once.
+     *
+     * @param frames The frames to publish.
+     * @param frameCount The amount of frames.
+     * @param received The time the frames were received.
+     */
+    void CanSharedRingPublisher::publish(const can_frame* frames, const size_t frameCount, const steady_clock::time_point received) {
+        if (!frameCount) { return; }
+
+        for (size_t i = 0; i < frameCount; i++) { write(frames[i], received.time_since_epoch().count()); }
+
+        commit();
+    }
+
+    /**
+     * @brief Waits for frames on a driver and publishes everything that is queued.
+     *
+     * Call this in a loop from the thread owning the driver.
+     *
+     * @param driver The driver to receive frames from.
+     * @param timeout The maximum time to wait for frames.
+     *
+     * @return size_t The amount of frames published.
+     */
+    size_t CanSharedRingPublisher::receiveFrom(CanDriver& driver, const milliseconds timeout) {
+        if (!driver.waitForMessages(timeout)) { return 0; }
+
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE];
+        size_t publishedFrames = 0;
+
+        while (true) {
+            const auto framesRead = driver.readFrames(frames, CanDriver::CAN_MAX_BATCH_SIZE);
+            if (!framesRead) { break; }
+
+            publish(frames, framesRead);
+            publishedFrames += framesRead;
+
+            if (framesRead < CanDriver::CAN_MAX_BATCH_SIZE) { break; }
+        }
+
+        return publishedFrames;
+    }
+#pragma endregion
+
+#pragma region "Consumer"
+    /**
+     * @brief Attaches to a ring.
+     *
+     * The file descriptor is not taken over and may be closed once the consumer has been constructed.
+     *
+     * @param memoryFd The publisher's memfd, or a duplicate of it.
+     */
+    CanSharedRingConsumer::CanSharedRingConsumer(const int32_t memoryFd) {
+        struct stat status{};
+        if (fstat(memoryFd, &status) < 0) {
+            throw CanInitException(formatString("FAILED to inspect shared memory! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        _headerSize = headerAreaSize();
+        if (static_cast<size_t>(status.st_size) < _headerSize) { throw CanInitException("Shared memory is too small to contain a ring!"); }
+
+        // Only the header is writable, so the waiter count can be maintained
+        auto header = mmap(nullptr, _headerSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+        if (header == MAP_FAILED) {
+            throw CanInitException(formatString("FAILED to map shared memory! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        _header = static_cast<CanSharedRingHeader*>(header);
+
+        const auto capacity = _header->capacity;
+        const auto valid = _header->magic == CanSharedRingHeader::MAGIC && _header->version == CanSharedRingHeader::VERSION &&
+                           _header->recordSize == sizeof(CanSharedRingRecord) && _header->dataOffset == _headerSize &&
+                           capacity >= 2 && (capacity & (capacity - 1)) == 0 &&
+                           static_cast<uint64_t>(status.st_size) >= _headerSize + capacity * sizeof(CanSharedRingRecord);
+
+        if (!valid) {
+            munmap(_header, _headerSize);
+            throw CanInitException("Shared memory does not contain a compatible ring!");
+        }
+
+        _recordsSize = capacity * sizeof(CanSharedRingRecord);
+        auto records = mmap(nullptr, _recordsSize, PROT_READ, MAP_SHARED, memoryFd, static_cast<off_t>(_headerSize));
+        if (records == MAP_FAILED) {
+            const auto error = errno;
+            munmap(_header, _headerSize);
+            throw CanInitException(formatString("FAILED to map shared memory! Error: %d => %s", error, strerror(error)));
+        }
+
+        _records = static_cast<const CanSharedRingRecord*>(records);
+        _mask = capacity - 1;
+        _position = _header->head.load(memory_order_acquire);
+    }
+
+    /**
+     * @brief Detaches from the ring.
+     */
+    CanSharedRingConsumer::~CanSharedRingConsumer() {
+        if (_records) { munmap(const_cast<CanSharedRingRecord*>(_records), _recordsSize); }
+        if (_header) { munmap(_header, _headerSize); }
+    }
+
+    /**
+     * @brief Reads the frames published since the last call.
+     *
+     * If the publisher overwrote frames before they could be read, reading resumes at a recent frame
+     * and the skipped frames are added to the lost count.
+     *
+     * @param frames Receives the frames.
+     * @param maxFrames The maximum amount of frames to read.
+     *
+     * @return size_t The amount of frames read.
+     */
+    size_t CanSharedRingConsumer::read(CanSharedFrame* frames, const size_t maxFrames) {
+        size_t framesRead = 0;
+
+        while (framesRead < maxFrames) {
+            const auto& record = _records[_position & _mask];
+            const auto expected = 2 * _position + 2;
+
+            const auto sequence = record.sequence.load(memory_order_acquire);
+            if (sequence < expected) { break; } // not published yet
+
+            if (sequence > expected) {
+                resynchronise();
+                continue;
+            }
+
+            uint64_t words[2] = { record.words[0].load(memory_order_relaxed), record.words[1].load(memory_order_relaxed) };
+            const auto received = record.received.load(memory_order_relaxed);
+
+            atomic_thread_fence(memory_order_acquire);
+            if (record.sequence.load(memory_order_relaxed) != expected) {
+                resynchronise();
+                continue;
+            }
+
+            auto& frame = frames[framesRead++];
+            memcpy(&frame.frame, words, sizeof(words));
+            frame.received = steady_clock::time_point(steady_clock::duration(received));
+            frame.position = _position++;
+        }
+
+        return framesRead;
+    }
+
+    /**
+     * @brief Waits until unread frames are available.
+     *
+     * @param timeout The maximum time to wait.
+     *
+     * @return true If frames are available.
+     * @return false If the timeout elapsed.
+     */
+    bool CanSharedRingConsumer::waitForFrames(const milliseconds timeout) {
+        if (getAvailableCount()) { return true; }
+
+        // Registering as a waiter before re-checking pairs with the publisher storing head before checking for waiters
+        _header->waiters.fetch_add(1, memory_order_seq_cst);
+        const auto notify = _header->notify.load(memory_order_seq_cst);
+
+        auto available = getAvailableCount() > 0;
+        if (!available) {
+            const auto waitTime = duration_cast<nanoseconds>(timeout);
+            timespec timeToWait{};
+            timeToWait.tv_sec = static_cast<time_t>(waitTime.count() / 1000000000);
+            timeToWait.tv_nsec = static_cast<long>(waitTime.count() % 1000000000);
+
+            futex(&_header->notify, FUTEX_WAIT, notify, &timeToWait);
+            available = getAvailableCount() > 0;
+        }
+
+        _header->waiters.fetch_sub(1, memory_order_seq_cst);
+
+        return available;
+    }
+
+    /**
+     * @brief Discards all unread frames; they are not counted as lost.
+     */
+    void CanSharedRingConsumer::skipToLatest() {
+        _position = _header->head.load(memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the amount of frames published but not yet read.
+     */
+    size_t CanSharedRingConsumer::getAvailableCount() const {
+        const auto head = _header->head.load(memory_order_seq_cst);
+
+        return head > _position ? static_cast<size_t>(head - _position) : 0;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Writes a frame to the next record. Not visible to consumers until @ref commit() is called.
+     */
+    void CanSharedRingPublisher::write(const can_frame& frame, const int64_t received) {
+        uint64_t words[2];
+        memcpy(words, &frame, sizeof(words));
+
+        auto& record = _records[_head & _mask];
+
+        record.sequence.store(2 * _head + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+
+        record.words[0].store(words[0], memory_order_relaxed);
+        record.words[1].store(words[1], memory_order_relaxed);
+        record.received.store(received, memory_order_relaxed);
+
+        record.sequence.store(2 * _head + 2, memory_order_release);
+        _head++;
+    }
+
+    /**
+     * @brief Publishes the new head and wakes waiting consumers, if there are any.
+     */
+    void CanSharedRingPublisher::commit() {
+        _header->head.store(_head, memory_order_seq_cst);
+
+        if (_header->waiters.load(memory_order_seq_cst)) {
+            _header->notify.fetch_add(1, memory_order_seq_cst);
+            futex(&_header->notify, FUTEX_WAKE, INT_MAX, nullptr);
+        }
+    }
+
+    /**
+     * @brief Skips ahead after the publisher overwrote unread frames.
+     *
+     * Resumes a quarter of a ring's length after the oldest frame still in the ring, so the consumer
+     * isn't immediately overrun again.
+     */
+    void CanSharedRingConsumer::resynchronise() {
+        const auto head = _header->head.load(memory_order_acquire);
+        const auto capacity = _mask + 1;
+
+        auto position = head > capacity ? head - capacity + capacity / 4 : 0;
+        if (position <= _position) { position = _position + 1; } // head lags the records during a batch
+
+        _lostFrames += position - _position;
+        _position = position;
+    }
+
+} // namespace sockcanpp
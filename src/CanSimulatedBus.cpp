@@ -0,0 +1,412 @@
+/**
+ * @file CanSimulatedBus.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the CAN bus simulator.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanFrameTiming.hpp"
+#include "CanSimulatedBus.hpp"
+#include "exceptions/CanCloseException.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanCloseException;
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::make_shared;
+    using std::chrono::duration_cast;
+
+    constexpr uint32_t CanSimulatedBus::INTERFRAME_BITS;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+    /**
+     * @brief Gets the exact length of a classic frame on the wire.
+     *
+     * @param frame The frame.
+     *
+     * @return uint32_t The length in bits, including stuff bits; excluding the interframe space.
+     */
+    uint32_t CanSimulatedBus::frameBits(const can_frame& frame) { return CanFrameTiming::frameBits(frame).bits; }
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new, idle bus at simulated time zero.
+     *
+     * @param bitrate The bus's bitrate, in bits per second.
+     */
+    CanSimulatedBus::CanSimulatedBus(const uint32_t bitrate): _bitrate(bitrate), _clock(make_shared<CanManualClock>()) {
+        if (!bitrate) { throw CanInitException("The bitrate of a simulated bus must be greater than zero!"); }
+
+        if ((_epollFd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to create simulated bus! Error: %d => %s", errno, strerror(errno)));
+        }
+    }
+
+    /**
+     * @brief Closes the simulator's ends of all sockets.
+     */
+    CanSimulatedBus::~CanSimulatedBus() {
+        for (const auto& node : _nodes) {
+            if (node.busFd >= 0) { close(node.busFd); }
+        }
+
+        close(_epollFd);
+    }
+#pragma endregion
+
+#pragma region "Sockets"
+    /**
+     * @brief Adds a node to the bus.
+     *
+     * @param canInterface Ignored; all nodes share the bus.
+     * @param canProtocol Ignored.
+     * @param filters The filters to apply.
+     *
+     * @return int32_t The node's socket.
+     */
+    int32_t CanSimulatedBus::openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) {
+        (void)canInterface;
+        (void)canProtocol;
+
+        int32_t sockets[2]{};
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, sockets) < 0) {
+            throw CanInitException(formatString("FAILED to open simulated CAN socket! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = _nodes.size();
+
+        if (epoll_ctl(_epollFd, EPOLL_CTL_ADD, sockets[1], &event) < 0) {
+            const auto error = errno;
+            close(sockets[0]);
+            close(sockets[1]);
+            throw CanInitException(formatString("FAILED to open simulated CAN socket! Error: %d => %s", error, strerror(error)));
+        }
+
+        _nodes.emplace_back();
+        auto& node = _nodes.back();
+        node.busFd = sockets[1];
+        node.socketFd = sockets[0];
+        node.filters = filters;
+
+        _nodeIndex[sockets[0]] = _nodes.size() - 1;
+
+        return sockets[0];
+    }
+
+    /**
+     * @brief Removes a node from the bus. Frames it already sent are still transmitted.
+     *
+     * @param socketFd The node's socket.
+     */
+    void CanSimulatedBus::closeSocket(const int32_t socketFd) {
+        auto existing = _nodeIndex.find(socketFd);
+        if (existing == _nodeIndex.end()) { throw CanCloseException(formatString("Socket %d does not belong to this simulated bus!", socketFd)); }
+
+        collect();
+
+        auto& node = _nodes[existing->second];
+        epoll_ctl(_epollFd, EPOLL_CTL_DEL, node.busFd, nullptr);
+        close(node.busFd);
+        node.busFd = -1;
+        node.socketFd = -1;
+        _nodeIndex.erase(existing);
+
+        if (close(socketFd) == -1) { throw CanCloseException(formatString("FAILED to close simulated CAN socket! Error: %d => %s", errno, strerror(errno))); }
+    }
+#pragma endregion
+
+#pragma region "Socket Options"
+    /**
+     * @brief Replaces a node's receive filters.
+     *
+     * @param socketFd The node's socket.
+     * @param filters The filters to apply.
+     */
+    void CanSimulatedBus::setFilters(const int32_t socketFd, const vector<can_filter>& filters) {
+        auto existing = _nodeIndex.find(socketFd);
+        if (existing == _nodeIndex.end()) { throw CanInitException(formatString("Socket %d does not belong to this simulated bus!", socketFd)); }
+
+        _nodes[existing->second].filters = filters;
+    }
+
+    /**
+     * @brief Echoing a node's own frames is not supported; enabling it throws.
+     *
+     * @param socketFd The node's socket.
+     * @param enabled Whether or not transmitted frames are echoed.
+     */
+    void CanSimulatedBus::setReceiveOwnMessages(const int32_t socketFd, const bool enabled) {
+        if (enabled) { throw CanException("The simulated bus does not support echoing a socket's own frames!", socketFd); }
+    }
+#pragma endregion
+
+#pragma region "Simulation"
+    /**
+     * @brief Runs an action at a point in simulated time.
+     *
+     * Actions scheduled for the same time run in the order they were scheduled; times in the past run immediately.
+     *
+     * @param at The simulated time to run the action at.
+     * @param action The action, e.g. a node sending a frame.
+     */
+    void CanSimulatedBus::schedule(const nanoseconds at, const simulationaction_t& action) {
+        Action entry{};
+        entry.at = std::max(at, _now);
+        entry.sequence = _nextAction++;
+        entry.action = action;
+
+        _actions.push(entry);
+    }
+
+    /**
+     * @brief Runs an action periodically.
+     *
+     * @param period The interval between two runs.
+     * @param action The action, e.g. a node sending its cyclic frames.
+     * @param offset The delay from now until the first run.
+     */
+    void CanSimulatedBus::every(const nanoseconds period, const simulationaction_t& action, const nanoseconds offset) {
+        if (period.count() <= 0) { throw CanException("The period of a simulated action must be greater than zero!", -1); }
+
+        Action entry{};
+        entry.at = _now + std::max(offset, nanoseconds(0));
+        entry.sequence = _nextAction++;
+        entry.period = period;
+        entry.action = action;
+
+        _actions.push(entry);
+    }
+
+    /**
+     * @brief Runs the simulation up to the given simulated time.
+     *
+     * Events happening at the same time are processed in this order: a frame finishing (and being delivered),
+     * scheduled actions, then arbitration for the next frame. A frame whose transmission extends beyond the end
+     * is completed by the next run.
+     *
+     * @param end The simulated time to stop at.
+     *
+     * @return size_t The amount of frames transmitted.
+     */
+    size_t CanSimulatedBus::runUntil(const nanoseconds end) {
+        const auto never = nanoseconds::max();
+        size_t transmittedFrames = 0;
+
+        collect();
+
+        while (true) {
+            const auto finishAt = _transmitting ? _transmission.finished : never;
+            const auto actionAt = _actions.empty() ? never : _actions.top().at;
+            const auto startAt = !_transmitting && _pendingFrames ? std::max(_now, _busIdleAt) : never;
+            const auto next = std::min(finishAt, std::min(actionAt, startAt));
+
+            if (next == never || next > end) { break; }
+
+            setNow(next);
+
+            if (finishAt == next) {
+                finishTransmission();
+                transmittedFrames++;
+            } else if (actionAt == next) {
+                auto action = _actions.top();
+                _actions.pop();
+
+                if (action.period.count() > 0) {
+                    auto repetition = action;
+                    repetition.at += action.period;
+                    repetition.sequence = _nextAction++;
+                    _actions.push(repetition);
+                }
+
+                action.action();
+            } else {
+                startTransmission();
+                continue;
+            }
+
+            collect();
+        }
+
+        if (end > _now) { setNow(end); }
+
+        return transmittedFrames;
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the fraction of the simulated time the bus spent transmitting frames and interframe spaces.
+     */
+    double CanSimulatedBus::getBusLoad() const {
+        if (_now.count() <= 0) { return 0; }
+
+        return static_cast<double>(_statistics.busy.count()) / static_cast<double>(_now.count());
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Moves all frames sent by the nodes since the last call into their transmit queues.
+     */
+    void CanSimulatedBus::collect() {
+        epoll_event events[CanDriver::CAN_MAX_BATCH_SIZE];
+        int32_t eventCount = 0;
+
+        do {
+            eventCount = epoll_wait(_epollFd, events, CanDriver::CAN_MAX_BATCH_SIZE, 0);
+
+            for (int32_t i = 0; i < eventCount; i++) {
+                auto& node = _nodes[static_cast<size_t>(events[i].data.u64)];
+                canfd_frame frame{};
+
+                while (node.busFd >= 0) {
+                    const auto length = recv(node.busFd, &frame, sizeof(frame), MSG_DONTWAIT);
+
+                    if (length == 0) {
+                        // The node's socket was closed without going through the bus
+                        epoll_ctl(_epollFd, EPOLL_CTL_DEL, node.busFd, nullptr);
+                        close(node.busFd);
+                        node.busFd = -1;
+                        break;
+                    }
+
+                    if (length < 0) { break; }
+
+                    if (length != CAN_MTU) {
+                        _statistics.unsupported++;
+                        continue;
+                    }
+
+                    Queued queued{};
+                    memcpy(&queued.frame, &frame, sizeof(can_frame));
+                    queued.queued = _now;
+                    node.transmitQueue.push_back(queued);
+                    _pendingFrames++;
+                }
+            }
+        } while (eventCount == static_cast<int32_t>(CanDriver::CAN_MAX_BATCH_SIZE));
+    }
+
+    /**
+     * @brief Arbitrates between the head frames of all nodes and starts transmitting the winner.
+     */
+    void CanSimulatedBus::startTransmission() {
+        auto winner = _nodes.size();
+        uint64_t winningKey = 0;
+
+        for (size_t i = 0; i < _nodes.size(); i++) {
+            if (_nodes[i].transmitQueue.empty()) { continue; }
+
+            const auto key = CanFrameTiming::arbitrationKey(_nodes[i].transmitQueue.front().frame.can_id);
+            if (winner == _nodes.size() || key < winningKey) {
+                winner = i;
+                winningKey = key;
+            }
+        }
+
+        auto& queue = _nodes[winner].transmitQueue;
+        const auto queued = queue.front();
+        queue.pop_front();
+        _pendingFrames--;
+
+        _transmitting = true;
+        _transmitter = winner;
+        _transmission = CanSimulatedTransmission{};
+        _transmission.frame = queued.frame;
+        _transmission.senderFd = _nodes[winner].socketFd;
+        _transmission.queued = queued.queued;
+        _transmission.started = _now;
+        _transmission.bits = frameBits(queued.frame);
+        _transmission.finished = _now + bitsToTime(_transmission.bits);
+    }
+
+    /**
+     * @brief Delivers the frame on the bus to all other nodes accepting it and starts the interframe space.
+     */
+    void CanSimulatedBus::finishTransmission() {
+        _transmitting = false;
+        _busIdleAt = _transmission.finished + bitsToTime(INTERFRAME_BITS);
+
+        _statistics.frames++;
+        _statistics.busy += bitsToTime(_transmission.bits + INTERFRAME_BITS);
+
+        const auto id = _transmission.frame.can_id;
+
+        for (size_t i = 0; i < _nodes.size(); i++) {
+            const auto& node = _nodes[i];
+            if (i == _transmitter || node.busFd < 0 || !canFiltersAccept(node.filters, id)) { continue; }
+
+            if (send(node.busFd, &_transmission.frame, sizeof(can_frame), MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {
+                _statistics.dropped++;
+            } else {
+                _statistics.delivered++;
+            }
+        }
+
+        if (_transmissionHandler) { _transmissionHandler(_transmission); }
+    }
+
+    /**
+     * @brief Converts a number of bits to their duration at the bus's bitrate.
+     */
+    nanoseconds CanSimulatedBus::bitsToTime(const uint64_t bits) const {
+        return nanoseconds(static_cast<int64_t>(bits * 1000000000ull / _bitrate));
+    }
+
+    /**
+     * @brief Advances the simulated time and the clock following it.
+     */
+    void CanSimulatedBus::setNow(const nanoseconds now) {
+        _now = now;
+        _clock->advanceTo(steady_clock::time_point(duration_cast<steady_clock::duration>(now)));
+    }
+
+} // namespace sockcanpp
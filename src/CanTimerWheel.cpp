@@ -0,0 +1,315 @@
+/**
+ * @file CanTimerWheel.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the hierarchical timer wheel.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanTimerWheel.hpp"
+
+namespace sockcanpp {
+
+    using std::chrono::duration_cast;
+
+    constexpr timerid_t CanTimerWheel::INVALID_TIMER;
+    constexpr uint32_t CanTimerWheel::LEVEL_COUNT;
+    constexpr uint32_t CanTimerWheel::SLOT_BITS;
+    constexpr uint32_t CanTimerWheel::SLOT_COUNT;
+    constexpr uint8_t CanTimerWheel::NO_LEVEL;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new, empty timer wheel.
+     *
+     * @param resolution The duration of a single tick. Deadlines are rounded up to a multiple of this.
+     * @param origin The point in time corresponding to tick zero.
+     */
+    CanTimerWheel::CanTimerWheel(const nanoseconds resolution, const steady_clock::time_point origin):
+        _resolution(resolution.count() > 0 ? resolution : nanoseconds(1)), _origin(origin) {
+        _firingHead = LEVEL_COUNT * SLOT_COUNT;
+        _overdueHead = _firingHead + 1;
+        _nodes.resize(_overdueHead + 1);
+
+        for (uint32_t i = 0; i <= _overdueHead; i++) { _nodes[i].prev = _nodes[i].next = i; }
+    }
+#pragma endregion
+
+#pragma region "Timers"
+    /**
+     * @brief Schedules a new timer.
+     *
+     * Deadlines in the past expire on the next call to @ref advance().
+     *
+     * @param deadline The point in time at which the timer expires.
+     * @param cookie An opaque value passed to the expiry handler.
+     *
+     * @return timerid_t A handle which can be used to cancel the timer.
+     */
+    timerid_t CanTimerWheel::schedule(const steady_clock::time_point deadline, const uint64_t cookie) {
+        const auto offset = duration_cast<nanoseconds>(deadline - _origin).count();
+        const auto ticks = offset <= 0 ? uint64_t(0) : static_cast<uint64_t>((offset + _resolution.count() - 1) / _resolution.count());
+
+        const auto node = allocateNode();
+        auto& timer = _nodes[node];
+        timer.expires = ticks;
+        timer.cookie = cookie;
+        timer.active = true;
+
+        insert(node);
+        _activeTimers++;
+
+        return (static_cast<uint64_t>(timer.generation) << 32) | node;
+    }
+
+    /**
+     * @brief Cancels a pending timer.
+     *
+     * @param timer The handle returned by @ref schedule().
+     *
+     * @return true If the timer was pending and has been cancelled.
+     * @return false If the timer already expired, was cancelled or is unknown.
+     */
+    bool CanTimerWheel::cancel(const timerid_t timer) {
+        const auto node = static_cast<uint32_t>(timer & UINT32_MAX);
+        const auto generation = static_cast<uint32_t>(timer >> 32);
+
+        if (node <= _overdueHead || node >= _nodes.size()) { return false; }
+        if (!_nodes[node].active || _nodes[node].generation != generation) { return false; }
+
+        unlink(node);
+        releaseNode(node);
+        _activeTimers--;
+
+        return true;
+    }
+
+    /**
+     * @brief Turns the wheel up to the given point in time and fires all due timers.
+     *
+     * The handler may schedule and cancel timers; timers scheduled from within the handler
+     * whose deadline has already passed fire on the next call.
+     *
+     * @param now The current time.
+     * @param onExpired Invoked with the cookie of each expired timer, in order of expiry.
+     *
+     * @return size_t The amount of timers which expired.
+     */
+    size_t CanTimerWheel::advance(const steady_clock::time_point now, const function<void(uint64_t)>& onExpired) {
+        const auto offset = duration_cast<nanoseconds>(now - _origin).count();
+        if (offset < 0) { return 0; }
+
+        const auto currentTick = static_cast<uint64_t>(offset / _resolution.count());
+        size_t expiredTimers = 0;
+
+        // Timers scheduled with a deadline the wheel had already passed
+        while (_nodes[_overdueHead].next != _overdueHead) {
+            const auto node = _nodes[_overdueHead].next;
+            unlink(node);
+            link(_firingHead, node);
+        }
+
+        expiredTimers += fire(onExpired);
+
+        while (_nextTick <= currentTick) {
+            // Nothing to do; skip ahead instead of turning the wheel tick by tick
+            if (_activeTimers == 0) {
+                _nextTick = currentTick + 1;
+                break;
+            }
+
+            // If the lower levels are empty, jump straight to the next cascade of the lowest occupied level
+            if (_levelCounts[0] == 0) {
+                uint32_t level = 1;
+                while (level < LEVEL_COUNT - 1 && _levelCounts[level] == 0) { level++; }
+
+                const auto step = uint64_t(1) << (level * SLOT_BITS);
+                const auto boundary = (_nextTick + step - 1) & ~(step - 1);
+                if (boundary > currentTick) {
+                    _nextTick = currentTick + 1;
+                    break;
+                }
+
+                _nextTick = boundary;
+            }
+
+            const auto index = static_cast<uint32_t>(_nextTick & (SLOT_COUNT - 1));
+
+            if (index == 0) {
+                for (uint32_t level = 1; level < LEVEL_COUNT; level++) {
+                    const auto levelIndex = static_cast<uint32_t>((_nextTick >> (level * SLOT_BITS)) & (SLOT_COUNT - 1));
+                    cascade(level);
+                    if (levelIndex != 0) { break; }
+                }
+            }
+
+            // Move the slot to the firing list so the handler can safely modify the wheel
+            const auto head = slotHead(0, index);
+            while (_nodes[head].next != head) {
+                const auto node = _nodes[head].next;
+                unlink(node);
+                link(_firingHead, node);
+            }
+
+            _nextTick++;
+            expiredTimers += fire(onExpired);
+        }
+
+        return expiredTimers;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Releases all timers in the firing list and invokes the handler for each of them.
+     *
+     * @return size_t The amount of timers fired.
+     */
+    size_t CanTimerWheel::fire(const function<void(uint64_t)>& onExpired) {
+        size_t firedTimers = 0;
+
+        while (_nodes[_firingHead].next != _firingHead) {
+            const auto node = _nodes[_firingHead].next;
+            const auto cookie = _nodes[node].cookie;
+
+            unlink(node);
+            releaseNode(node);
+            _activeTimers--;
+            firedTimers++;
+
+            if (onExpired) { onExpired(cookie); }
+        }
+
+        return firedTimers;
+    }
+
+    /**
+     * @brief Takes a node from the free list, or grows the node pool.
+     */
+    uint32_t CanTimerWheel::allocateNode() {
+        if (!_freeNodes.empty()) {
+            const auto node = _freeNodes.back();
+            _freeNodes.pop_back();
+            return node;
+        }
+
+        _nodes.push_back(Node{});
+        return static_cast<uint32_t>(_nodes.size() - 1);
+    }
+
+    /**
+     * @brief Returns a node to the free list and invalidates outstanding handles to it.
+     */
+    void CanTimerWheel::releaseNode(const uint32_t node) {
+        _nodes[node].active = false;
+        _nodes[node].generation++;
+        if (_nodes[node].generation == 0) { _nodes[node].generation = 1; } // keeps handles distinct from INVALID_TIMER
+
+        _freeNodes.push_back(node);
+    }
+
+    /**
+     * @brief Appends a node to the list with the given head.
+     */
+    void CanTimerWheel::link(const uint32_t head, const uint32_t node) {
+        const auto tail = _nodes[head].prev;
+
+        _nodes[node].prev = tail;
+        _nodes[node].next = head;
+        _nodes[tail].next = node;
+        _nodes[head].prev = node;
+
+        _nodes[node].level = head < _firingHead ? static_cast<uint8_t>(head / SLOT_COUNT) : NO_LEVEL;
+        if (_nodes[node].level != NO_LEVEL) { _levelCounts[_nodes[node].level]++; }
+    }
+
+    /**
+     * @brief Removes a node from whichever list it is in.
+     */
+    void CanTimerWheel::unlink(const uint32_t node) {
+        const auto prev = _nodes[node].prev;
+        const auto next = _nodes[node].next;
+
+        _nodes[prev].next = next;
+        _nodes[next].prev = prev;
+        _nodes[node].prev = _nodes[node].next = node;
+
+        if (_nodes[node].level != NO_LEVEL) { _levelCounts[_nodes[node].level]--; }
+        _nodes[node].level = NO_LEVEL;
+    }
+
+    /**
+     * @brief Inserts a timer into the slot matching its remaining time.
+     */
+    void CanTimerWheel::insert(const uint32_t node) {
+        const auto expires = _nodes[node].expires;
+
+        if (expires < _nextTick) {
+            link(_overdueHead, node);
+            return;
+        }
+
+        const auto delta = expires - _nextTick;
+
+        for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+            if (delta < (uint64_t(1) << ((level + 1) * SLOT_BITS)) || level == LEVEL_COUNT - 1) {
+                // Timers beyond the wheel's range are parked in the top level and re-inserted when cascaded
+                const auto slotTick = delta < (uint64_t(1) << (LEVEL_COUNT * SLOT_BITS)) ? expires : _nextTick + (uint64_t(1) << (LEVEL_COUNT * SLOT_BITS)) - 1;
+                link(slotHead(level, static_cast<uint32_t>((slotTick >> (level * SLOT_BITS)) & (SLOT_COUNT - 1))), node);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Re-inserts all timers of the current slot of the given level into lower levels.
+     */
+    void CanTimerWheel::cascade(const uint32_t level) {
+        const auto head = slotHead(level, static_cast<uint32_t>((_nextTick >> (level * SLOT_BITS)) & (SLOT_COUNT - 1)));
+
+        // Detach first; timers beyond the wheel's range may land in the same slot again
+        _cascadeScratch.clear();
+        while (_nodes[head].next != head) {
+            const auto node = _nodes[head].next;
+            unlink(node);
+            _cascadeScratch.push_back(node);
+        }
+
+        for (const auto node : _cascadeScratch) { insert(node); }
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,171 @@
+/**
+ * @file CanTransport.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the SocketCAN transport.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanTransport.hpp"
+#include "exceptions/CanCloseException.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanCloseException;
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::make_shared;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+    /**
+     * @brief Gets the transport used by drivers which weren't given one.
+     */
+    shared_ptr<CanTransport> CanSocketTransport::getDefault() {
+        static const shared_ptr<CanTransport> defaultTransport = make_shared<CanSocketTransport>();
+
+        return defaultTransport;
+    }
+
+#pragma region "Sockets"
+    /**
+     * @brief Opens a non-blocking raw CAN socket and binds it to an interface.
+     *
+     * The filters are applied before binding, so no unfiltered frames are received.
+     *
+     * @param canInterface The interface to bind to (e.g. can0).
+     * @param canProtocol The CAN protocol to use.
+     * @param filters The filters to apply.
+     *
+     * @return int32_t The socket's file descriptor.
+     */
+    int32_t CanSocketTransport::openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) {
+        struct sockaddr_can address;
+        struct ifreq ifaceRequest;
+        int64_t fdOptions = 0;
+
+        memset(&address, 0, sizeof(struct sockaddr_can));
+        memset(&ifaceRequest, 0, sizeof(struct ifreq));
+
+        const auto socketFd = socket(PF_CAN, SOCK_RAW, canProtocol);
+
+        if (socketFd == -1) {
+            throw CanInitException(formatString("FAILED to initialise socketcan! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        strncpy(ifaceRequest.ifr_name, canInterface.c_str(), IFNAMSIZ - 1);
+
+        if (ioctl(socketFd, SIOCGIFINDEX, &ifaceRequest) == -1) {
+            const auto error = errno;
+            close(socketFd);
+            throw CanInitException(formatString("FAILED to perform IO control operation on socket %s! Error: %d => %s", canInterface.c_str(), error,
+                                    strerror(error)));
+        }
+
+        fdOptions = fcntl(socketFd, F_GETFL);
+        fdOptions |= O_NONBLOCK;
+        fcntl(socketFd, F_SETFL, fdOptions);
+
+        address.can_family = AF_CAN;
+        address.can_ifindex = ifaceRequest.ifr_ifindex;
+
+        try {
+            setFilters(socketFd, filters);
+        } catch (...) {
+            close(socketFd);
+            throw;
+        }
+
+        if (bind(socketFd, (struct sockaddr*)&address, sizeof(address)) == -1) {
+            const auto error = errno;
+            close(socketFd);
+            throw CanInitException(formatString("FAILED to bind to socket CAN! Error: %d => %s", error, strerror(error)));
+        }
+
+        return socketFd;
+    }
+
+    /**
+     * @brief Closes a CAN socket.
+     *
+     * @param socketFd The socket to close.
+     */
+    void CanSocketTransport::closeSocket(const int32_t socketFd) {
+        if (close(socketFd) == -1) { throw CanCloseException(formatString("FAILED to close CAN socket! Error: %d => %s", errno, strerror(errno))); }
+    }
+#pragma endregion
+
+#pragma region "Socket Options"
+    /**
+     * @brief Replaces a socket's receive filters (CAN_RAW_FILTER).
+     *
+     * @param socketFd The socket to configure.
+     * @param filters The filters to apply.
+     */
+    void CanSocketTransport::setFilters(const int32_t socketFd, const vector<can_filter>& filters) {
+        if (setsockopt(socketFd, SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(), filters.size() * sizeof(can_filter)) == -1) {
+            throw CanInitException(formatString("FAILED to set CAN filters on socket %d! Error: %d => %s", socketFd, errno, strerror(errno)));
+        }
+    }
+
+    /**
+     * @brief Enables or disables the echo of a socket's own frames, and kernel receive timestamps with it.
+     *
+     * @param socketFd The socket to configure.
+     * @param enabled Whether or not transmitted frames are echoed.
+     */
+    void CanSocketTransport::setReceiveOwnMessages(const int32_t socketFd, const bool enabled) {
+        const int32_t value = enabled ? 1 : 0;
+
+        if (setsockopt(socketFd, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &value, sizeof(value)) == -1) {
+            throw CanException(formatString("FAILED to set CAN_RAW_RECV_OWN_MSGS on socket %d! Error: %d => %s", socketFd, errno, strerror(errno)), socketFd);
+        }
+
+        // Kernel timestamps make the confirmation time independent of when the echo is read; optional
+        setsockopt(socketFd, SOL_SOCKET, SO_TIMESTAMPNS, &value, sizeof(value));
+    }
+#pragma endregion
+
+} // namespace sockcanpp
@@ -0,0 +1,416 @@
+/**
+ * @file CanTxQueue.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the backpressure-aware transmit queue.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <linux/can.h>
+#include <poll.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanTxQueue.hpp"
+#include "exceptions/CanException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanException;
+
+    using std::unique_lock;
+    using std::chrono::steady_clock;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new, empty queue.
+     *
+     * @param driver The driver to send frames with.
+     * @param capacity The maximum amount of queued frames.
+     * @param policy What to do with new frames while the queue is full.
+     * @param blockTimeout How long enqueue() waits for room with CanTxOverflowPolicy::Block.
+     * @param clock The clock deadlines are checked against.
+     */
+    CanTxQueue::CanTxQueue(CanDriver& driver, const size_t capacity, const CanTxOverflowPolicy policy, const milliseconds blockTimeout, const shared_ptr<CanClock>& clock):
+        _driver(driver), _capacity(capacity > 0 ? capacity : 1), _policy(policy), _blockTimeout(blockTimeout), _clock(clock ? clock : CanSteadyClock::getDefault()) { }
+#pragma endregion
+
+#pragma region "Configuration"
+    /**
+     * @brief Enables or disables latest-wins coalescing.
+     *
+     * While enabled, a new frame replaces the payload of a queued frame with the same ID (including the
+     * EFF/RTR flags) instead of being appended behind it.
+     *
+     * @param enabled Whether or not to coalesce frames.
+     *
+     * @return CanTxQueue& This instance.
+     */
+    CanTxQueue& CanTxQueue::setCoalescing(const bool enabled) {
+        unique_lock<mutex> locky(_lock);
+
+        _coalescing = enabled;
+        _queuedIds.clear();
+
+        // Frames queued earlier coalesce with their newest duplicate
+        if (enabled) {
+            for (const auto& entry : _queue) { _queuedIds[entry.frame.can_id] = entry.sequence; }
+        }
+
+        return *this;
+    }
+#pragma endregion
+
+#pragma region "Enqueueing"
+    /**
+     * @brief Queues a frame for transmission.
+     *
+     * Frames are sent as-is and in the order they were queued. While coalescing, a frame with an ID
+     * which is already queued updates the queued frame instead.
+     *
+     * @param frame The frame to send.
+     *
+     * @return true If the frame was queued.
+     * @return false If the frame was discarded by the overflow policy.
+     */
+    bool CanTxQueue::enqueue(const can_frame& frame) { return enqueue(frame, steady_clock::time_point::max()); }
+
+    /**
+     * @brief Queues a frame which must be sent before its deadline.
+     *
+     * If the frame is still queued when the deadline passes, it is discarded and counted as expired.
+     * While coalescing, a newer frame with the same ID replaces the deadline as well as the payload.
+     *
+     * @param frame The frame to send.
+     * @param deadline The latest point in time at which the frame may be sent.
+     *
+     * @return true If the frame was queued.
+     * @return false If the frame was discarded by the overflow policy.
+     */
+    bool CanTxQueue::enqueue(const can_frame& frame, const steady_clock::time_point deadline) {
+        unique_lock<mutex> locky(_lock);
+
+        if (_coalescing) {
+            const auto queued = _queuedIds.find(frame.can_id);
+
+            if (queued != _queuedIds.end()) {
+                auto& entry = _queue[static_cast<size_t>(queued->second - _headSequence)];
+                entry.frame = frame;
+                entry.deadline = deadline;
+                if (deadline < _nextDeadline) { _nextDeadline = deadline; }
+
+                _statistics.coalesced++;
+                return true;
+            }
+        }
+
+        // Expired frames make room before the overflow policy has to
+        if (_queue.size() >= _capacity && removeExpired(_clock->now())) { _roomAvailable.notify_all(); }
+        if (_queue.size() >= _capacity && !makeRoom(locky)) { return false; }
+
+        Entry entry{};
+        entry.frame = frame;
+        entry.sequence = _headSequence + _queue.size();
+        entry.deadline = deadline;
+        _queue.push_back(entry);
+
+        if (deadline < _nextDeadline) { _nextDeadline = deadline; }
+
+        if (_coalescing) { _queuedIds[frame.can_id] = entry.sequence; }
+
+        _statistics.enqueued++;
+        if (_queue.size() > _statistics.highWaterMark) { _statistics.highWaterMark = _queue.size(); }
+
+        locky.unlock();
+        _framesAvailable.notify_one();
+
+        return true;
+    }
+
+    /**
+     * @brief Queues a message for transmission.
+     *
+     * @param message The message to send.
+     * @param forceExtended Whether or not to force use of an extended ID.
+     *
+     * @return true If the message was queued.
+     * @return false If the message was discarded by the overflow policy.
+     */
+    bool CanTxQueue::enqueue(const CanMessage& message, bool forceExtended) { return enqueue(message, steady_clock::time_point::max(), forceExtended); }
+
+    /**
+     * @brief Queues a message which must be sent before its deadline.
+     *
+     * @param message The message to send.
+     * @param deadline The latest point in time at which the message may be sent.
+     * @param forceExtended Whether or not to force use of an extended ID.
+     *
+     * @return true If the message was queued.
+     * @return false If the message was discarded by the overflow policy.
+     */
+    bool CanTxQueue::enqueue(const CanMessage& message, const steady_clock::time_point deadline, bool forceExtended) {
+        if (message.getFrameData().size() > CanDriver::CAN_MAX_DATA_LENGTH) {
+            throw CanException(formatString("INVALID data length! Message must be smaller than %d bytes!", CanDriver::CAN_MAX_DATA_LENGTH), getSocketFd());
+        }
+
+        auto frame = message.getRawFrame();
+        if (forceExtended || ((uint32_t)message.getCanId() > CAN_SFF_MASK)) { frame.can_id |= CAN_EFF_FLAG; }
+
+        return enqueue(frame, deadline);
+    }
+#pragma endregion
+
+#pragma region "Transmission"
+    /**
+     * @brief Sends as many queued frames as the socket accepts, without blocking.
+     *
+     * Frames past their deadline are discarded first.
+     *
+     * @return size_t The amount of frames sent.
+     */
+    size_t CanTxQueue::flush() {
+        unique_lock<mutex> locky(_lock);
+
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE];
+        const auto expiredFrames = removeExpired(_clock->now());
+        size_t totalSent = 0;
+        _interfaceFull = false;
+
+        while (!_queue.empty()) {
+            size_t batchSize = 0;
+            for (auto entry = _queue.begin(); entry != _queue.end() && batchSize < CanDriver::CAN_MAX_BATCH_SIZE; ++entry) {
+                frames[batchSize++] = entry->frame;
+            }
+
+            errno = 0;
+            const auto framesSent = _driver.sendFrames(frames, batchSize);
+
+            popFront(framesSent);
+            totalSent += framesSent;
+
+            if (framesSent < batchSize) {
+                // EAGAIN clears with POLLOUT; ENOBUFS (interface queue full) doesn't affect POLLOUT
+                _interfaceFull = framesSent == 0 && errno == ENOBUFS;
+                _statistics.txBufferFull++;
+                break;
+            }
+        }
+
+        _statistics.sent += totalSent;
+        locky.unlock();
+
+        if (totalSent || expiredFrames) { _roomAvailable.notify_all(); }
+
+        return totalSent;
+    }
+
+    /**
+     * @brief Waits until the socket is writable.
+     *
+     * @param timeout The maximum time to wait.
+     *
+     * @return true If the socket is writable.
+     * @return false If the timeout elapsed.
+     */
+    bool CanTxQueue::waitWritable(const milliseconds timeout) {
+        pollfd pollFd{ getSocketFd(), POLLOUT, 0 };
+
+        const auto readyCount = poll(&pollFd, 1, static_cast<int>(timeout.count()));
+        if (readyCount < 0 && errno != EINTR) { throw CanException(formatString("FAILED to poll CAN socket! Error: %d => %s", errno, strerror(errno)), pollFd.fd); }
+
+        return readyCount > 0 && (pollFd.revents & POLLOUT);
+    }
+
+    /**
+     * @brief Flushes the queue whenever frames are queued, until @ref stop() is called.
+     */
+    void CanTxQueue::run() {
+        _running = true;
+
+        while (_running) {
+            {
+                unique_lock<mutex> locky(_lock);
+                _framesAvailable.wait_for(locky, milliseconds(100), [this]() { return !_queue.empty() || !_running; });
+            }
+
+            flush();
+
+            unique_lock<mutex> locky(_lock);
+            if (_queue.empty()) { continue; }
+
+            const auto interfaceFull = _interfaceFull;
+            locky.unlock();
+
+            if (interfaceFull) {
+                _clock->sleepFor(_retryInterval);
+            } else {
+                waitWritable(milliseconds(100));
+            }
+        }
+    }
+
+    /**
+     * @brief Causes @ref run() to return.
+     */
+    void CanTxQueue::stop() {
+        _running = false;
+        _framesAvailable.notify_all();
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Checks whether frames are waiting to be sent.
+     */
+    bool CanTxQueue::isPending() const {
+        unique_lock<mutex> locky(_lock);
+
+        return !_queue.empty();
+    }
+
+    /**
+     * @brief Gets the amount of queued frames.
+     */
+    size_t CanTxQueue::getDepth() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _queue.size();
+    }
+
+    /**
+     * @brief Gets a snapshot of the queue's counters.
+     */
+    CanTxQueueStatistics CanTxQueue::getStatistics() const {
+        unique_lock<mutex> locky(_lock);
+
+        auto statistics = _statistics;
+        statistics.depth = _queue.size();
+
+        return statistics;
+    }
+
+    /**
+     * @brief Clears all counters. The high water mark restarts at the current depth.
+     */
+    void CanTxQueue::resetStatistics() {
+        unique_lock<mutex> locky(_lock);
+
+        _statistics = CanTxQueueStatistics{};
+        _statistics.highWaterMark = _queue.size();
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Applies the overflow policy to a full queue.
+     *
+     * @param locky The held queue lock; released while blocking.
+     *
+     * @return true If there is room for a new frame.
+     * @return false If the new frame must be discarded.
+     */
+    bool CanTxQueue::makeRoom(unique_lock<mutex>& locky) {
+        switch (_policy) {
+            case CanTxOverflowPolicy::DropOldest:
+                popFront(1);
+                _statistics.droppedOldest++;
+                return true;
+            case CanTxOverflowPolicy::Block:
+                if (_roomAvailable.wait_for(locky, _blockTimeout, [this]() { return _queue.size() < _capacity; })) { return true; }
+
+                _statistics.blockTimeouts++;
+                _statistics.droppedNewest++;
+                return false;
+            case CanTxOverflowPolicy::DropNewest:
+            default:
+                _statistics.droppedNewest++;
+                return false;
+        }
+    }
+
+    /**
+     * @brief Removes frames from the front of the queue and forgets their IDs.
+     */
+    void CanTxQueue::popFront(const size_t count) {
+        for (size_t i = 0; i < count && !_queue.empty(); i++) {
+            const auto& entry = _queue.front();
+
+            if (_coalescing) {
+                const auto queued = _queuedIds.find(entry.frame.can_id);
+                if (queued != _queuedIds.end() && queued->second == entry.sequence) { _queuedIds.erase(queued); }
+            }
+
+            _queue.pop_front();
+            _headSequence++;
+        }
+    }
+
+    /**
+     * @brief Discards all frames whose deadline has passed.
+     *
+     * Does nothing until the earliest deadline is reached, so queues without deadlines pay nothing.
+     *
+     * @param now The current time.
+     *
+     * @return size_t The amount of frames discarded.
+     */
+    size_t CanTxQueue::removeExpired(const steady_clock::time_point now) {
+        if (now < _nextDeadline) { return 0; }
+
+        const auto previousSize = _queue.size();
+        _queue.erase(std::remove_if(_queue.begin(), _queue.end(), [now](const Entry& entry) { return entry.deadline <= now; }), _queue.end());
+
+        // Renumber the remaining frames, so sequences still map to positions
+        _nextDeadline = steady_clock::time_point::max();
+        _queuedIds.clear();
+
+        for (size_t i = 0; i < _queue.size(); i++) {
+            auto& entry = _queue[i];
+            entry.sequence = _headSequence + i;
+
+            if (entry.deadline < _nextDeadline) { _nextDeadline = entry.deadline; }
+            if (_coalescing) { _queuedIds[entry.frame.can_id] = entry.sequence; }
+        }
+
+        const auto expiredFrames = previousSize - _queue.size();
+        _statistics.expired += expiredFrames;
+
+        return expiredFrames;
+    }
+
+} // namespace sockcanpp
@@ -0,0 +1,288 @@
+/**
+ * @file CanVirtualBus.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of the in-process virtual CAN bus.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+//////////////////////////////
+//      SYSTEM INCLUDES     //
+//////////////////////////////
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//////////////////////////////
+//      LOCAL  INCLUDES     //
+//////////////////////////////
+#include "CanDriver.hpp"
+#include "CanVirtualBus.hpp"
+#include "exceptions/CanCloseException.hpp"
+#include "exceptions/CanException.hpp"
+#include "exceptions/CanInitException.hpp"
+
+namespace sockcanpp {
+
+    using exceptions::CanCloseException;
+    using exceptions::CanException;
+    using exceptions::CanInitException;
+
+    using std::memcpy;
+    using std::memory_order_relaxed;
+    using std::unique_lock;
+
+    //////////////////////////////////////
+    //      PUBLIC IMPLEMENTATION       //
+    //////////////////////////////////////
+
+#pragma region "Object Construction"
+    /**
+     * @brief Constructs a new, empty bus and starts its forwarding thread.
+     */
+    CanVirtualBus::CanVirtualBus() {
+        if ((_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+            throw CanInitException(formatString("FAILED to create virtual bus! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        _forwarder = thread(&CanVirtualBus::forwardLoop, this);
+    }
+
+    /**
+     * @brief Stops the forwarding thread and closes the bus's ends of all sockets.
+     */
+    CanVirtualBus::~CanVirtualBus() {
+        _stopping = true;
+        wake();
+
+        if (_forwarder.joinable()) { _forwarder.join(); }
+
+        for (const auto& node : _nodes) { close(node.second.busFd); }
+        close(_wakeFd);
+    }
+#pragma endregion
+
+#pragma region "Sockets"
+    /**
+     * @brief Opens a new socket on the bus.
+     *
+     * @param canInterface Ignored; all sockets share the bus.
+     * @param canProtocol Ignored.
+     * @param filters The filters to apply.
+     *
+     * @return int32_t The socket's file descriptor.
+     */
+    int32_t CanVirtualBus::openSocket(const string& canInterface, const int32_t canProtocol, const vector<can_filter>& filters) {
+        (void)canInterface;
+        (void)canProtocol;
+
+        int32_t sockets[2]{};
+        if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, sockets) < 0) {
+            throw CanInitException(formatString("FAILED to open virtual CAN socket! Error: %d => %s", errno, strerror(errno)));
+        }
+
+        {
+            unique_lock<mutex> locky(_lock);
+
+            const auto node = _nextNode++;
+            auto& entry = _nodes[node];
+            entry.busFd = sockets[1];
+            entry.socketFd = sockets[0];
+            entry.filters = filters;
+
+            _nodeIndex[sockets[0]] = node;
+            _generation++;
+        }
+
+        wake();
+
+        return sockets[0];
+    }
+
+    /**
+     * @brief Closes a socket. The bus's end is closed once all frames sent before have been forwarded.
+     *
+     * @param socketFd The socket to close.
+     */
+    void CanVirtualBus::closeSocket(const int32_t socketFd) {
+        {
+            unique_lock<mutex> locky(_lock);
+
+            auto existing = _nodeIndex.find(socketFd);
+            if (existing == _nodeIndex.end()) { throw CanCloseException(formatString("Socket %d does not belong to this virtual bus!", socketFd)); }
+
+            _nodes[existing->second].socketFd = -1;
+            _nodeIndex.erase(existing);
+        }
+
+        if (close(socketFd) == -1) { throw CanCloseException(formatString("FAILED to close virtual CAN socket! Error: %d => %s", errno, strerror(errno))); }
+    }
+#pragma endregion
+
+#pragma region "Socket Options"
+    /**
+     * @brief Replaces a socket's receive filters.
+     *
+     * @param socketFd The socket to configure.
+     * @param filters The filters to apply.
+     */
+    void CanVirtualBus::setFilters(const int32_t socketFd, const vector<can_filter>& filters) {
+        unique_lock<mutex> locky(_lock);
+
+        auto existing = _nodeIndex.find(socketFd);
+        if (existing == _nodeIndex.end()) { throw CanInitException(formatString("Socket %d does not belong to this virtual bus!", socketFd)); }
+
+        _nodes[existing->second].filters = filters;
+    }
+
+    /**
+     * @brief Echoing a socket's own frames is not supported; enabling it throws.
+     *
+     * @param socketFd The socket to configure.
+     * @param enabled Whether or not transmitted frames are echoed.
+     */
+    void CanVirtualBus::setReceiveOwnMessages(const int32_t socketFd, const bool enabled) {
+        if (enabled) { throw CanException("The virtual bus does not support echoing a socket's own frames!", socketFd); }
+    }
+#pragma endregion
+
+#pragma region "Getters"
+    /**
+     * @brief Gets the amount of open sockets.
+     */
+    size_t CanVirtualBus::getSocketCount() const {
+        unique_lock<mutex> locky(_lock);
+
+        return _nodeIndex.size();
+    }
+
+    /**
+     * @brief Gets the bus's statistics.
+     */
+    CanVirtualBusStatistics CanVirtualBus::getStatistics() const {
+        CanVirtualBusStatistics statistics{};
+        statistics.frames = _frames.load(memory_order_relaxed);
+        statistics.delivered = _delivered.load(memory_order_relaxed);
+        statistics.dropped = _dropped.load(memory_order_relaxed);
+
+        return statistics;
+    }
+#pragma endregion
+
+    //////////////////////////////////////
+    //      PRIVATE IMPLEMENTATION      //
+    //////////////////////////////////////
+
+    /**
+     * @brief Waits for frames on the bus's ends of all sockets and forwards them.
+     */
+    void CanVirtualBus::forwardLoop() {
+        vector<pollfd> pollFds{};
+        vector<uint64_t> pollNodes{};
+        auto generation = UINT64_MAX;
+        canfd_frame frame{};
+
+        while (!_stopping) {
+            {
+                unique_lock<mutex> locky(_lock);
+
+                if (generation != _generation) {
+                    pollFds.assign(1, { _wakeFd, POLLIN, 0 });
+                    pollNodes.assign(1, 0);
+
+                    for (const auto& node : _nodes) {
+                        pollFds.push_back({ node.second.busFd, POLLIN, 0 });
+                        pollNodes.push_back(node.first);
+                    }
+
+                    generation = _generation;
+                }
+            }
+
+            if (poll(pollFds.data(), pollFds.size(), -1) < 0) { continue; }
+
+            if (pollFds[0].revents & POLLIN) {
+                uint64_t wakeups = 0;
+                if (read(_wakeFd, &wakeups, sizeof(wakeups)) < 0) { /* already drained */ }
+            }
+
+            for (size_t i = 1; i < pollFds.size(); i++) {
+                if (!pollFds[i].revents) { continue; }
+
+                for (size_t frameCount = 0; frameCount < CanDriver::CAN_MAX_BATCH_SIZE; frameCount++) {
+                    const auto length = recv(pollFds[i].fd, &frame, sizeof(frame), MSG_DONTWAIT);
+
+                    if (length == 0) {
+                        // The driver's end was closed and everything it sent has been forwarded
+                        unique_lock<mutex> locky(_lock);
+                        close(pollFds[i].fd);
+                        _nodes.erase(pollNodes[i]);
+                        _generation++;
+                        break;
+                    }
+
+                    if (length < 0) { break; }
+                    if (length == CAN_MTU || length == CANFD_MTU) { forward(pollNodes[i], &frame, static_cast<size_t>(length)); }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Delivers a frame to every other socket whose filters accept it.
+     */
+    void CanVirtualBus::forward(const uint64_t sender, const void* frame, const size_t length) {
+        canid_t id = 0;
+        memcpy(&id, frame, sizeof(id));
+
+        _frames.fetch_add(1, memory_order_relaxed);
+        if (id & CAN_ERR_FLAG) { return; }
+
+        unique_lock<mutex> locky(_lock);
+
+        for (const auto& node : _nodes) {
+            if (node.first == sender || node.second.socketFd < 0 || !canFiltersAccept(node.second.filters, id)) { continue; }
+
+            if (send(node.second.busFd, frame, length, MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {
+                _dropped.fetch_add(1, memory_order_relaxed);
+            } else {
+                _delivered.fetch_add(1, memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Interrupts the forwarding thread's poll, so it picks up new sockets or stops.
+     */
+    void CanVirtualBus::wake() {
+        const uint64_t wakeup = 1;
+
+        if (write(_wakeFd, &wakeup, sizeof(wakeup)) < 0) { /* the counter is saturated; a wakeup is pending anyway */ }
+    }
+
+} // namespace sockcanpp
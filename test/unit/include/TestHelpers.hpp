@@ -0,0 +1,105 @@
+/**
+ * @file TestHelpers.hpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the fixtures shared by the unit tests.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#ifndef LIBSOCKCANPP_TEST_UNIT_INCLUDE_TESTHELPERS_HPP
+#define LIBSOCKCANPP_TEST_UNIT_INCLUDE_TESTHELPERS_HPP
+
+#include <gtest/gtest.h>
+
+#include <CanRecorder.hpp>
+#include <CanTransport.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace testhelpers {
+
+    using sockcanpp::CanRecorder;
+    using sockcanpp::CanTransport;
+
+    using std::function;
+    using std::map;
+    using std::string;
+    using std::to_string;
+    using std::vector;
+    using std::chrono::nanoseconds;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief The time recordings written by the tests start at.
+     */
+    inline const auto START = system_clock::time_point(nanoseconds(1700000000000000000));
+
+    /**
+     * @brief Gets a path in the test's temporary directory which is unique to this process.
+     *
+     * @param name The name of the file, without its extension.
+     * @param extension The extension, including the dot.
+     */
+    inline string tempPath(const string& name, const string& extension) {
+        return testing::TempDir() + "sockcanpp-" + name + "-" + to_string(getpid()) + extension;
+    }
+
+    /**
+     * @brief Writes a recording to a temporary file.
+     *
+     * @param name The name of the file, see @ref tempPath().
+     * @param write Records the frames.
+     * @param bufferCount The amount of recorder buffers; enough for the whole recording means nothing is dropped however slow the disk is.
+     *
+     * @return string The path of the recording, which the caller unlinks.
+     */
+    inline string writeRecording(const string& name, const function<void(CanRecorder&)>& write, const size_t bufferCount = 8) {
+        const auto path = tempPath(name, ".log");
+        CanRecorder recorder(path, 4096, bufferCount);
+        write(recorder);
+
+        return path;
+    }
+
+    /**
+     * @brief Hands out one end of a socket pair, so frames can be sent without a CAN interface.
+     *
+     * The other end, see @ref getPeer(), sees the frames the driver sends and can inject frames for it to receive.
+     */
+    class LoopbackTransport: public CanTransport {
+        public:
+            int32_t openSocket(const string&, const int32_t, const vector<can_filter>&) override {
+                int32_t sockets[2]{};
+                if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0, sockets) == -1) { return -1; }
+
+                peers[sockets[0]] = sockets[1];
+                return sockets[0];
+            }
+
+            void closeSocket(const int32_t socketFd) override {
+                close(peers[socketFd]);
+                close(socketFd);
+                peers.erase(socketFd);
+            }
+
+            void setFilters(const int32_t, const vector<can_filter>&) override { }
+            void setReceiveOwnMessages(const int32_t, const bool) override { }
+
+            int32_t getPeer(const int32_t socketFd) const { return peers.at(socketFd); } //!< Gets the other end of a driver's socket
+
+        private:
+            map<int32_t, int32_t> peers{};
+    };
+
+}
+
+#endif // LIBSOCKCANPP_TEST_UNIT_INCLUDE_TESTHELPERS_HPP
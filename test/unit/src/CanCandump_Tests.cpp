@@ -0,0 +1,153 @@
+/**
+ * @file CanCandump_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanCandump and CanCandumpReader classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanCandump.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+using sockcanpp::CanCandump;
+using sockcanpp::CanCandumpFrame;
+using sockcanpp::CanCandumpReader;
+
+using std::string;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+TEST(CanCandumpTests, CanCandump_format_ExpectCandumpLines) {
+    char buffer[CanCandump::MAX_LINE_LENGTH];
+    const auto timestamp = system_clock::time_point(nanoseconds(1700000000012345678));
+
+    can_frame frame{};
+    frame.can_id = 0x123;
+    frame.can_dlc = 4;
+    memcpy(frame.data, "\xDE\xAD\xBE\xEF", 4);
+    ASSERT_EQ(string(buffer, CanCandump::format(buffer, sizeof(buffer), frame, "can0", timestamp)), "(1700000000.012345) can0 123#DEADBEEF\n");
+
+    frame.can_id = 0x18FEF100 | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    frame.can_dlc = 8;
+    ASSERT_EQ(string(buffer, CanCandump::format(buffer, sizeof(buffer), frame, "vcan1", timestamp)), "(1700000000.012345) vcan1 18FEF100#R8\n");
+
+    canfd_frame fdFrame{};
+    fdFrame.can_id = 0x7FF;
+    fdFrame.len = 2;
+    fdFrame.flags = CANFD_BRS;
+    fdFrame.data[1] = 0x0A;
+    ASSERT_EQ(string(buffer, CanCandump::format(buffer, sizeof(buffer), fdFrame, "can0", timestamp)), "(1700000000.012345) can0 7FF##1000A\n");
+
+    ASSERT_EQ(CanCandump::format(buffer, 16, fdFrame, "can0", timestamp), 0u);
+}
+
+TEST(CanCandumpTests, CanCandump_parse_ExpectFramesDecoded) {
+    CanCandumpFrame frame{};
+
+    const string classic = "(1700000000.5) can0 123#DE.AD.be.ef";
+    ASSERT_TRUE(CanCandump::parse(classic.data(), classic.size(), frame));
+    ASSERT_EQ(frame.frame.can_id, 0x123u);
+    ASSERT_EQ(frame.frame.len, 4u);
+    ASSERT_EQ(frame.frame.data[3], 0xEF);
+    ASSERT_EQ(string(frame.interface, frame.interfaceLength), "can0");
+    ASSERT_EQ(frame.timestamp, system_clock::time_point(nanoseconds(1700000000500000000)));
+
+    const string extended = "(0000000001.000001) can1 00000123#R T";
+    ASSERT_TRUE(CanCandump::parse(extended.data(), extended.size(), frame));
+    ASSERT_EQ(frame.frame.can_id, 0x123u | CAN_EFF_FLAG | CAN_RTR_FLAG);
+    ASSERT_EQ(frame.timestamp, system_clock::time_point(nanoseconds(1000001000)));
+
+    const string fd = "(1.0) can0 456##30102030405060708090A0B0C";
+    ASSERT_TRUE(CanCandump::parse(fd.data(), fd.size(), frame));
+    ASSERT_TRUE(frame.isFd);
+    ASSERT_EQ(frame.frame.flags, 3u);
+    ASSERT_EQ(frame.frame.len, 12u);
+
+    for (const string invalid : { "can0 123#00", "(1.0) can0 12#00", "(1.0) can0 123#0", "(1.0) can0 123#001122334455667788", "(1.0) can0 123#XY" }) {
+        ASSERT_FALSE(CanCandump::parse(invalid.data(), invalid.size(), frame)) << invalid;
+    }
+}
+
+TEST(CanCandumpTests, CanCandump_parseFdPayload_ExpectEveryDigitChecked) {
+    CanCandumpFrame frame{};
+    string payload{};
+
+    for (uint32_t i = 0; i < CANFD_MAX_DLEN; i++) {
+        const auto byte = static_cast<uint8_t>(i * 37 + 11);
+        payload += "0123456789ABCDEF"[byte >> 4];
+        payload += "0123456789abcdef"[byte & 0xF];
+    }
+
+    const auto prefix = string("(1.0) can0 456##1");
+    const auto line = prefix + payload + " R";
+    ASSERT_TRUE(CanCandump::parse(line.data(), line.size(), frame));
+    ASSERT_EQ(frame.frame.len, CANFD_MAX_DLEN);
+
+    for (uint32_t i = 0; i < CANFD_MAX_DLEN; i++) { ASSERT_EQ(frame.frame.data[i], static_cast<uint8_t>(i * 37 + 11)) << i; }
+
+    // Dots may follow an undotted run
+    const auto dotted = prefix + payload.substr(0, 32) + "." + payload.substr(32, 2) + "." + payload.substr(34, 2);
+    ASSERT_TRUE(CanCandump::parse(dotted.data(), dotted.size(), frame));
+    ASSERT_EQ(frame.frame.len, 18u);
+    ASSERT_EQ(frame.frame.data[17], static_cast<uint8_t>(17 * 37 + 11));
+
+    // Characters just outside the hex ranges are rejected wherever they are
+    for (const char invalid : { '/', ':', '@', 'G', '`', 'g', static_cast<char>(0xB0), static_cast<char>(0xC1) }) {
+        for (size_t i = 0; i < payload.size(); i += 7) {
+            auto malformed = line;
+            malformed[prefix.size() + i] = invalid;
+            ASSERT_FALSE(CanCandump::parse(malformed.data(), malformed.size(), frame)) << i;
+        }
+    }
+
+    const auto tooLong = prefix + payload + "00";
+    ASSERT_FALSE(CanCandump::parse(tooLong.data(), tooLong.size(), frame));
+}
+
+TEST(CanCandumpTests, CanCandumpReader_logFile_ExpectRoundTrip) {
+    const auto path = testhelpers::tempPath("candump", ".log");
+    const auto start = system_clock::time_point(nanoseconds(1700000000000000000));
+
+    {
+        std::ofstream log(path);
+        char buffer[CanCandump::MAX_LINE_LENGTH];
+
+        for (uint32_t i = 0; i < 1000; i++) {
+            can_frame frame{};
+            frame.can_id = i & CAN_SFF_MASK;
+            frame.can_dlc = i % 9;
+            memset(frame.data, static_cast<int32_t>(i), frame.can_dlc);
+
+            log.write(buffer, static_cast<std::streamsize>(CanCandump::format(buffer, sizeof(buffer), frame, "can0", start + microseconds(i))));
+            if (i == 500) { log << "garbage\r\n\n"; }
+        }
+    }
+
+    CanCandumpReader reader(path);
+    CanCandumpFrame frame{};
+    uint32_t frames = 0;
+
+    while (reader.next(frame)) {
+        ASSERT_EQ(frame.frame.can_id, frames & CAN_SFF_MASK);
+        ASSERT_EQ(frame.frame.len, frames % 9);
+        ASSERT_EQ(frame.timestamp, start + microseconds(frames));
+        frames++;
+    }
+
+    unlink(path.c_str());
+    ASSERT_EQ(frames, 1000u);
+    ASSERT_EQ(reader.getInvalidLineCount(), 1u);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file CanCaptureRing_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanCaptureRing class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanCaptureRing.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+
+using sockcanpp::CanCaptureRing;
+using sockcanpp::CAN_RECORD_FD;
+
+using std::string;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    string ringPath(const string& name) { return testhelpers::tempPath(name, ".ring"); }
+
+}
+
+TEST(CanCaptureRingTests, CanCaptureRing_writerCrashes_ExpectLastFramesExtracted) {
+    const auto path = ringPath("capture-crash");
+    const auto start = system_clock::time_point(nanoseconds(1000000000));
+
+    const auto child = fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        CanCaptureRing ring(path, 8);
+
+        for (uint8_t i = 0; i < 20; i++) {
+            can_frame frame{};
+            frame.can_id = 0x100 + i;
+            frame.can_dlc = 2;
+            frame.data[0] = i;
+            frame.data[1] = 0xEE;
+            ring.record(frame, 3, start + milliseconds(i));
+        }
+
+        // Die without unmapping or closing anything
+        _exit(0);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+
+    const auto dump = CanCaptureRing::extract(path);
+    ASSERT_EQ(dump.pid, child);
+    ASSERT_EQ(dump.written, 20u);
+    ASSERT_EQ(dump.torn, 0u);
+    ASSERT_EQ(dump.records.size(), 8u);
+
+    for (size_t i = 0; i < dump.records.size(); i++) {
+        const auto& record = dump.records[i];
+        ASSERT_EQ(record.canId, 0x100u + 12 + i);
+        ASSERT_EQ(record.ifindex, 3);
+        ASSERT_EQ(record.length, 2);
+        ASSERT_EQ(record.data[0], 12 + i);
+        ASSERT_EQ(record.timestamp, (start + milliseconds(12 + i)).time_since_epoch().count());
+    }
+
+    ASSERT_EQ(CanCaptureRing::extract(path, 3).records.front().canId, 0x100u + 17);
+
+    unlink(path.c_str());
+}
+
+TEST(CanCaptureRingTests, CanCaptureRing_restart_ExpectPreviousRingKept) {
+    const auto path = ringPath("capture-restart");
+    const auto previousPath = CanCaptureRing::getPreviousPath(path);
+
+    {
+        CanCaptureRing ring(path, 8);
+
+        can_frame frame{};
+        frame.can_id = 0x123;
+        ring.record(frame);
+    }
+
+    // A restarted process must not wipe the frames leading up to the crash
+    CanCaptureRing restarted(path, 8);
+
+    ASSERT_EQ(CanCaptureRing::extract(path).written, 0u);
+
+    const auto previous = CanCaptureRing::extract(previousPath);
+    ASSERT_EQ(previous.records.size(), 1u);
+    ASSERT_EQ(previous.records.front().canId, 0x123u);
+
+    unlink(path.c_str());
+    unlink(previousPath.c_str());
+}
+
+TEST(CanCaptureRingTests, CanCaptureRing_shorterFrameOverwritesFdFrame_ExpectStalePayloadCleared) {
+    const auto path = ringPath("capture-fd");
+
+    {
+        CanCaptureRing ring(path, 2);
+        ASSERT_EQ(ring.getCapacity(), 2u);
+
+        canfd_frame fdFrame{};
+        fdFrame.can_id = 0x200;
+        fdFrame.len = 64;
+        for (uint8_t i = 0; i < 64; i++) { fdFrame.data[i] = 0xFF; }
+
+        ring.record(fdFrame);
+        ring.record(fdFrame);
+
+        can_frame frame{};
+        frame.can_id = 0x201;
+        frame.can_dlc = 1;
+        frame.data[0] = 0x11;
+        ring.record(frame);
+
+        ASSERT_EQ(ring.getWrittenCount(), 3u);
+    }
+
+    const auto dump = CanCaptureRing::extract(path);
+    ASSERT_EQ(dump.records.size(), 2u);
+    ASSERT_EQ(dump.records[0].flags & CAN_RECORD_FD, CAN_RECORD_FD);
+    ASSERT_EQ(dump.records[0].data[63], 0xFF);
+    ASSERT_EQ(dump.records[1].canId, 0x201u);
+    ASSERT_EQ(dump.records[1].flags, 0);
+    ASSERT_EQ(dump.records[1].data[0], 0x11);
+    ASSERT_EQ(dump.records[1].data[1], 0);
+    ASSERT_EQ(dump.records[1].data[63], 0);
+
+    unlink(path.c_str());
+}
@@ -0,0 +1,104 @@
+/**
+ * @file CanClock_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanClock classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanClock.hpp>
+#include <CanCycleSupervisor.hpp>
+#include <CanDriver.hpp>
+#include <CanSimulatedBus.hpp>
+
+#include <chrono>
+#include <memory>
+#include <queue>
+#include <string>
+
+using sockcanpp::CanCycleEvent;
+using sockcanpp::CanCycleEventType;
+using sockcanpp::CanCycleSupervisor;
+using sockcanpp::CanDriver;
+using sockcanpp::CanId;
+using sockcanpp::CanManualClock;
+using sockcanpp::CanMessage;
+using sockcanpp::CanSimulatedBus;
+using sockcanpp::CanSimulatedTransmission;
+
+using std::make_shared;
+using std::queue;
+using std::string;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+TEST(CanClockTests, CanManualClock_driverTiming_ExpectVirtualTimeInsteadOfWaiting) {
+    auto bus = make_shared<CanSimulatedBus>();
+    auto clock = make_shared<CanManualClock>();
+    CanDriver sender("sim0", CAN_RAW, bus);
+    CanDriver receiver("sim0", CAN_RAW, bus);
+    sender.setClock(clock);
+    receiver.setClock(clock);
+
+    // Nothing to read: returns immediately, but an hour has passed
+    const auto wallStart = steady_clock::now();
+    ASSERT_FALSE(receiver.waitForMessages(milliseconds(3600000)));
+    ASSERT_EQ(clock->now(), steady_clock::time_point(seconds(3600)));
+    ASSERT_LT(steady_clock::now() - wallStart, seconds(1));
+
+    queue<CanMessage> messages{};
+    for (int i = 0; i < 3; i++) { messages.push(CanMessage(CanId(0x100 + i), string("\x01", 1))); }
+    ASSERT_GT(sender.sendMessageQueue(messages, milliseconds(500)), 0);
+    ASSERT_EQ(clock->now(), steady_clock::time_point(seconds(3601))); // Two delays between three messages
+
+    // Frames are pending; waiting doesn't advance the clock
+    ASSERT_EQ(bus->runFor(milliseconds(10)), 3u);
+    ASSERT_TRUE(receiver.waitForMessages(milliseconds(1000)));
+    ASSERT_EQ(clock->now(), steady_clock::time_point(seconds(3601)));
+
+    // The clock never moves backwards
+    clock->advanceTo(steady_clock::time_point(seconds(10)));
+    ASSERT_EQ(clock->now(), steady_clock::time_point(seconds(3601)));
+
+    sender.setClock(nullptr);
+    ASSERT_NE(sender.getClock(), nullptr);
+}
+
+TEST(CanClockTests, CanManualClock_tenMinutesOfCyclicTraffic_ExpectSingleTimeoutAndRecovery) {
+    CanSimulatedBus bus(500000);
+    auto transport = std::shared_ptr<CanSimulatedBus>(&bus, [](CanSimulatedBus*) { });
+    auto sender = make_shared<CanDriver>("sim0", CAN_RAW, transport);
+    sender->setClock(bus.getClock());
+
+    size_t timeouts = 0;
+    size_t recoveries = 0;
+    CanCycleSupervisor supervisor([&timeouts, &recoveries](const CanCycleEvent& event) {
+        if (event.type == CanCycleEventType::Timeout) { timeouts++; }
+        if (event.type == CanCycleEventType::Recovered) { recoveries++; }
+    }, milliseconds(1), bus.getClock());
+
+    supervisor.monitor(CanId(0x123), milliseconds(10), milliseconds(2));
+
+    // The sender falls silent for 100ms half way through
+    bus.every(milliseconds(10), [&bus, sender]() {
+        if (bus.now() >= seconds(300) && bus.now() < seconds(300) + milliseconds(100)) { return; }
+        sender->sendMessage(CanMessage(CanId(0x123), string("\x01\x02\x03\x04", 4)));
+    });
+    bus.every(milliseconds(10), [&supervisor]() { supervisor.expire(); }, milliseconds(5));
+    bus.setTransmissionHandler([&supervisor](const CanSimulatedTransmission& transmission) { supervisor.onMessage(CanMessage(transmission.frame)); });
+
+    bus.runFor(seconds(600));
+
+    const auto statistics = supervisor.getStatistics(CanId(0x123));
+    ASSERT_EQ(statistics.received, 60000u - 10u);
+    ASSERT_EQ(statistics.jitterEvents, 0u);
+    ASSERT_EQ(timeouts, 1u);
+    ASSERT_EQ(recoveries, 1u);
+    ASSERT_EQ(statistics.maxInterval, milliseconds(110));
+    ASSERT_EQ(bus.getClock()->now(), steady_clock::time_point(seconds(600)));
+}
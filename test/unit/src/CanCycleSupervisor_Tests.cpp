@@ -0,0 +1,107 @@
+/**
+ * @file CanCycleSupervisor_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanCycleSupervisor class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanCycleSupervisor.hpp>
+
+#include <linux/can/error.h>
+
+#include <chrono>
+#include <vector>
+
+using sockcanpp::CanCycleEvent;
+using sockcanpp::CanCycleEventType;
+using sockcanpp::CanCycleSupervisor;
+using sockcanpp::CanMessage;
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+using std::vector;
+
+TEST(CanCycleSupervisorTests, CanCycleSupervisor_messageOnTime_ExpectNoEvents) {
+    vector<CanCycleEvent> events{};
+    CanCycleSupervisor supervisor([&](const CanCycleEvent& event) { events.push_back(event); });
+    const auto start = steady_clock::now();
+
+    supervisor.monitor(0x100, milliseconds(10), milliseconds(2), start);
+
+    for (int32_t i = 1; i <= 10; i++) {
+        supervisor.onMessage(CanMessage(0x100, ""), start + milliseconds(10 * i));
+        supervisor.expire(start + milliseconds(10 * i + 1));
+    }
+
+    ASSERT_TRUE(events.empty());
+    ASSERT_EQ(supervisor.getStatistics(0x100).received, 10u);
+}
+
+TEST(CanCycleSupervisorTests, CanCycleSupervisor_messageMissing_ExpectSingleTimeoutThenRecovery) {
+    vector<CanCycleEvent> events{};
+    CanCycleSupervisor supervisor([&](const CanCycleEvent& event) { events.push_back(event); });
+    const auto start = steady_clock::now();
+
+    supervisor.monitor(0x100, milliseconds(10), milliseconds(2), start);
+    supervisor.onMessage(CanMessage(0x100, ""), start + milliseconds(10));
+
+    supervisor.expire(start + milliseconds(21));
+    ASSERT_TRUE(events.empty());
+
+    supervisor.expire(start + milliseconds(22));
+    supervisor.expire(start + milliseconds(100));
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(events[0].type, CanCycleEventType::Timeout);
+    ASSERT_TRUE(supervisor.getStatistics(0x100).timedOut);
+
+    supervisor.onMessage(CanMessage(0x100, ""), start + milliseconds(110));
+    ASSERT_EQ(events.size(), 2u);
+    ASSERT_EQ(events[1].type, CanCycleEventType::Recovered);
+    ASSERT_FALSE(supervisor.getStatistics(0x100).timedOut);
+}
+
+TEST(CanCycleSupervisorTests, CanCycleSupervisor_errorAndRemoteFrames_ExpectCycleNotReset) {
+    vector<CanCycleEvent> events{};
+    CanCycleSupervisor supervisor([&](const CanCycleEvent& event) { events.push_back(event); });
+    const auto start = steady_clock::now();
+
+    supervisor.monitor(CAN_ERR_BUSOFF, milliseconds(10), milliseconds(2), start);
+    supervisor.onMessage(CanMessage(CAN_ERR_BUSOFF, ""), start + milliseconds(10));
+
+    can_frame error{};
+    error.can_id = CAN_ERR_FLAG | CAN_ERR_BUSOFF;
+    error.can_dlc = CAN_ERR_DLC;
+    can_frame request{};
+    request.can_id = CAN_ERR_BUSOFF | CAN_RTR_FLAG;
+
+    ASSERT_FALSE(supervisor.onMessage(CanMessage(error), start + milliseconds(18)));
+    ASSERT_FALSE(supervisor.onMessage(CanMessage(request), start + milliseconds(19)));
+
+    supervisor.expire(start + milliseconds(40));
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(events[0].type, CanCycleEventType::Timeout);
+
+    ASSERT_FALSE(supervisor.onMessage(CanMessage(error), start + milliseconds(45)));
+    ASSERT_EQ(events.size(), 1u); // no false recovery
+    ASSERT_EQ(supervisor.getStatistics(CAN_ERR_BUSOFF).received, 1u);
+    ASSERT_TRUE(supervisor.getStatistics(CAN_ERR_BUSOFF).timedOut);
+}
+
+TEST(CanCycleSupervisorTests, CanCycleSupervisor_messageEarly_ExpectJitterEvent) {
+    vector<CanCycleEvent> events{};
+    CanCycleSupervisor supervisor([&](const CanCycleEvent& event) { events.push_back(event); });
+    const auto start = steady_clock::now();
+
+    supervisor.monitor(0x18fef100, milliseconds(100), milliseconds(5), start);
+    supervisor.onMessage(CanMessage(0x18fef100 | CAN_EFF_FLAG, ""), start + milliseconds(100));
+    supervisor.onMessage(CanMessage(0x18fef100 | CAN_EFF_FLAG, ""), start + milliseconds(150));
+
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(events[0].type, CanCycleEventType::Jitter);
+    ASSERT_EQ(events[0].interval, milliseconds(50));
+}
@@ -0,0 +1,109 @@
+/**
+ * @file CanDriver_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanDriver's TX confirmation.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanDriver.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <memory>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanMessage;
+
+using testhelpers::LoopbackTransport;
+
+using std::deque;
+using std::future_status;
+using std::make_shared;
+using std::chrono::milliseconds;
+
+namespace {
+
+    /**
+     * @brief A driver whose received frames are scripted, including the MSG_CONFIRM flag the kernel sets on echoes.
+     */
+    class ScriptedDriver: public CanDriver {
+        public:
+            ScriptedDriver(): CanDriver("loop0", CAN_RAW, make_shared<LoopbackTransport>()) { }
+
+            void receive(const can_frame& frame, const int32_t flags = 0) { script.push_back({ frame, flags }); }
+
+        protected:
+            ssize_t receiveMessage(msghdr& message) override {
+                if (script.empty()) {
+                    errno = EAGAIN;
+                    return -1;
+                }
+
+                memcpy(message.msg_iov[0].iov_base, &script.front().first, sizeof(can_frame));
+                message.msg_flags = script.front().second;
+                message.msg_controllen = 0;
+                script.pop_front();
+
+                return sizeof(can_frame);
+            }
+
+        private:
+            deque<std::pair<can_frame, int32_t>> script{};
+    };
+
+}
+
+TEST(CanDriverTests, CanDriver_sendMessageConfirmed_ExpectEchoMatchedByContent) {
+    ScriptedDriver driver;
+    driver.setTxConfirmation(true);
+
+    auto first = driver.sendMessageConfirmed(CanMessage(0x100, "first"));
+    auto second = driver.sendMessageConfirmed(CanMessage(0x100, "second"));
+    ASSERT_EQ(driver.getPendingConfirmationCount(), 2u);
+
+    // Interfaces with several TX buffers may confirm frames out of order
+    driver.receive(CanMessage(0x100, "second").getRawFrame(), MSG_CONFIRM);
+    driver.receive(CanMessage(0x100, "first").getRawFrame(), MSG_CONFIRM);
+
+    ASSERT_THROW(driver.readMessage(), std::exception); // only echoes, nothing to return
+    ASSERT_EQ(first.wait_for(milliseconds(0)), future_status::ready);
+    ASSERT_EQ(second.wait_for(milliseconds(0)), future_status::ready);
+    ASSERT_EQ(std::memcmp(first.get().frame.data, "first", 5), 0);
+    ASSERT_EQ(std::memcmp(second.get().frame.data, "second", 6), 0);
+    ASSERT_EQ(driver.getPendingConfirmationCount(), 0u);
+    ASSERT_EQ(driver.getTxLatencyHistogram().count, 2u);
+
+    ASSERT_THROW(driver.setTxConfirmation(false).sendMessageConfirmed(CanMessage(0x100, "")), std::exception);
+}
+
+TEST(CanDriverTests, CanDriver_receiveFrame_ExpectEchoesSkipped) {
+    ScriptedDriver driver;
+    driver.setTxConfirmation(true);
+
+    auto pending = driver.sendMessageConfirmed(CanMessage(0x100, "mine"));
+
+    // An echo of a frame sent without confirmation is consumed without completing anything
+    driver.receive(CanMessage(0x300, "other").getRawFrame(), MSG_CONFIRM);
+    driver.receive(CanMessage(0x200, "rx").getRawFrame());
+    driver.receive(CanMessage(0x100, "mine").getRawFrame(), MSG_CONFIRM);
+    driver.receive(CanMessage(0x201, "rx").getRawFrame());
+
+    ASSERT_EQ(driver.readMessage().getCanId(), 0x200);
+    ASSERT_EQ(pending.wait_for(milliseconds(0)), future_status::timeout);
+
+    ASSERT_EQ(driver.readMessage().getCanId(), 0x201);
+    ASSERT_EQ(pending.wait_for(milliseconds(0)), future_status::ready);
+    ASSERT_EQ(driver.getPendingConfirmationCount(), 0u);
+}
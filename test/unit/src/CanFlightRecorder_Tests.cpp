@@ -0,0 +1,158 @@
+/**
+ * @file CanFlightRecorder_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanFlightRecorder class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanFlightRecorder.hpp>
+
+#include <linux/can/error.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+using sockcanpp::CanFlightPattern;
+using sockcanpp::CanFlightRecorder;
+using sockcanpp::CanFlightSnapshot;
+using sockcanpp::CanFlightTriggerReason;
+
+using std::mutex;
+using std::unique_lock;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    can_frame makeFrame(const canid_t id, const uint8_t value) {
+        can_frame frame{};
+        frame.can_id = id;
+        frame.can_dlc = 1;
+        frame.data[0] = value;
+
+        return frame;
+    }
+
+}
+
+TEST(CanFlightRecorderTests, CanFlightRecorder_trigger_ExpectPreTriggerWindowOnly) {
+    mutex lock{};
+    vector<CanFlightSnapshot> snapshots{};
+    const auto start = system_clock::time_point(nanoseconds(1000000000));
+
+    CanFlightRecorder recorder([&](const CanFlightSnapshot& snapshot) {
+        unique_lock<mutex> locky(lock);
+        snapshots.push_back(snapshot);
+    }, 16, milliseconds(5));
+
+    ASSERT_EQ(recorder.getCapacity(), 16u);
+
+    // 32 frames one millisecond apart; the ring keeps the newest 16, the window the newest 6
+    for (uint8_t i = 0; i < 32; i++) { recorder.record(makeFrame(0x100, i), 1, start + milliseconds(i)); }
+
+    CanFlightPattern pattern(0x7FF);
+    pattern.dataMask[0] = 0xFF;
+    pattern.data[0] = 0xAA;
+    recorder.addTrigger(pattern);
+
+    ASSERT_TRUE(recorder.record(makeFrame(0x7FF, 0xAA), 1, start + milliseconds(32)));
+    recorder.waitForSnapshots();
+
+    ASSERT_EQ(snapshots.size(), 1u);
+    ASSERT_EQ(snapshots[0].reason, CanFlightTriggerReason::Pattern);
+    ASSERT_EQ(snapshots[0].records.size(), 6u);
+    ASSERT_EQ(snapshots[0].records.front().data[0], 27);
+    ASSERT_EQ(snapshots[0].records.back().canId, 0x7FFu);
+    ASSERT_EQ(snapshots[0].records.back().ifindex, 1);
+
+    // Capture continues in a fresh region
+    ASSERT_FALSE(recorder.record(makeFrame(0x7FF, 0xAB), 1, start + milliseconds(33)));
+    recorder.record(makeFrame(0x100, 0x55), 1, start + milliseconds(34));
+    ASSERT_TRUE(recorder.trigger());
+    recorder.waitForSnapshots();
+
+    ASSERT_EQ(snapshots.size(), 2u);
+    ASSERT_EQ(snapshots[1].reason, CanFlightTriggerReason::Manual);
+    ASSERT_EQ(snapshots[1].records.size(), 0u); // the frames' timestamps lie far in the past
+    ASSERT_EQ(recorder.getStatistics().recorded, 35u);
+    ASSERT_EQ(recorder.getStatistics().triggers, 2u);
+}
+
+TEST(CanFlightRecorderTests, CanFlightRecorder_errorFrameWhileHandlerBusy_ExpectMissedTrigger) {
+    mutex handlerLock{};
+    unique_lock<mutex> blocked(handlerLock);
+    size_t handledRecords = 0;
+
+    CanFlightRecorder recorder([&](const CanFlightSnapshot& snapshot) {
+        unique_lock<mutex> locky(handlerLock);
+        handledRecords += snapshot.records.size();
+    }, 8, std::chrono::seconds(10), 2);
+
+    recorder.setErrorFrameTrigger(true);
+
+    const auto now = system_clock::now();
+    recorder.record(makeFrame(0x123, 1), 0, now);
+    ASSERT_TRUE(recorder.record(makeFrame(CAN_ERR_FLAG | CAN_ERR_BUSOFF, 0), 0, now));
+
+    // The only spare region is held by the blocked handler
+    recorder.record(makeFrame(0x123, 2), 0, now);
+    ASSERT_FALSE(recorder.record(makeFrame(CAN_ERR_FLAG | CAN_ERR_BUSOFF, 0), 0, now));
+    ASSERT_FALSE(recorder.trigger());
+
+    blocked.unlock();
+    recorder.waitForSnapshots();
+
+    ASSERT_EQ(handledRecords, 2u);
+    ASSERT_EQ(recorder.getStatistics().triggers, 1u);
+    ASSERT_EQ(recorder.getStatistics().missedTriggers, 2u);
+    ASSERT_TRUE(recorder.trigger());
+    recorder.waitForSnapshots();
+    ASSERT_EQ(handledRecords, 4u);
+}
+
+TEST(CanFlightRecorderTests, CanFlightRecorder_reusedRegion_ExpectNoStalePayload) {
+    mutex lock{};
+    vector<CanFlightSnapshot> snapshots{};
+    const auto start = system_clock::now(); // manual triggers use the current time
+
+    CanFlightRecorder recorder([&](const CanFlightSnapshot& snapshot) {
+        unique_lock<mutex> locky(lock);
+        snapshots.push_back(snapshot);
+    }, 16, milliseconds(1000), 2);
+
+    canfd_frame fdFrame{};
+    fdFrame.can_id = 0x100;
+    fdFrame.len = CANFD_MAX_DLEN;
+    std::fill(fdFrame.data, fdFrame.data + CANFD_MAX_DLEN, uint8_t(0xA5));
+
+    // Fill the first slot of both regions with long frames, so the next slot used is one written before
+    recorder.record(fdFrame, 1, start);
+    ASSERT_TRUE(recorder.trigger());
+    recorder.waitForSnapshots();
+    recorder.record(fdFrame, 1, start + milliseconds(1));
+    ASSERT_TRUE(recorder.trigger());
+    recorder.waitForSnapshots();
+
+    recorder.record(makeFrame(0x200, 0x5A), 1, start + milliseconds(2));
+    ASSERT_TRUE(recorder.trigger());
+    recorder.waitForSnapshots();
+
+    ASSERT_EQ(snapshots.size(), 3u);
+    ASSERT_EQ(snapshots[0].records.size(), 1u);
+    ASSERT_EQ(snapshots[2].records.size(), 1u);
+    ASSERT_EQ(snapshots[0].records.front().data[CANFD_MAX_DLEN - 1], 0xA5);
+
+    const auto& record = snapshots[2].records.back();
+    ASSERT_EQ(record.canId, 0x200u);
+    ASSERT_EQ(record.data[0], 0x5A);
+    for (size_t i = 1; i < CANFD_MAX_DLEN; i++) { ASSERT_EQ(record.data[i], 0) << i; }
+}
@@ -0,0 +1,162 @@
+/**
+ * @file CanFrameTiming_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanFrameTiming and CanBusLoadMeter classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanFrameTiming.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using sockcanpp::CanBusLoadMeter;
+using sockcanpp::CanFrameBits;
+using sockcanpp::CanFrameTiming;
+using sockcanpp::CanId;
+using sockcanpp::CanMessage;
+
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+    /**
+     * @brief Builds a classic frame bit by bit and stuffs it, as a reference for the table-driven implementation.
+     */
+    uint32_t referenceClassicBits(const can_frame& frame) {
+        vector<int> bits{0};
+        const auto append = [&bits](const uint32_t value, const int width) { for (int i = width - 1; i >= 0; i--) { bits.push_back((value >> i) & 1); } };
+        const auto remote = (frame.can_id & CAN_RTR_FLAG) != 0;
+
+        if (frame.can_id & CAN_EFF_FLAG) {
+            append((frame.can_id & CAN_EFF_MASK) >> 18, 11);
+            append(3, 2);
+            append(frame.can_id & 0x3FFFF, 18);
+        } else {
+            append(frame.can_id & CAN_SFF_MASK, 11);
+        }
+
+        append(remote, 1);
+        append(0, 2);
+        append(frame.can_dlc, 4);
+        if (!remote) { for (int i = 0; i < frame.can_dlc; i++) { append(frame.data[i], 8); } }
+
+        uint32_t crc = 0;
+        for (const auto bit : bits) {
+            const auto feedback = bit ^ ((crc >> 14) & 1);
+            crc = (crc << 1) & 0x7FFF;
+            if (feedback) { crc ^= 0x4599; }
+        }
+        append(crc, 15);
+
+        uint32_t stuffBits = 0;
+        int last = -1;
+        int run = 0;
+        for (const auto bit : bits) {
+            run = bit == last ? run + 1 : 1;
+            last = bit;
+            if (run == 5) {
+                stuffBits++;
+                last = !bit;
+                run = 1;
+            }
+        }
+
+        return static_cast<uint32_t>(bits.size()) + stuffBits + 10;
+    }
+
+}
+
+TEST(CanFrameTimingTests, CanFrameTiming_classicFrames_ExpectExactStuffedLength) {
+    can_frame frame{};
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).bits, 50u);      // 44 bits + 6 stuff bits
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).stuffBits, 6u);
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).dataPhaseBits, 0u);
+
+    std::mt19937 random(42);
+    for (int i = 0; i < 5000; i++) {
+        frame = can_frame{};
+        frame.can_id = (random() % 2) ? (random() & CAN_EFF_MASK) | CAN_EFF_FLAG : random() & CAN_SFF_MASK;
+        if (random() % 8 == 0) { frame.can_id |= CAN_RTR_FLAG; }
+        frame.can_dlc = random() % 9;
+        for (auto& byte : frame.data) { byte = (random() % 3) ? 0x00 : static_cast<uint8_t>(random()); }
+
+        ASSERT_EQ(CanFrameTiming::frameBits(frame).bits, referenceClassicBits(frame)) << "ID " << std::hex << frame.can_id;
+    }
+
+    // Messages with IDs above 0x7FF are sent as extended frames
+    const auto message = CanMessage(CanId(0x18FEF100), std::string("\x01\x02", 2));
+    auto raw = message.getRawFrame();
+    raw.can_id |= CAN_EFF_FLAG;
+    ASSERT_EQ(CanFrameTiming::frameBits(message).bits, referenceClassicBits(raw));
+}
+
+TEST(CanFrameTimingTests, CanFrameTiming_fdFrames_ExpectFixedStuffBitsAndDataPhase) {
+    canfd_frame frame{};
+
+    // 22 bits with 3 dynamic stuff bits, stuff count and CRC-17 with 6 fixed stuff bits, then the 10 bit trailer
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).bits, 62u);
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).stuffBits, 9u);
+
+    // Payloads are padded to the next FD length; above 16 bytes, the CRC has 21 bits
+    frame.len = 17;
+    const auto padded = CanFrameTiming::frameBits(frame);
+    frame.len = 20;
+    ASSERT_EQ(CanFrameTiming::frameBits(frame).bits, padded.bits);
+
+    // Alternating bits need no dynamic stuffing: four bytes, four CRC bits and one fixed stuff bit more
+    for (auto& byte : frame.data) { byte = 0x55; }
+    const auto longer = CanFrameTiming::frameBits(frame);
+    frame.len = 16;
+    ASSERT_EQ(longer.bits - CanFrameTiming::frameBits(frame).bits, 32u + 4u + 1u);
+
+    ASSERT_EQ(CanFrameTiming::fdLengthToDlc(13), 10);
+    ASSERT_EQ(CanFrameTiming::fdDlcToLength(15), 64);
+
+    // With BRS, everything from ESI to the CRC runs at the data bitrate
+    frame.len = 64;
+    frame.flags = CANFD_BRS;
+    const auto switched = CanFrameTiming::frameBits(frame);
+    ASSERT_GT(switched.dataPhaseBits, 64u * 8u);
+    ASSERT_LT(switched.bits - switched.dataPhaseBits, 40u);
+
+    const auto time = CanFrameTiming::frameTime(switched, 500000, 2000000);
+    const auto expected = nanoseconds((switched.bits - switched.dataPhaseBits + CanFrameTiming::INTERFRAME_BITS) * 2000 + switched.dataPhaseBits * 500);
+    ASSERT_EQ(time, expected);
+}
+
+TEST(CanFrameTimingTests, CanBusLoadMeter_stream_ExpectLoadOverSlidingWindow) {
+    CanBusLoadMeter meter(500000, 0, seconds(1));
+    const can_frame frame{}; // 50 bits + 3 bits interframe space = 106µs at 500kbit/s
+    const auto start = steady_clock::time_point(seconds(100));
+
+    for (int i = 0; i < 1000; i++) { meter.add(frame, start + milliseconds(i)); }
+
+    ASSERT_EQ(meter.getFrameCount(), 1000u);
+    ASSERT_EQ(meter.getBusyTime(), microseconds(106000));
+    ASSERT_NEAR(meter.getLoad(start + milliseconds(999)), 0.106, 0.002);
+
+    // Batches count every frame
+    can_frame batch[4]{};
+    meter.add(batch, 4, start + milliseconds(999));
+    ASSERT_EQ(meter.getFrameCount(), 1004u);
+
+    // Half a window later, half of the frames have left the window
+    ASSERT_NEAR(meter.getLoad(start + milliseconds(1500)), 0.053, 0.005);
+    ASSERT_EQ(meter.getLoad(start + seconds(3)), 0.0);
+
+    meter.reset();
+    ASSERT_EQ(meter.getFrameCount(), 0u);
+}
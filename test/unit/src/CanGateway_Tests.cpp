@@ -0,0 +1,174 @@
+/**
+ * @file CanGateway_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanGateway's rule encoding.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanGateway.hpp>
+
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanGateway;
+using sockcanpp::CanGatewayModOp;
+using sockcanpp::CanGatewayRule;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+    /**
+     * @brief Calculates a CRC8 the way the kernel does with a generated table.
+     */
+    uint8_t crc8(const uint8_t polynomial, const uint8_t initialValue, const uint8_t finalXor, const string& data) {
+        uint8_t table[256]{};
+        CanGateway::generateCrc8Table(polynomial, table);
+
+        auto crc = initialValue;
+        for (const auto byte : data) { crc = table[crc ^ static_cast<uint8_t>(byte)]; }
+
+        return static_cast<uint8_t>(crc ^ finalXor);
+    }
+
+    /**
+     * @brief Serialises a rule into a netlink message as a gateway request would.
+     */
+    vector<char> serialise(const CanGatewayRule& rule) {
+        vector<char> buffer(8192);
+        auto header = reinterpret_cast<nlmsghdr*>(buffer.data());
+        header->nlmsg_len = NLMSG_LENGTH(sizeof(rtcanmsg));
+        header->nlmsg_type = RTM_NEWROUTE;
+        reinterpret_cast<rtcanmsg*>(NLMSG_DATA(header))->can_family = AF_CAN;
+
+        CanGateway::appendRule(header, buffer.size(), rule);
+
+        return buffer;
+    }
+
+}
+
+TEST(CanGatewayTests, CanGateway_generateCrc8Table_ExpectStandardCheckValues) {
+    uint8_t table[256]{};
+    CanGateway::generateCrc8Table(0x1d, table);
+    ASSERT_EQ(table[0], 0x00);
+    ASSERT_EQ(table[1], 0x1d); // the kernel's dump relies on this to report the polynomial
+    ASSERT_EQ(table[2], 0x3a);
+
+    // Check values of the CRC catalogue for "123456789"
+    ASSERT_EQ(crc8(0x1d, 0xff, 0xff, "123456789"), 0x4b); // CRC-8/SAE-J1850
+    ASSERT_EQ(crc8(0x07, 0x00, 0x00, "123456789"), 0xf4); // CRC-8/SMBUS
+    ASSERT_EQ(crc8(0x2f, 0xff, 0xff, "123456789"), 0xdf); // CRC-8/AUTOSAR
+}
+
+TEST(CanGatewayTests, CanGateway_ruleRoundTrip_ExpectAllAttributesPreserved) {
+    can_frame operand{};
+    operand.can_id = 0x123;
+    operand.can_dlc = 8;
+    operand.data[7] = 0xa5;
+
+    CanGatewayRule rule("lo", "lo");
+    rule.setFilter(0x18FEF100 | CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_EFF_MASK)
+        .addModification(CanGatewayModOp::Set, CGW_MOD_ID, operand)
+        .addModification(CanGatewayModOp::Xor, CGW_MOD_DATA, operand);
+    rule.xorChecksum.enabled = true;
+    rule.xorChecksum.fromIndex = 0;
+    rule.xorChecksum.toIndex = 5;
+    rule.xorChecksum.resultIndex = 6;
+    rule.xorChecksum.initialValue = 0x42;
+    rule.crc8.enabled = true;
+    rule.crc8.fromIndex = 1;
+    rule.crc8.toIndex = -2;
+    rule.crc8.resultIndex = 0;
+    rule.crc8.initialValue = 0xff;
+    rule.crc8.finalXor = 0xff;
+    rule.crc8.polynomial = 0x2f;
+    rule.crc8.profile = CGW_CRC8PRF_16U8;
+    rule.crc8.profileData[0] = 0x77;
+    rule.hopLimit = 3;
+    rule.modificationUid = 0xC0FFEE;
+    rule.flags = CGW_FLAGS_CAN_ECHO;
+
+    const auto buffer = serialise(rule);
+    const auto parsed = CanGateway::parseRule(reinterpret_cast<const nlmsghdr*>(buffer.data())).rule;
+
+    ASSERT_EQ(parsed.sourceInterface, "lo");
+    ASSERT_EQ(parsed.destinationInterface, "lo");
+    ASSERT_TRUE(parsed.hasFilter);
+    ASSERT_EQ(parsed.filter.can_id, rule.filter.can_id);
+    ASSERT_EQ(parsed.filter.can_mask, rule.filter.can_mask);
+
+    ASSERT_EQ(parsed.modifications.size(), 2u);
+    ASSERT_EQ(parsed.modifications[0].op, CanGatewayModOp::Set);
+    ASSERT_EQ(parsed.modifications[0].elements, CGW_MOD_ID);
+    ASSERT_EQ(parsed.modifications[1].op, CanGatewayModOp::Xor);
+    ASSERT_EQ(parsed.modifications[1].elements, CGW_MOD_DATA);
+    ASSERT_EQ(std::memcmp(&parsed.modifications[1].frame, &operand, sizeof(operand)), 0);
+
+    ASSERT_TRUE(parsed.xorChecksum.enabled);
+    ASSERT_EQ(parsed.xorChecksum.toIndex, 5);
+    ASSERT_EQ(parsed.xorChecksum.resultIndex, 6);
+    ASSERT_EQ(parsed.xorChecksum.initialValue, 0x42);
+
+    ASSERT_TRUE(parsed.crc8.enabled);
+    ASSERT_EQ(parsed.crc8.fromIndex, 1);
+    ASSERT_EQ(parsed.crc8.toIndex, -2);
+    ASSERT_EQ(parsed.crc8.finalXor, 0xff);
+    ASSERT_EQ(parsed.crc8.polynomial, 0x2f);
+    ASSERT_EQ(parsed.crc8.profile, CGW_CRC8PRF_16U8);
+    ASSERT_EQ(parsed.crc8.profileData[0], 0x77);
+
+    ASSERT_EQ(parsed.hopLimit, 3);
+    ASSERT_EQ(parsed.modificationUid, 0xC0FFEEu);
+    ASSERT_EQ(parsed.flags, CGW_FLAGS_CAN_ECHO);
+}
+
+TEST(CanGatewayTests, CanGateway_minimalRule_ExpectOptionalAttributesOmitted) {
+    const auto buffer = serialise(CanGatewayRule("lo", "lo"));
+    const auto header = reinterpret_cast<const nlmsghdr*>(buffer.data());
+
+    // Only the two interface indices follow the rtcanmsg
+    ASSERT_EQ(header->nlmsg_len, NLMSG_LENGTH(sizeof(rtcanmsg)) + 2 * RTA_SPACE(sizeof(uint32_t)));
+
+    const auto parsed = CanGateway::parseRule(header).rule;
+    ASSERT_FALSE(parsed.hasFilter);
+    ASSERT_TRUE(parsed.modifications.empty());
+    ASSERT_FALSE(parsed.xorChecksum.enabled);
+    ASSERT_FALSE(parsed.crc8.enabled);
+    ASSERT_EQ(parsed.hopLimit, 0);
+
+    ASSERT_THROW(serialise(CanGatewayRule("lo", "nosuchcan0")), std::exception);
+}
+
+TEST(CanGatewayTests, CanGateway_flush_ExpectBothInterfacesZero) {
+    vector<char> buffer(8192);
+    auto header = reinterpret_cast<nlmsghdr*>(buffer.data());
+    header->nlmsg_len = NLMSG_LENGTH(sizeof(rtcanmsg));
+    header->nlmsg_type = RTM_DELROUTE;
+
+    CanGateway::appendFlush(header, buffer.size());
+    ASSERT_EQ(header->nlmsg_len, NLMSG_LENGTH(sizeof(rtcanmsg)) + 2 * RTA_SPACE(sizeof(uint32_t)));
+
+    // The kernel only flushes if both interface attributes are present and zero, as sent by cangw -F
+    auto attribute = reinterpret_cast<const rtattr*>(reinterpret_cast<const char*>(NLMSG_DATA(header)) + NLMSG_ALIGN(sizeof(rtcanmsg)));
+    int32_t remaining = static_cast<int32_t>(header->nlmsg_len - NLMSG_LENGTH(sizeof(rtcanmsg)));
+    vector<uint16_t> types{};
+
+    for (; RTA_OK(attribute, remaining); attribute = RTA_NEXT(attribute, remaining)) {
+        ASSERT_EQ(RTA_PAYLOAD(attribute), sizeof(uint32_t));
+        ASSERT_EQ(*reinterpret_cast<const uint32_t*>(RTA_DATA(attribute)), 0u);
+        types.push_back(attribute->rta_type);
+    }
+
+    ASSERT_EQ(types, (vector<uint16_t>{ CGW_SRC_IF, CGW_DST_IF }));
+}
@@ -13,6 +13,7 @@
 #include <CanId.hpp>
 
 using sockcanpp::CanId;
+using sockcanpp::normaliseCanId;
 
 TEST(CanIdTests, CanId_invalidId_ExpectFalse) {
     ASSERT_FALSE(CanId::isValidIdentifier(-1));
@@ -275,4 +276,13 @@ TEST(CanIdTests, CanId_ArithmeticOperatorModuloEquals_ExpectTrue) {
     CanId id(0x123);
     id %= 2;
     ASSERT_EQ(id, 1);
+}
+
+TEST(CanIdTests, CanId_normaliseCanId_ExpectSingleKeyPerId) {
+    ASSERT_EQ(normaliseCanId(0x123), 0x123u);
+    ASSERT_EQ(normaliseCanId(0x123 | CAN_RTR_FLAG), 0x123u);
+    ASSERT_EQ(normaliseCanId(0x40 | CAN_ERR_FLAG), 0x40u);
+    ASSERT_EQ(normaliseCanId(0x1234567), 0x1234567u | CAN_EFF_FLAG);
+    ASSERT_EQ(normaliseCanId(0x1234567 | CAN_EFF_FLAG | CAN_RTR_FLAG), 0x1234567u | CAN_EFF_FLAG);
+    ASSERT_EQ(normaliseCanId(0x123 | CAN_EFF_FLAG), 0x123u | CAN_EFF_FLAG);
 }
\ No newline at end of file
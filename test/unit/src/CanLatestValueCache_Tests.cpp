@@ -0,0 +1,124 @@
+/**
+ * @file CanLatestValueCache_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanLatestValueCache class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanLatestValueCache.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using sockcanpp::CanId;
+using sockcanpp::CanLatestValue;
+using sockcanpp::CanLatestValueCache;
+using sockcanpp::CanMessage;
+
+using std::atomic;
+using std::thread;
+using std::vector;
+
+TEST(CanLatestValueCacheTests, CanLatestValueCache_unknownId_ExpectNoValue) {
+    CanLatestValueCache cache;
+    CanLatestValue value{};
+
+    ASSERT_FALSE(cache.read(0x123, value));
+    ASSERT_FALSE(cache.read(0x1234567, value));
+    ASSERT_EQ(value.updates, 0u);
+}
+
+TEST(CanLatestValueCacheTests, CanLatestValueCache_update_ExpectNewestFrame) {
+    CanLatestValueCache cache;
+    CanLatestValue value{};
+
+    cache.update(CanMessage(0x123, "old"));
+    cache.update(CanMessage(0x123, "new"));
+    cache.update(CanMessage(0x1234567, "ext"));
+
+    ASSERT_TRUE(cache.read(0x123, value));
+    ASSERT_EQ(value.updates, 2u);
+    ASSERT_EQ(value.frame.can_dlc, 3);
+    ASSERT_EQ(std::memcmp(value.frame.data, "new", 3), 0);
+
+    ASSERT_TRUE(cache.read(0x1234567, value));
+    ASSERT_EQ(value.updates, 1u);
+    ASSERT_EQ(cache.getExtendedCount(), 1u);
+}
+
+TEST(CanLatestValueCacheTests, CanLatestValueCache_remoteRequest_ExpectValueKept) {
+    CanLatestValueCache cache;
+    CanLatestValue value{};
+
+    cache.update(CanMessage(0x123, "value"));
+
+    can_frame request{};
+    request.can_id = 0x123 | CAN_RTR_FLAG;
+    request.can_dlc = 8;
+
+    ASSERT_FALSE(cache.update(request));
+    ASSERT_TRUE(cache.read(0x123, value));
+    ASSERT_EQ(value.updates, 1u);
+    ASSERT_EQ(value.frame.can_dlc, 5);
+    ASSERT_EQ(std::memcmp(value.frame.data, "value", 5), 0);
+}
+
+TEST(CanLatestValueCacheTests, CanLatestValueCache_extendedTableFull_ExpectDroppedFrames) {
+    CanLatestValueCache cache(2);
+
+    ASSERT_TRUE(cache.update(CanMessage(0x10000, "")));
+    ASSERT_TRUE(cache.update(CanMessage(0x20000, "")));
+    ASSERT_FALSE(cache.update(CanMessage(0x30000, "")));
+    ASSERT_TRUE(cache.update(CanMessage(0x10000, "")));
+
+    ASSERT_EQ(cache.getExtendedCount(), 2u);
+    ASSERT_EQ(cache.getDroppedCount(), 1u);
+}
+
+TEST(CanLatestValueCacheTests, CanLatestValueCache_concurrentWriter_ExpectConsistentSnapshots) {
+    CanLatestValueCache cache;
+    atomic<bool> running{true};
+
+    // The writer always stores the same counter in both IDs and in all payload bytes
+    thread writer([&]() {
+        can_frame frame{};
+        frame.can_dlc = 8;
+
+        for (uint8_t counter = 0; running.load(); counter++) {
+            std::memset(frame.data, counter, sizeof(frame.data));
+
+            frame.can_id = 0x100;
+            cache.update(frame);
+            frame.can_id = 0x200;
+            cache.update(frame);
+        }
+    });
+
+    const vector<CanId> ids{ 0x200, 0x100 };
+    vector<CanLatestValue> values{};
+    uint32_t consistentSnapshots = 0;
+
+    for (int32_t i = 0; i < 20000; i++) {
+        if (!cache.snapshot(ids, values)) { continue; }
+        consistentSnapshots++;
+
+        for (const auto& value : values) {
+            for (const auto byte : value.frame.data) { ASSERT_EQ(byte, value.frame.data[0]); }
+        }
+
+        // Reading 0x200 first: a consistent snapshot never sees it ahead of 0x100
+        ASSERT_LE(values[0].updates, values[1].updates);
+    }
+
+    running = false;
+    writer.join();
+
+    ASSERT_GT(consistentSnapshots, 0u);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file CanMux_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanMuxServer and CanMuxClient classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanMuxClient.hpp>
+#include <CanMuxServer.hpp>
+
+#include <TestHelpers.hpp>
+#include <exceptions/CanInitException.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanMuxClient;
+using sockcanpp::CanMuxFrame;
+using sockcanpp::CanMuxServer;
+using sockcanpp::exceptions::CanInitException;
+
+using std::lock_guard;
+using std::mutex;
+using std::string;
+using std::thread;
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace {
+
+    /**
+     * @brief A driver without a socket which records the frames it is asked to send.
+     */
+    class RecordingDriver: public CanDriver {
+        public:
+            size_t sendFrames(const can_frame* frames, const size_t frameCount) override {
+                lock_guard<mutex> locky(lock);
+                sent.insert(sent.end(), frames, frames + frameCount);
+                return frameCount;
+            }
+
+            vector<can_frame> getSent() {
+                lock_guard<mutex> locky(lock);
+                return sent;
+            }
+
+        private:
+            mutex             lock{};
+            vector<can_frame> sent{};
+    };
+
+    /**
+     * @brief Runs a server with a single bus named vcan0 for the duration of a test.
+     */
+    class MuxFixture {
+        public:
+            MuxFixture(): path(testhelpers::tempPath("mux", ".sock")), server(path) {
+                server.addBus("vcan0", driver);
+                serverThread = thread([this]() { server.run(); });
+            }
+
+            ~MuxFixture() {
+                server.stop();
+                serverThread.join();
+            }
+
+            string          path;
+            RecordingDriver driver{};
+            CanMuxServer    server;
+            thread          serverThread{};
+    };
+
+    can_frame makeFrame(const canid_t id) {
+        can_frame frame{};
+        frame.can_id = id;
+        frame.can_dlc = 0;
+
+        return frame;
+    }
+
+}
+
+TEST(CanMuxTests, CanMuxClient_unknownInterface_ExpectInitException) {
+    MuxFixture fixture;
+
+    ASSERT_THROW(CanMuxClient(fixture.path, "can7"), CanInitException);
+}
+
+TEST(CanMuxTests, CanMuxClient_subscribeWithFilter_ExpectOnlyMatchingFrames) {
+    MuxFixture fixture;
+    CanMuxClient client(fixture.path, "vcan0", { can_filter{ 0x100, CAN_SFF_MASK & ~0xFu } });
+
+    vector<can_frame> frames{};
+    for (canid_t id = 0xF0; id < 0x120; id++) { frames.push_back(makeFrame(id)); }
+    fixture.server.publish("vcan0", frames.data(), frames.size());
+
+    vector<CanMuxFrame> received{};
+    ASSERT_TRUE(client.waitForFrames(milliseconds(1000)));
+    ASSERT_EQ(client.readFrames(received), 16u);
+
+    for (size_t i = 0; i < received.size(); i++) { ASSERT_EQ(received[i].frame.can_id, 0x100u + i); }
+}
+
+TEST(CanMuxTests, CanMuxClient_invertedAndEmptyFilters_ExpectKernelSemantics) {
+    MuxFixture fixture;
+    CanMuxClient inverted(fixture.path, "vcan0", { can_filter{ 0x100 | CAN_INV_FILTER, CAN_SFF_MASK } });
+    CanMuxClient nothing(fixture.path, "vcan0", {});
+
+    const vector<can_frame> frames{ makeFrame(0x100), makeFrame(0x101) };
+    fixture.server.publish("vcan0", frames.data(), frames.size());
+
+    vector<CanMuxFrame> received{};
+    ASSERT_TRUE(inverted.waitForFrames(milliseconds(1000)));
+    ASSERT_EQ(inverted.readFrames(received), 1u);
+    ASSERT_EQ(received[0].frame.can_id, 0x101u);
+
+    ASSERT_FALSE(nothing.waitForFrames(milliseconds(50)));
+}
+
+TEST(CanMuxTests, CanMuxClient_sendFrames_ExpectSentOnBus) {
+    MuxFixture fixture;
+    CanMuxClient client(fixture.path, "vcan0");
+
+    const vector<can_frame> frames(300, makeFrame(0x321));
+    ASSERT_EQ(client.sendFrames(frames.data(), frames.size()), 300u);
+
+    for (int32_t i = 0; i < 100 && fixture.driver.getSent().size() < 300; i++) { std::this_thread::sleep_for(milliseconds(10)); }
+
+    const auto sent = fixture.driver.getSent();
+    ASSERT_EQ(sent.size(), 300u);
+    ASSERT_EQ(sent.back().can_id, 0x321u);
+}
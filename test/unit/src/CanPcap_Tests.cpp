@@ -0,0 +1,120 @@
+/**
+ * @file CanPcap_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanPcapWriter and CanPcapReader classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanPcap.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanPcapFrame;
+using sockcanpp::CanPcapReader;
+using sockcanpp::CanPcapWriter;
+
+using std::string;
+using std::vector;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    string capturePath(const string& name) { return testhelpers::tempPath(name, ".pcapng"); }
+
+}
+
+TEST(CanPcapTests, CanPcap_writeAndRead_ExpectFramesAndInterfacesPreserved) {
+    const auto path = capturePath("pcap");
+    const auto timestamp = system_clock::time_point(nanoseconds(1700000000123456789));
+
+    {
+        // A small buffer forces several writes
+        CanPcapWriter writer(path, 4096);
+        const auto can0 = writer.addInterface("can0");
+        const auto can1 = writer.addInterface("can1");
+
+        for (uint32_t i = 0; i < 200; i++) {
+            can_frame frame{};
+            frame.can_id = 0x100 + i;
+            frame.can_dlc = 3;
+            frame.data[2] = static_cast<uint8_t>(i);
+            writer.write(can0, frame, timestamp + nanoseconds(i));
+        }
+
+        canfd_frame fdFrame{};
+        fdFrame.can_id = 0x18FEF100 | CAN_EFF_FLAG;
+        fdFrame.len = 48;
+        fdFrame.flags = CANFD_BRS;
+        memset(fdFrame.data, 0x5A, fdFrame.len);
+        writer.write(can1, fdFrame, timestamp);
+
+        ASSERT_EQ(writer.getFrameCount(), 201u);
+    }
+
+    CanPcapReader reader(path);
+    CanPcapFrame frame{};
+    vector<CanPcapFrame> frames{};
+
+    while (reader.next(frame)) { frames.push_back(frame); }
+    unlink(path.c_str());
+
+    ASSERT_EQ(frames.size(), 201u);
+    ASSERT_EQ(reader.getInterfaces().size(), 2u);
+    ASSERT_EQ(reader.getInterfaces()[1].name, "can1");
+
+    ASSERT_FALSE(frames[7].isFd);
+    ASSERT_EQ(frames[7].frame.can_id, 0x107u);
+    ASSERT_EQ(frames[7].frame.len, 3u);
+    ASSERT_EQ(frames[7].frame.data[2], 7u);
+    ASSERT_EQ(frames[7].timestamp, timestamp + nanoseconds(7));
+
+    const auto& fd = frames.back();
+    ASSERT_TRUE(fd.isFd);
+    ASSERT_EQ(fd.interface, 1u);
+    ASSERT_EQ(fd.frame.can_id, 0x18FEF100u | CAN_EFF_FLAG);
+    ASSERT_EQ(fd.frame.len, 48u);
+    ASSERT_EQ(fd.frame.flags, CANFD_BRS);
+    ASSERT_EQ(fd.frame.data[47], 0x5A);
+}
+
+TEST(CanPcapTests, CanPcap_blockLayout_ExpectSocketCanLinkTypeAndBigEndianId) {
+    const auto path = capturePath("pcap-layout");
+
+    {
+        CanPcapWriter writer(path);
+        can_frame frame{};
+        frame.can_id = 0x123;
+        writer.write(writer.addInterface("can0"), frame);
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    const vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    unlink(path.c_str());
+
+    uint16_t linkType = 0;
+    memcpy(&linkType, data.data() + 28 + 8, sizeof(linkType));
+    ASSERT_EQ(linkType, 227u);
+
+    // The packet follows the interface description; the ID is stored big-endian
+    uint32_t idbLength = 0;
+    memcpy(&idbLength, data.data() + 28 + 4, sizeof(idbLength));
+    const auto packet = data.data() + 28 + idbLength + 28;
+    ASSERT_EQ(packet[2], 0x01);
+    ASSERT_EQ(packet[3], 0x23);
+    ASSERT_EQ(data.size(), 28u + idbLength + 28u + 16u + 4u);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file CanRecordAnalyser_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanRecordAnalyser class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanRecordAnalyser.hpp>
+#include <CanRecorder.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <string>
+
+using sockcanpp::CanRecordAnalyser;
+using sockcanpp::CanRecordAnalysisOptions;
+using sockcanpp::CanRecorder;
+using sockcanpp::CanRecordQuery;
+using sockcanpp::CanRecordReader;
+
+using testhelpers::START;
+
+using std::string;
+using std::chrono::milliseconds;
+
+namespace {
+
+    /**
+     * @brief Records 3 seconds of traffic: 0x100 every 10 ms and 0x200 every 100 ms, with a 50 ms gap in 0x100.
+     */
+    string writeRecording() {
+        return testhelpers::writeRecording("analyser", [](CanRecorder& recorder) {
+            for (int32_t ms = 0; ms < 3000; ms++) {
+                can_frame frame{};
+                frame.can_dlc = 2;
+                frame.data[0] = static_cast<uint8_t>(ms % 4);
+
+                if (ms % 10 == 0 && (ms < 1000 || ms >= 1050)) {
+                    frame.can_id = 0x100;
+                    recorder.record(frame, 1, START + milliseconds(ms));
+                }
+
+                if (ms % 100 == 0) {
+                    frame.can_id = 0x200;
+                    recorder.record(frame, 1, START + milliseconds(ms));
+                }
+            }
+        }, 64);
+    }
+
+}
+
+TEST(CanRecordAnalyserTests, CanRecordAnalyser_analyse_ExpectPerIdStatistics) {
+    const auto path = writeRecording();
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    CanRecordAnalysisOptions options{};
+    options.byteHistograms = true;
+    options.blocksPerTask = 1;
+
+    const auto analysis = CanRecordAnalyser(reader, options).analyse();
+    ASSERT_EQ(analysis.records, 295u + 30u);
+
+    const auto& frequent = analysis.ids.at(0x100);
+    ASSERT_EQ(frequent.count, 295u);
+    ASSERT_EQ(frequent.minInterval, 10000000);
+    ASSERT_EQ(frequent.maxInterval, 60000000);
+    ASSERT_EQ(frequent.byteHistogram.size(), 2u * 256u);
+    ASSERT_EQ(frequent.byteHistogram[0] + frequent.byteHistogram[2], 295u);
+
+    ASSERT_EQ(analysis.busLoad.size(), 3u);
+    ASSERT_EQ(analysis.busLoad[0].frames, 100u + 10u);
+    ASSERT_EQ(analysis.busLoad[1].frames, 95u + 10u);
+    ASSERT_GT(analysis.busLoad[0].load, 0.0);
+}
+
+TEST(CanRecordAnalyserTests, CanRecordAnalyser_threadCounts_ExpectIdenticalResults) {
+    const auto path = writeRecording();
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    const CanRecordQuery query(START + milliseconds(500), START + milliseconds(2499), { 0x100 });
+
+    CanRecordAnalysisOptions options{};
+    options.threads = 1;
+    const auto single = CanRecordAnalyser(reader, options).analyse(query);
+
+    options.threads = 8;
+    options.blocksPerTask = 1;
+    const auto parallel = CanRecordAnalyser(reader, options).analyse(query);
+
+    ASSERT_EQ(single.records, 195u);
+    ASSERT_EQ(single.records, parallel.records);
+    ASSERT_EQ(single.ids.size(), 1u);
+    ASSERT_EQ(single.ids.at(0x100).maxInterval, parallel.ids.at(0x100).maxInterval);
+    ASSERT_EQ(single.ids.at(0x100).minInterval, parallel.ids.at(0x100).minInterval);
+    ASSERT_EQ(single.ids.at(0x100).lastTimestamp, parallel.ids.at(0x100).lastTimestamp);
+    ASSERT_EQ(single.busLoad.size(), parallel.busLoad.size());
+    ASSERT_EQ(single.busLoad[1].bits, parallel.busLoad[1].bits);
+}
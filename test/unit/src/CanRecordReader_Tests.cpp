@@ -0,0 +1,124 @@
+/**
+ * @file CanRecordReader_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanRecordReader class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanRecorder.hpp>
+#include <CanRecordReader.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanRecord;
+using sockcanpp::CanRecordFileHeader;
+using sockcanpp::CanRecorder;
+using sockcanpp::CanRecordQuery;
+using sockcanpp::CanRecordReader;
+
+using testhelpers::START;
+
+using std::string;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    /**
+     * @brief Records one frame per millisecond; 0x18FEF100 is only sent during the second half.
+     *
+     * Enough buffers are used for the whole recording, so nothing is dropped however slow the disk is.
+     */
+    string writeRecording(const size_t frameCount) {
+        return testhelpers::writeRecording("reader", [frameCount](CanRecorder& recorder) {
+            for (size_t i = 0; i < frameCount; i++) {
+                can_frame frame{};
+                frame.can_id = (i >= frameCount / 2 && i % 10 == 0) ? (0x18FEF100 | CAN_EFF_FLAG) : static_cast<canid_t>(0x100 + i % 8);
+                frame.can_dlc = 1;
+                frame.data[0] = static_cast<uint8_t>(i);
+
+                recorder.record(frame, 1, START + milliseconds(i));
+            }
+        }, 32);
+    }
+
+}
+
+TEST(CanRecordReaderTests, CanRecordReader_open_ExpectAllBlocksIndexed) {
+    const auto path = writeRecording(1000);
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    ASSERT_EQ(reader.getRecordCount(), 1000u);
+    ASSERT_GT(reader.getBlockCount(), 10u);
+    ASSERT_EQ(reader.query(CanRecordQuery{}).size(), 1000u);
+}
+
+TEST(CanRecordReaderTests, CanRecordReader_headerSizeBeyondFile_ExpectRejected) {
+    const auto path = writeRecording(1000);
+
+    const auto fd = open(path.c_str(), O_WRONLY);
+    const uint32_t headerSize = UINT32_MAX;
+    ASSERT_EQ(pwrite(fd, &headerSize, sizeof(headerSize), offsetof(CanRecordFileHeader, headerSize)), static_cast<ssize_t>(sizeof(headerSize)));
+    close(fd);
+
+    ASSERT_THROW(CanRecordReader reader(path), std::exception);
+    unlink(path.c_str());
+}
+
+TEST(CanRecordReaderTests, CanRecordReader_otherVersion_ExpectRejected) {
+    const auto path = writeRecording(100);
+
+    for (const uint32_t version : { CanRecordFileHeader::VERSION - 1, CanRecordFileHeader::VERSION + 1 }) {
+        const auto fd = open(path.c_str(), O_WRONLY);
+        ASSERT_EQ(pwrite(fd, &version, sizeof(version), offsetof(CanRecordFileHeader, version)), static_cast<ssize_t>(sizeof(version)));
+        close(fd);
+
+        ASSERT_THROW(CanRecordReader reader(path), std::exception) << version;
+    }
+
+    unlink(path.c_str());
+}
+
+TEST(CanRecordReaderTests, CanRecordReader_timeWindow_ExpectOnlyWindowRecords) {
+    const auto path = writeRecording(1000);
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    const auto records = reader.query(CanRecordQuery(START + milliseconds(200), START + milliseconds(299)));
+    ASSERT_LT(reader.findEndBlock((START + milliseconds(299)).time_since_epoch().count()), reader.getBlockCount() / 2);
+    ASSERT_EQ(records.size(), 100u);
+    ASSERT_EQ(records.front().data[0], 200);
+    ASSERT_EQ(records.back().data[0], static_cast<uint8_t>(299));
+
+    const auto first = reader.findFirstBlock(records.front().timestamp);
+    ASSERT_GT(first, 0u);
+    ASSERT_LE(reader.getBlock(first).minTimestamp, records.front().timestamp);
+}
+
+TEST(CanRecordReaderTests, CanRecordReader_idQuery_ExpectBlocksWithoutIdSkipped) {
+    const auto path = writeRecording(1000);
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    const CanRecordQuery query(system_clock::time_point::min(), system_clock::time_point::max(), { 0x18FEF100 });
+
+    // Extended IDs are matched with or without CAN_EFF_FLAG
+    ASSERT_EQ(reader.query(query).size(), 50u);
+    ASSERT_FALSE(reader.mayContain(0, query));
+    ASSERT_TRUE(reader.mayContain(reader.getBlockCount() - 1, query));
+}
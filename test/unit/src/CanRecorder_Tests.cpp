@@ -0,0 +1,166 @@
+/**
+ * @file CanRecorder_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanRecorder class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanRecorder.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanRecord;
+using sockcanpp::CanRecordBlockHeader;
+using sockcanpp::CanRecorder;
+using sockcanpp::CanRecordFileHeader;
+using sockcanpp::CAN_RECORD_BRS;
+using sockcanpp::CAN_RECORD_FD;
+using sockcanpp::CAN_RECORD_TX;
+
+using testhelpers::LoopbackTransport;
+
+using std::string;
+using std::vector;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+namespace {
+
+    string logPath(const string& name) { return testhelpers::tempPath(name, ".log"); }
+
+    vector<uint8_t> readFile(const string& path) {
+        std::ifstream file(path, std::ios::binary);
+
+        return vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    const CanRecordBlockHeader* blockAt(const vector<uint8_t>& file, const size_t blockSize, const size_t block) {
+        return reinterpret_cast<const CanRecordBlockHeader*>(file.data() + CanRecordFileHeader::SIZE + block * blockSize);
+    }
+
+    const CanRecord* recordAt(const vector<uint8_t>& file, const size_t blockSize, const size_t block, const size_t record) {
+        return reinterpret_cast<const CanRecord*>(file.data() + CanRecordFileHeader::SIZE + block * blockSize + sizeof(CanRecordBlockHeader)) + record;
+    }
+
+}
+
+TEST(CanRecorderTests, CanRecorder_recordFrames_ExpectBlocksInOrder) {
+    const auto path = logPath("recorder");
+    const auto start = system_clock::time_point(nanoseconds(1000000000));
+    size_t recordsPerBlock = 0;
+
+    {
+        CanRecorder recorder(path, 4096);
+        recordsPerBlock = recorder.getRecordsPerBlock();
+
+        for (uint32_t i = 0; i < recordsPerBlock + 10; i++) {
+            can_frame frame{};
+            frame.can_id = i;
+            frame.can_dlc = 4;
+            memcpy(frame.data, &i, sizeof(i));
+            ASSERT_TRUE(recorder.record(frame, 3, start + nanoseconds(i)));
+        }
+
+        recorder.close();
+
+        const auto statistics = recorder.getStatistics();
+        ASSERT_EQ(statistics.recorded, recordsPerBlock + 10);
+        ASSERT_EQ(statistics.blocksWritten, 2u);
+        ASSERT_EQ(statistics.dropped, 0u);
+        ASSERT_GE(statistics.syncs, 1u);
+        ASSERT_FALSE(recorder.record(can_frame{}));
+    }
+
+    const auto file = readFile(path);
+    unlink(path.c_str());
+    ASSERT_EQ(file.size(), CanRecordFileHeader::SIZE + 2 * 4096);
+
+    const auto header = reinterpret_cast<const CanRecordFileHeader*>(file.data());
+    ASSERT_EQ(header->magic, static_cast<uint64_t>(CanRecordFileHeader::MAGIC));
+    ASSERT_EQ(header->blockSize, 4096u);
+    ASSERT_EQ(header->recordSize, sizeof(CanRecord));
+
+    ASSERT_EQ(blockAt(file, 4096, 0)->recordCount, recordsPerBlock);
+    ASSERT_EQ(blockAt(file, 4096, 1)->recordCount, 10u);
+    ASSERT_EQ(blockAt(file, 4096, 1)->sequence, 1u);
+    ASSERT_EQ(blockAt(file, 4096, 1)->minTimestamp, 1000000000 + static_cast<int64_t>(recordsPerBlock));
+
+    const auto last = recordAt(file, 4096, 1, 9);
+    uint32_t value = 0;
+    memcpy(&value, last->data, sizeof(value));
+
+    ASSERT_EQ(last->canId, recordsPerBlock + 9);
+    ASSERT_EQ(value, recordsPerBlock + 9);
+    ASSERT_EQ(last->ifindex, 3);
+    ASSERT_EQ(last->length, 4u);
+}
+
+TEST(CanRecorderTests, CanRecorder_fdFrame_ExpectFullPayloadAndFlags) {
+    const auto path = logPath("recorder-fd");
+
+    {
+        CanRecorder recorder(path, 4096);
+
+        canfd_frame frame{};
+        frame.can_id = 0x18FEF100 | CAN_EFF_FLAG;
+        frame.len = CANFD_MAX_DLEN;
+        frame.flags = CANFD_BRS;
+        memset(frame.data, 0xA5, sizeof(frame.data));
+
+        ASSERT_TRUE(recorder.record(frame, 1, system_clock::now(), CAN_RECORD_TX));
+        recorder.flush();
+    }
+
+    const auto file = readFile(path);
+    unlink(path.c_str());
+
+    const auto record = recordAt(file, 4096, 0, 0);
+    ASSERT_EQ(blockAt(file, 4096, 0)->recordCount, 1u);
+    ASSERT_EQ(record->length, CANFD_MAX_DLEN);
+    ASSERT_EQ(record->flags, CAN_RECORD_FD | CAN_RECORD_BRS | CAN_RECORD_TX);
+    ASSERT_EQ(record->data[CANFD_MAX_DLEN - 1], 0xA5);
+}
+
+TEST(CanRecorderTests, CanRecorder_receiveFrom_ExpectAllPendingBatchesRecorded) {
+    const auto path = logPath("recorder-receive");
+    const auto transport = std::make_shared<LoopbackTransport>();
+    CanDriver driver("loop0", CAN_RAW, transport);
+
+    // More than one batch is pending; all of them are read
+    const auto frameCount = CanDriver::CAN_MAX_BATCH_SIZE + 10;
+
+    for (uint32_t i = 0; i < frameCount; i++) {
+        can_frame frame{};
+        frame.can_id = i;
+        ASSERT_EQ(write(transport->getPeer(driver.getSocketFd()), &frame, sizeof(frame)), static_cast<ssize_t>(sizeof(frame)));
+    }
+
+    {
+        CanRecorder recorder(path, 4096);
+        ASSERT_EQ(recorder.receiveFrom(driver, 7, milliseconds(100)), frameCount);
+        ASSERT_EQ(recorder.receiveFrom(driver, 7, milliseconds(0)), 0u);
+    }
+
+    const auto file = readFile(path);
+    unlink(path.c_str());
+
+    ASSERT_EQ(blockAt(file, 4096, 0)->recordCount + blockAt(file, 4096, 1)->recordCount, frameCount);
+    ASSERT_EQ(recordAt(file, 4096, 0, 0)->ifindex, 7);
+}
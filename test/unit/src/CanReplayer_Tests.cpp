@@ -0,0 +1,145 @@
+/**
+ * @file CanReplayer_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanReplayer class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanClock.hpp>
+#include <CanRecorder.hpp>
+#include <CanReplayer.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanCandumpReader;
+using sockcanpp::CanDriver;
+using sockcanpp::CanManualClock;
+using sockcanpp::CanRecorder;
+using sockcanpp::CanRecordReader;
+using sockcanpp::CanReplayer;
+
+using testhelpers::START;
+using testhelpers::tempPath;
+
+using std::string;
+using std::vector;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+    /**
+     * @brief A driver without a socket which remembers what was sent, and when.
+     */
+    class TimingDriver: public CanDriver {
+        public:
+            size_t sendFrames(const can_frame* frames, const size_t frameCount) override {
+                for (size_t i = 0; i < frameCount; i++) {
+                    sent.push_back(frames[i]);
+                    sendTimes.push_back(steady_clock::now());
+                }
+
+                return frameCount;
+            }
+
+            vector<can_frame>                   sent{};
+            vector<steady_clock::time_point>    sendTimes{};
+    };
+
+    string writeRecording(const string& name) {
+        return testhelpers::writeRecording(name, [](CanRecorder& recorder) {
+            for (uint32_t i = 0; i < 5; i++) {
+                can_frame frame{};
+                frame.can_id = 0x100 + i;
+                recorder.record(frame, i == 4 ? 9 : 1, START + milliseconds(20 * i));
+            }
+        });
+    }
+
+}
+
+TEST(CanReplayerTests, CanReplayer_speedFactor_ExpectScaledAbsoluteTiming) {
+    const auto path = writeRecording("replay");
+    CanRecordReader reader(path);
+    unlink(path.c_str());
+
+    TimingDriver driver;
+    CanReplayer replayer(2.0);
+    replayer.mapInterface(1, driver);
+
+    ASSERT_EQ(replayer.replay(reader), 4u);
+    ASSERT_EQ(replayer.getStatistics().unmapped, 1u);
+    ASSERT_EQ(driver.sent[3].can_id, 0x103u);
+
+    // 60 ms of traffic at twice the speed
+    const auto elapsed = duration_cast<milliseconds>(driver.sendTimes.back() - driver.sendTimes.front());
+    ASSERT_GE(elapsed.count(), 30);
+    ASSERT_LT(elapsed.count(), 60);
+
+    const auto timing = replayer.getTimingErrorHistogram();
+    ASSERT_EQ(timing.count, 4u);
+}
+
+TEST(CanReplayerTests, CanReplayer_asFastAsPossible_ExpectNoWaiting) {
+    const auto path = tempPath("replay-candump", ".log");
+
+    {
+        std::ofstream log(path);
+        log << "(1700000000.000000) can0 123#01\n(1700000010.000000) can1 456#02\n(1700000020.000000) can0 789#03\n";
+    }
+
+    CanCandumpReader reader(path);
+    unlink(path.c_str());
+
+    TimingDriver can0;
+    TimingDriver can1;
+    CanReplayer replayer(CanReplayer::AS_FAST_AS_POSSIBLE);
+    replayer.mapInterface("can0", can0);
+    replayer.mapInterface("can1", can1);
+
+    const auto start = steady_clock::now();
+    ASSERT_EQ(replayer.replay(reader), 3u);
+    ASSERT_LT(steady_clock::now() - start, milliseconds(1000));
+
+    ASSERT_EQ(can0.sent.size(), 2u);
+    ASSERT_EQ(can1.sent.front().can_id, 0x456u);
+}
+
+TEST(CanReplayerTests, CanReplayer_manualClock_ExpectRecordedTimingWithoutWaiting) {
+    const auto path = tempPath("replay-manual", ".log");
+
+    {
+        std::ofstream log(path);
+        log << "(1700000000.000000) can0 123#01\n(1700000600.000000) can0 456#02\n(1700003600.000000) can0 789#03\n";
+    }
+
+    CanCandumpReader reader(path);
+    unlink(path.c_str());
+
+    TimingDriver driver;
+    auto clock = std::make_shared<CanManualClock>();
+    CanReplayer replayer(1.0, clock);
+    replayer.mapInterface("can0", driver);
+
+    // An hour of traffic, replayed on simulated time
+    const auto start = steady_clock::now();
+    ASSERT_EQ(replayer.replay(reader), 3u);
+    ASSERT_LT(steady_clock::now() - start, milliseconds(1000));
+
+    ASSERT_EQ(clock->now().time_since_epoch(), std::chrono::hours(1));
+    ASSERT_EQ(replayer.getTimingErrorHistogram().max, 0u);
+}
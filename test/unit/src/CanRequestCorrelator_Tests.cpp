@@ -0,0 +1,99 @@
+/**
+ * @file CanRequestCorrelator_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanRequestCorrelator class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanRequestCorrelator.hpp>
+#include <exceptions/CanTimeoutException.hpp>
+
+#include <linux/can/error.h>
+
+#include <chrono>
+#include <future>
+
+using sockcanpp::CanMessage;
+using sockcanpp::CanRequestCorrelator;
+using sockcanpp::exceptions::CanTimeoutException;
+
+using std::future_status;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_matchingResponse_ExpectFutureCompleted) {
+    CanRequestCorrelator correlator;
+    auto response = correlator.expectResponse(0x7e8, CanRequestCorrelator::EXACT_MATCH, milliseconds(1000));
+
+    ASSERT_TRUE(correlator.onMessage(CanMessage(0x7e8, "\x02\x41")));
+    ASSERT_EQ(response.wait_for(milliseconds(0)), future_status::ready);
+    ASSERT_EQ(response.get().getFrameData(), "\x02\x41");
+    ASSERT_EQ(correlator.getPendingCount(), 0u);
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_unrelatedMessage_ExpectNotMatched) {
+    CanRequestCorrelator correlator;
+    auto response = correlator.expectResponse(0x7e8, CanRequestCorrelator::EXACT_MATCH, milliseconds(1000));
+
+    ASSERT_FALSE(correlator.onMessage(CanMessage(0x7e9, "")));
+    ASSERT_EQ(response.wait_for(milliseconds(0)), future_status::timeout);
+    ASSERT_EQ(correlator.getPendingCount(), 1u);
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_maskedRequest_ExpectRangeMatched) {
+    CanRequestCorrelator correlator;
+    auto response = correlator.expectResponse(0x7e8, CAN_EFF_FLAG | 0x7f8, milliseconds(1000));
+
+    ASSERT_TRUE(correlator.onMessage(CanMessage(0x7ef, "")));
+    ASSERT_EQ(response.get().getCanId(), 0x7ef);
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_twoRequestsSameId_ExpectOldestFirst) {
+    CanRequestCorrelator correlator;
+    auto first = correlator.expectResponse(0x123, CanRequestCorrelator::EXACT_MATCH, milliseconds(1000));
+    auto second = correlator.expectResponse(0x123, CanRequestCorrelator::EXACT_MATCH, milliseconds(1000));
+
+    ASSERT_TRUE(correlator.onMessage(CanMessage(0x123, "1")));
+    ASSERT_EQ(first.wait_for(milliseconds(0)), future_status::ready);
+    ASSERT_EQ(second.wait_for(milliseconds(0)), future_status::timeout);
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_noResponse_ExpectTimeout) {
+    CanRequestCorrelator correlator;
+    auto response = correlator.expectResponse(0x7e8, CanRequestCorrelator::EXACT_MATCH, milliseconds(50));
+
+    ASSERT_EQ(correlator.expire(steady_clock::now()), 0u);
+    ASSERT_EQ(correlator.expire(steady_clock::now() + seconds(1)), 1u);
+    ASSERT_THROW(response.get(), CanTimeoutException);
+    ASSERT_FALSE(correlator.onMessage(CanMessage(0x7e8, "")));
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_cancelledRequest_ExpectHandlerNotInvoked) {
+    CanRequestCorrelator correlator;
+    bool invoked = false;
+    const auto request = correlator.expectResponse(0x100, CanRequestCorrelator::EXACT_MATCH, milliseconds(50), [&](const CanMessage*) { invoked = true; });
+
+    ASSERT_TRUE(correlator.cancel(request));
+    correlator.expire(steady_clock::now() + seconds(1));
+    ASSERT_FALSE(correlator.onMessage(CanMessage(0x100, "")));
+    ASSERT_FALSE(invoked);
+}
+
+TEST(CanRequestCorrelatorTests, CanRequestCorrelator_errorFrame_ExpectNotMatched) {
+    CanRequestCorrelator correlator;
+    auto response = correlator.expectResponse(CAN_ERR_BUSOFF, CanRequestCorrelator::EXACT_MATCH, milliseconds(1000));
+
+    can_frame error{};
+    error.can_id = CAN_ERR_FLAG | CAN_ERR_BUSOFF;
+    error.can_dlc = CAN_ERR_DLC;
+
+    ASSERT_FALSE(correlator.onMessage(CanMessage(error)));
+    ASSERT_EQ(response.wait_for(milliseconds(0)), future_status::timeout);
+    ASSERT_EQ(correlator.getPendingCount(), 1u);
+}
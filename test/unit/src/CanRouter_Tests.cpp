@@ -0,0 +1,133 @@
+/**
+ * @file CanRouter_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanRouter class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanDriver.hpp>
+#include <CanRouter.hpp>
+
+#include <TestHelpers.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanRoute;
+using sockcanpp::CanRouteAction;
+using sockcanpp::CanRouter;
+
+using testhelpers::LoopbackTransport;
+
+using std::make_shared;
+using std::shared_ptr;
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace {
+
+    /**
+     * @brief Routes between two buses whose other ends are held by the test.
+     */
+    class RouterFixture {
+        public:
+            RouterFixture():
+                transport(make_shared<LoopbackTransport>()),
+                source("loop0", CAN_RAW, transport),
+                target("loop1", CAN_RAW, transport) {
+                router.addBus(source);
+                router.addBus(target);
+            }
+
+            /**
+             * @brief Injects frames on the source bus and routes them.
+             *
+             * @return vector<can_frame> The frames which arrived on the target bus.
+             */
+            vector<can_frame> route(const vector<canid_t>& ids) {
+                for (const auto id : ids) {
+                    can_frame frame{};
+                    frame.can_id = id;
+                    EXPECT_EQ(write(transport->getPeer(source.getSocketFd()), &frame, sizeof(frame)), static_cast<ssize_t>(sizeof(frame)));
+                }
+
+                EXPECT_EQ(router.processOnce(milliseconds(100)), ids.size());
+
+                vector<can_frame> received{};
+                can_frame frame{};
+
+                while (read(transport->getPeer(target.getSocketFd()), &frame, sizeof(frame)) == sizeof(frame)) { received.push_back(frame); }
+
+                return received;
+            }
+
+            shared_ptr<LoopbackTransport>   transport;
+            CanDriver                       source;
+            CanDriver                       target;
+            CanRouter                       router{};
+    };
+
+}
+
+TEST(CanRouterTests, CanRouter_standardIds_ExpectFirstMatchingRoute) {
+    RouterFixture fixture;
+    const auto range = fixture.router.addRoute(CanRoute(0, 0x100, CAN_EFF_FLAG | CAN_RTR_FLAG | 0x7F0, CanRouteAction::Forward, 1));
+    const auto shadowed = fixture.router.addRoute(CanRoute(0, 0x105, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_SFF_MASK, CanRouteAction::Drop));
+    const auto rewrite = fixture.router.addRoute(CanRoute(0, 0x200, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_SFF_MASK, CanRouteAction::Forward, 1).setNewId(0x18FEF100));
+    fixture.router.compile();
+
+    const auto received = fixture.route({ 0x100, 0x105, 0x10F, 0x110, 0x200 });
+    ASSERT_EQ(received.size(), 4u);
+    ASSERT_EQ(received[1].can_id, 0x105u);
+    ASSERT_EQ(received[3].can_id, 0x18FEF100u | CAN_EFF_FLAG);
+
+    ASSERT_EQ(fixture.router.getRouteStatistics(range).forwarded, 3u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(shadowed).matched, 0u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(rewrite).forwarded, 1u);
+    ASSERT_EQ(fixture.router.getUnroutedFrameCount(), 1u);
+    ASSERT_EQ(fixture.router.getProcessingTimeHistogram().count, 4u);
+}
+
+TEST(CanRouterTests, CanRouter_exactExtendedIds_ExpectHashedRoutes) {
+    RouterFixture fixture;
+    const auto exact = fixture.router.addRoute(CanRoute(0, 0x18FEF100 | CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_EFF_MASK, CanRouteAction::Forward, 1));
+    const auto standard = fixture.router.addRoute(CanRoute(0, 0x100, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_SFF_MASK, CanRouteAction::Forward, 1));
+
+    const auto received = fixture.route({ 0x18FEF100 | CAN_EFF_FLAG, 0x18FEF101 | CAN_EFF_FLAG, 0x18FEF100 | CAN_EFF_FLAG | CAN_RTR_FLAG, 0x100 | CAN_EFF_FLAG, 0x100 });
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0].can_id, 0x18FEF100u | CAN_EFF_FLAG);
+    ASSERT_EQ(received[1].can_id, 0x100u);
+
+    // Neither the remote request nor the extended ID which equals a standard route may match
+    ASSERT_EQ(fixture.router.getRouteStatistics(exact).matched, 1u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(standard).matched, 1u);
+    ASSERT_EQ(fixture.router.getUnroutedFrameCount(), 3u);
+}
+
+TEST(CanRouterTests, CanRouter_maskedExtendedIds_ExpectFirstMatchAcrossHashedRoutes) {
+    RouterFixture fixture;
+    const auto masked = fixture.router.addRoute(CanRoute(0, 0x18FEF100 | CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_RTR_FLAG | 0x1FFFFF00, CanRouteAction::Drop));
+    const auto shadowed = fixture.router.addRoute(CanRoute(0, 0x18FEF142 | CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_EFF_MASK, CanRouteAction::Forward, 1));
+    const auto exact = fixture.router.addRoute(CanRoute(0, 0x0CF00400 | CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_EFF_MASK, CanRouteAction::Forward, 1));
+    const auto catchAll = fixture.router.addRoute(CanRoute(0, CAN_EFF_FLAG, CAN_EFF_FLAG | CAN_RTR_FLAG, CanRouteAction::Forward, 1));
+
+    const auto received = fixture.route({ 0x18FEF142 | CAN_EFF_FLAG, 0x18FEF1FF | CAN_EFF_FLAG, 0x0CF00400 | CAN_EFF_FLAG, 0x0CF00401 | CAN_EFF_FLAG });
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0].can_id, 0x0CF00400u | CAN_EFF_FLAG);
+    ASSERT_EQ(received[1].can_id, 0x0CF00401u | CAN_EFF_FLAG);
+
+    // An earlier masked route wins over a later exact one, and an earlier exact one over a later masked one
+    ASSERT_EQ(fixture.router.getRouteStatistics(masked).dropped, 2u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(shadowed).matched, 0u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(exact).forwarded, 1u);
+    ASSERT_EQ(fixture.router.getRouteStatistics(catchAll).forwarded, 1u);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file CanScheduleAnalyser_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanScheduleAnalyser class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanFrameTiming.hpp>
+#include <CanScheduleAnalyser.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using sockcanpp::CanFrameTiming;
+using sockcanpp::CanId;
+using sockcanpp::CanScheduleAnalyser;
+using sockcanpp::CanScheduledMessage;
+
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+namespace {
+
+    CanScheduledMessage scheduled(const canid_t id, const microseconds period, const microseconds jitter = microseconds(0)) {
+        CanScheduledMessage message{};
+        message.id = CanId(id);
+        message.period = period;
+        message.jitter = jitter;
+
+        return message;
+    }
+
+}
+
+TEST(CanScheduleAnalyserTests, CanScheduleAnalyser_HandComputedSet_ExpectKnownResponseTimes) {
+    // 500 kbit/s: an 8-byte standard frame takes at most 135 bits (270us) including the interframe space
+    CanScheduleAnalyser analyser(500000);
+    ASSERT_EQ(analyser.transmissionTime(CanId(0x100), 8), microseconds(270));
+
+    const auto analysis = analyser.analyse({
+        scheduled(0x300, microseconds(2000)),
+        scheduled(0x100, microseconds(1000)),
+        scheduled(0x200, microseconds(1000)),
+    });
+
+    ASSERT_TRUE(analysis.schedulable);
+    ASSERT_NEAR(analysis.utilisation, 0.675, 1e-9);
+    ASSERT_EQ(analysis.messages.size(), 3u);
+
+    // Highest priority first; blocked by one lower priority frame, then interfered with by each higher priority one
+    ASSERT_EQ(*analysis.messages[0].id, 0x100u);
+    ASSERT_EQ(analysis.messages[0].blocking, microseconds(270));
+    ASSERT_EQ(analysis.messages[0].responseTime, microseconds(540));
+    ASSERT_EQ(*analysis.messages[1].id, 0x200u);
+    ASSERT_EQ(analysis.messages[1].queuingDelay, microseconds(540));
+    ASSERT_EQ(analysis.messages[1].responseTime, microseconds(810));
+    ASSERT_EQ(*analysis.messages[2].id, 0x300u);
+    ASSERT_EQ(analysis.messages[2].blocking, microseconds(0));
+    ASSERT_EQ(analysis.messages[2].responseTime, microseconds(810));
+
+    // Jitter of a higher priority message adds to the interference it causes
+    const auto jittered = analyser.analyse({ scheduled(0x100, microseconds(1000), microseconds(900)), scheduled(0x200, microseconds(1000)) });
+    ASSERT_EQ(jittered.messages[0].responseTime, microseconds(900 + 270 + 270));
+    ASSERT_EQ(jittered.messages[1].responseTime, microseconds(270 + 270 + 270));
+
+    ASSERT_THROW(analyser.analyse({ scheduled(0x100, microseconds(1000)), scheduled(0x100, microseconds(2000)) }), std::exception);
+    ASSERT_THROW(analyser.analyse({ scheduled(0x100, microseconds(0)) }), std::exception);
+}
+
+TEST(CanScheduleAnalyserTests, CanScheduleAnalyser_OverloadedBus_ExpectUnschedulable) {
+    CanScheduleAnalyser analyser(125000);
+
+    // Four 8-byte frames every 3ms at 125 kbit/s need at least 4.5ms
+    const auto analysis = analyser.analyse({
+        scheduled(0x010, microseconds(3000)),
+        scheduled(0x020, microseconds(3000)),
+        scheduled(0x030, microseconds(3000)),
+        scheduled(0x18FF0001, microseconds(3000)),
+    });
+
+    ASSERT_GT(analysis.utilisation, 1.0);
+    ASSERT_FALSE(analysis.schedulable);
+    ASSERT_TRUE(analysis.messages[0].schedulable);
+    ASSERT_FALSE(analysis.messages.back().schedulable);
+    ASSERT_TRUE(analysis.messages.back().id.isExtendedFrameId());
+}
+
+TEST(CanScheduleAnalyserTests, CanScheduleAnalyser_Validate_ExpectObservedWithinAnalysed) {
+    // Worst-case stuffing bounds every frame the encoder can produce
+    std::mt19937 random(7);
+    for (int i = 0; i < 1000; i++) {
+        can_frame frame{};
+        frame.can_id = (i & 1) ? (random() & CAN_EFF_MASK) | CAN_EFF_FLAG : random() & CAN_SFF_MASK;
+        frame.can_dlc = static_cast<uint8_t>(random() % 9);
+        for (auto& byte : frame.data) { byte = static_cast<uint8_t>(random()); }
+
+        ASSERT_LE(CanFrameTiming::frameBits(frame).bits, CanFrameTiming::worstCaseFrameBits((frame.can_id & CAN_EFF_FLAG) != 0, frame.can_dlc));
+    }
+
+    CanScheduleAnalyser analyser(500000);
+    const vector<CanScheduledMessage> messages{
+        scheduled(0x080, microseconds(1000), microseconds(100)),
+        scheduled(0x120, microseconds(2000)),
+        scheduled(0x121, microseconds(2000), microseconds(500)),
+        scheduled(0x200, microseconds(5000)),
+        scheduled(0x18DAF110, microseconds(10000), microseconds(1000)),
+        scheduled(0x7FF, microseconds(10000)),
+    };
+
+    const auto analysis = analyser.validate(messages, seconds(1), 3);
+    ASSERT_TRUE(analysis.schedulable);
+
+    for (const auto& message : analysis.messages) {
+        ASSERT_GT(message.observedFrames, 0u);
+        ASSERT_GT(message.observedResponseTime.count(), 0);
+        ASSERT_LE(message.observedResponseTime, message.responseTime) << std::hex << *message.id;
+    }
+
+    // Every instance released during the run is transmitted
+    ASSERT_EQ(analysis.messages[0].observedFrames, 1000u);
+}
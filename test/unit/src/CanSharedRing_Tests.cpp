@@ -0,0 +1,92 @@
+/**
+ * @file CanSharedRing_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanSharedRingPublisher and CanSharedRingConsumer classes.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanSharedRing.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using sockcanpp::CanSharedFrame;
+using sockcanpp::CanSharedRingConsumer;
+using sockcanpp::CanSharedRingPublisher;
+
+using std::thread;
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace {
+
+    can_frame makeFrame(const canid_t id, const uint8_t value) {
+        can_frame frame{};
+        frame.can_id = id;
+        frame.can_dlc = 1;
+        frame.data[0] = value;
+
+        return frame;
+    }
+
+}
+
+TEST(CanSharedRingTests, CanSharedRing_publish_ExpectFramesInOrder) {
+    CanSharedRingPublisher publisher(16);
+    CanSharedRingConsumer first(publisher.getFileDescriptor());
+    CanSharedRingConsumer second(publisher.getFileDescriptor());
+
+    for (uint8_t i = 0; i < 10; i++) { publisher.publish(makeFrame(0x100 + i, i)); }
+
+    CanSharedFrame frames[16];
+    ASSERT_EQ(first.read(frames, 16), 10u);
+    for (uint8_t i = 0; i < 10; i++) {
+        ASSERT_EQ(frames[i].frame.can_id, 0x100u + i);
+        ASSERT_EQ(frames[i].position, i);
+    }
+
+    ASSERT_EQ(second.read(frames, 4), 4u);
+    ASSERT_EQ(second.getAvailableCount(), 6u);
+    ASSERT_EQ(first.read(frames, 16), 0u);
+    ASSERT_EQ(first.getLostCount(), 0u);
+}
+
+TEST(CanSharedRingTests, CanSharedRing_slowConsumer_ExpectOverrunDetected) {
+    CanSharedRingPublisher publisher(16);
+    CanSharedRingConsumer consumer(publisher.getFileDescriptor());
+
+    for (uint32_t i = 0; i < 100; i++) { publisher.publish(makeFrame(0x100, static_cast<uint8_t>(i))); }
+
+    CanSharedFrame frames[16];
+    const auto framesRead = consumer.read(frames, 16);
+
+    ASSERT_GT(framesRead, 0u);
+    ASSERT_GT(consumer.getLostCount(), 0u);
+    ASSERT_EQ(consumer.getLostCount() + framesRead, 100u);
+    ASSERT_EQ(frames[framesRead - 1].frame.data[0], 99);
+}
+
+TEST(CanSharedRingTests, CanSharedRing_waitForFrames_ExpectWokenByPublisher) {
+    CanSharedRingPublisher publisher(1024);
+    CanSharedRingConsumer consumer(publisher.getFileDescriptor());
+
+    ASSERT_FALSE(consumer.waitForFrames(milliseconds(1)));
+
+    thread producer([&]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        vector<can_frame> batch(100, makeFrame(0x200, 0));
+        publisher.publish(batch.data(), batch.size());
+    });
+
+    ASSERT_TRUE(consumer.waitForFrames(milliseconds(5000)));
+    producer.join();
+
+    CanSharedFrame frames[128];
+    ASSERT_EQ(consumer.read(frames, 128), 100u);
+}
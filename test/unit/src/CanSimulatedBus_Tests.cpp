@@ -0,0 +1,170 @@
+/**
+ * @file CanSimulatedBus_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanSimulatedBus class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanDriver.hpp>
+#include <CanSimulatedBus.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanId;
+using sockcanpp::CanMessage;
+using sockcanpp::CanSimulatedBus;
+using sockcanpp::CanSimulatedTransmission;
+using sockcanpp::filtermap_t;
+
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+
+namespace {
+
+    size_t drain(CanDriver& driver) {
+        can_frame frames[CanDriver::CAN_MAX_BATCH_SIZE]{};
+        size_t total = 0;
+
+        for (size_t read = 0; (read = driver.readFrames(frames, CanDriver::CAN_MAX_BATCH_SIZE)) > 0;) { total += read; }
+
+        return total;
+    }
+
+}
+
+TEST(CanSimulatedBusTests, CanSimulatedBus_frameBits_ExpectExactStuffedLength) {
+    can_frame frame{};
+    ASSERT_EQ(CanSimulatedBus::frameBits(frame), 50u); // 44 bits + 6 stuff bits for the all-dominant header
+
+    frame.can_id = 0x7FF;
+    frame.can_dlc = 8;
+    for (auto& byte : frame.data) { byte = 0x55; }
+    ASSERT_GE(CanSimulatedBus::frameBits(frame), 108u); // 8 byte standard frames: 108 bits unstuffed, at most 132 stuffed
+    ASSERT_LE(CanSimulatedBus::frameBits(frame), 132u);
+
+    frame.can_id = 0x1FFFFFFF | CAN_EFF_FLAG;
+    ASSERT_GE(CanSimulatedBus::frameBits(frame), 128u); // 8 byte extended frames: 128 bits unstuffed, at most 157 stuffed
+    ASSERT_LE(CanSimulatedBus::frameBits(frame), 157u);
+}
+
+TEST(CanSimulatedBusTests, CanSimulatedBus_arbitration_ExpectLowestIdFirstAndBackToBack) {
+    auto bus = make_shared<CanSimulatedBus>(500000);
+    CanDriver first("sim0", CAN_RAW, bus);
+    CanDriver second("sim0", CAN_RAW, bus);
+    CanDriver third("sim0", CAN_RAW, bus);
+    CanDriver receiver("sim0", CAN_RAW, bus);
+
+    vector<CanSimulatedTransmission> transmissions{};
+    bus->setTransmissionHandler([&transmissions](const CanSimulatedTransmission& transmission) { transmissions.push_back(transmission); });
+
+    first.sendMessage(CanMessage(CanId(0x300), string("\x03", 1)));
+    second.sendMessage(CanMessage(CanId(0x100), string("\x01", 1)));
+    third.sendMessage(CanMessage(CanId(0x200), string("\x02", 1)));
+
+    ASSERT_EQ(bus->runFor(milliseconds(10)), 3u);
+    ASSERT_EQ(bus->now(), nanoseconds(milliseconds(10)));
+    ASSERT_EQ(transmissions.size(), 3u);
+
+    const canid_t expectedIds[] = { 0x100, 0x200, 0x300 };
+    const auto bitTime = nanoseconds(2000);
+
+    for (size_t i = 0; i < transmissions.size(); i++) {
+        ASSERT_EQ(transmissions[i].frame.can_id, expectedIds[i]);
+        ASSERT_EQ(transmissions[i].bits, CanSimulatedBus::frameBits(transmissions[i].frame));
+        ASSERT_EQ(transmissions[i].finished - transmissions[i].started, bitTime * transmissions[i].bits);
+
+        const auto expectedStart = i ? transmissions[i - 1].finished + bitTime * static_cast<int64_t>(CanSimulatedBus::INTERFRAME_BITS) : nanoseconds(0);
+        ASSERT_EQ(transmissions[i].started, expectedStart);
+    }
+
+    can_frame received[4]{};
+    ASSERT_EQ(receiver.readFrames(received, 4), 3u);
+    ASSERT_EQ(received[0].can_id, 0x100u);
+    ASSERT_EQ(received[2].can_id, 0x300u);
+
+    // Senders don't see their own frames, but each sees the other two
+    ASSERT_EQ(drain(second), 2u);
+    ASSERT_EQ(bus->getStatistics().delivered, 9u);
+}
+
+TEST(CanSimulatedBusTests, CanSimulatedBus_manyNodes_ExpectDeterministicScheduleAndBusLoad) {
+    const size_t nodeCount = 60;
+
+    auto simulate = [nodeCount](CanSimulatedBus& bus, vector<CanSimulatedTransmission>& transmissions) {
+        vector<shared_ptr<CanDriver>> nodes{};
+        shared_ptr<CanSimulatedBus> transport(&bus, [](CanSimulatedBus*) { });
+
+        for (size_t i = 0; i < nodeCount; i++) {
+            // Each node listens to its successor only
+            const auto listenTo = static_cast<canid_t>(0x100 + (i + 1) % nodeCount);
+            nodes.push_back(make_shared<CanDriver>("sim0", CAN_RAW, transport, filtermap_t{{listenTo, CAN_SFF_MASK}}));
+        }
+
+        bus.setTransmissionHandler([&transmissions](const CanSimulatedTransmission& transmission) { transmissions.push_back(transmission); });
+
+        for (size_t i = 0; i < nodeCount; i++) {
+            auto node = nodes[i];
+            auto counter = make_shared<uint32_t>(0);
+            const auto id = CanId(static_cast<canid_t>(0x100 + i));
+
+            bus.every(milliseconds(10), [node, counter, id]() {
+                const auto value = (*counter)++;
+                node->sendMessage(CanMessage(id, string(reinterpret_cast<const char*>(&value), sizeof(value))));
+            }, microseconds(static_cast<int64_t>(i * 37)));
+        }
+
+        bus.runFor(seconds(1));
+
+        size_t received = 0;
+        for (auto& node : nodes) { received += drain(*node); }
+
+        return received;
+    };
+
+    CanSimulatedBus bus(1000000);
+    vector<CanSimulatedTransmission> transmissions{};
+    const auto received = simulate(bus, transmissions);
+
+    ASSERT_EQ(transmissions.size(), nodeCount * 100);
+    ASSERT_EQ(received, nodeCount * 100);
+    ASSERT_EQ(bus.getStatistics().dropped, 0u);
+    ASSERT_EQ(bus.getPendingCount(), 0u);
+
+    uint64_t busyBits = 0;
+    for (const auto& transmission : transmissions) {
+        busyBits += transmission.bits + CanSimulatedBus::INTERFRAME_BITS;
+        ASSERT_TRUE(transmission.started >= transmission.queued);
+        ASSERT_TRUE(transmission.started - transmission.queued < milliseconds(10));
+    }
+
+    // One bit lasts 1µs at 1Mbit/s
+    ASSERT_DOUBLE_EQ(bus.getBusLoad(), static_cast<double>(busyBits) / 1000000.0);
+    ASSERT_GT(bus.getBusLoad(), 0.4);
+
+    CanSimulatedBus replay(1000000);
+    vector<CanSimulatedTransmission> replayed{};
+    simulate(replay, replayed);
+
+    ASSERT_EQ(replayed.size(), transmissions.size());
+    for (size_t i = 0; i < replayed.size(); i++) {
+        ASSERT_EQ(replayed[i].frame.can_id, transmissions[i].frame.can_id);
+        ASSERT_EQ(replayed[i].started, transmissions[i].started);
+        ASSERT_EQ(replayed[i].bits, transmissions[i].bits);
+    }
+}
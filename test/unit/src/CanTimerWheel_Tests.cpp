@@ -0,0 +1,120 @@
+/**
+ * @file CanTimerWheel_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanTimerWheel class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanTimerWheel.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using sockcanpp::CanTimerWheel;
+using sockcanpp::timerid_t;
+
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::vector;
+
+TEST(CanTimerWheelTests, CanTimerWheel_timerNotDue_ExpectNoExpiry) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+    vector<uint64_t> expired{};
+
+    wheel.schedule(origin + milliseconds(10), 1);
+
+    ASSERT_EQ(wheel.advance(origin + milliseconds(9), [&](uint64_t cookie) { expired.push_back(cookie); }), 0u);
+    ASSERT_TRUE(expired.empty());
+    ASSERT_EQ(wheel.size(), 1u);
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_timerDue_ExpectExpiry) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+    vector<uint64_t> expired{};
+
+    wheel.schedule(origin + milliseconds(10), 42);
+
+    ASSERT_EQ(wheel.advance(origin + milliseconds(10), [&](uint64_t cookie) { expired.push_back(cookie); }), 1u);
+    ASSERT_EQ(expired, vector<uint64_t>{42});
+    ASSERT_TRUE(wheel.empty());
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_timersAcrossLevels_ExpectExpiryInOrder) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+    vector<uint64_t> expired{};
+
+    wheel.schedule(origin + milliseconds(70000), 3); // third level
+    wheel.schedule(origin + milliseconds(300), 2);   // second level
+    wheel.schedule(origin + milliseconds(5), 1);     // first level
+
+    for (int32_t i = 0; i <= 70000; i += 7) {
+        wheel.advance(origin + milliseconds(i), [&](uint64_t cookie) { expired.push_back(cookie); });
+    }
+    wheel.advance(origin + milliseconds(70000), [&](uint64_t cookie) { expired.push_back(cookie); });
+
+    ASSERT_EQ(expired, (vector<uint64_t>{1, 2, 3}));
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_timerNeverFiresEarly_ExpectExpiryAtDeadline) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+    bool fired = false;
+
+    wheel.schedule(origin + milliseconds(1000), 1);
+
+    for (int32_t i = 0; i < 1000; i++) {
+        wheel.advance(origin + milliseconds(i), [&](uint64_t) { fired = true; });
+        ASSERT_FALSE(fired) << "Fired early at " << i << "ms";
+    }
+
+    wheel.advance(origin + milliseconds(1000), [&](uint64_t) { fired = true; });
+    ASSERT_TRUE(fired);
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_cancelledTimer_ExpectNoExpiry) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+
+    const auto timer = wheel.schedule(origin + milliseconds(10), 1);
+
+    ASSERT_TRUE(wheel.cancel(timer));
+    ASSERT_FALSE(wheel.cancel(timer));
+    ASSERT_EQ(wheel.advance(origin + milliseconds(20), nullptr), 0u);
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_staleHandleAfterReuse_ExpectCancelFails) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(milliseconds(1), origin);
+
+    const auto first = wheel.schedule(origin + milliseconds(1), 1);
+    wheel.advance(origin + milliseconds(1), nullptr);
+    const auto second = wheel.schedule(origin + milliseconds(10), 2);
+
+    ASSERT_NE(first, second);
+    ASSERT_FALSE(wheel.cancel(first));
+    ASSERT_EQ(wheel.size(), 1u);
+}
+
+TEST(CanTimerWheelTests, CanTimerWheel_deadlineBeyondRange_ExpectExpiry) {
+    const auto origin = steady_clock::now();
+    CanTimerWheel wheel(nanoseconds(1), origin);
+    vector<uint64_t> expired{};
+
+    wheel.schedule(origin + nanoseconds(int64_t(1) << 33), 7);
+
+    wheel.advance(origin + nanoseconds((int64_t(1) << 33) - 1), [&](uint64_t cookie) { expired.push_back(cookie); });
+    ASSERT_TRUE(expired.empty());
+
+    wheel.advance(origin + nanoseconds(int64_t(1) << 33), [&](uint64_t cookie) { expired.push_back(cookie); });
+    ASSERT_EQ(expired, vector<uint64_t>{7});
+}
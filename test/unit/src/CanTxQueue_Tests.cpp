@@ -0,0 +1,197 @@
+/**
+ * @file CanTxQueue_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanTxQueue class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanClock.hpp>
+#include <CanTxQueue.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanManualClock;
+using sockcanpp::CanTxOverflowPolicy;
+using sockcanpp::CanTxQueue;
+
+using std::thread;
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace {
+
+    /**
+     * @brief A driver without a socket which accepts a limited amount of frames, like a full interface queue.
+     */
+    class LimitedDriver: public CanDriver {
+        public:
+            size_t sendFrames(const can_frame* frames, const size_t frameCount) override {
+                const auto accepted = frameCount < budget ? frameCount : budget;
+                sent.insert(sent.end(), frames, frames + accepted);
+                budget -= accepted;
+
+                if (accepted < frameCount) { errno = ENOBUFS; }
+                return accepted;
+            }
+
+            size_t              budget{0};
+            vector<can_frame>   sent{};
+    };
+
+    can_frame makeFrame(const canid_t id) {
+        can_frame frame{};
+        frame.can_id = id;
+
+        return frame;
+    }
+
+}
+
+TEST(CanTxQueueTests, CanTxQueue_interfaceFull_ExpectFramesKeptInOrder) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 16);
+
+    for (canid_t id = 1; id <= 10; id++) { ASSERT_TRUE(queue.enqueue(makeFrame(id))); }
+
+    driver.budget = 4;
+    ASSERT_EQ(queue.flush(), 4u);
+    ASSERT_EQ(queue.getDepth(), 6u);
+
+    driver.budget = 100;
+    ASSERT_EQ(queue.flush(), 6u);
+    ASSERT_FALSE(queue.isPending());
+
+    for (canid_t id = 1; id <= 10; id++) { ASSERT_EQ(driver.sent[id - 1].can_id, id); }
+
+    const auto statistics = queue.getStatistics();
+    ASSERT_EQ(statistics.sent, 10u);
+    ASSERT_EQ(statistics.txBufferFull, 1u);
+    ASSERT_EQ(statistics.highWaterMark, 10u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_dropOldest_ExpectNewestFramesKept) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 4, CanTxOverflowPolicy::DropOldest);
+
+    for (canid_t id = 1; id <= 6; id++) { ASSERT_TRUE(queue.enqueue(makeFrame(id))); }
+
+    driver.budget = 100;
+    queue.flush();
+
+    ASSERT_EQ(driver.sent.size(), 4u);
+    ASSERT_EQ(driver.sent.front().can_id, 3u);
+    ASSERT_EQ(queue.getStatistics().droppedOldest, 2u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_dropNewest_ExpectOldestFramesKept) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 4, CanTxOverflowPolicy::DropNewest);
+
+    for (canid_t id = 1; id <= 6; id++) { queue.enqueue(makeFrame(id)); }
+
+    driver.budget = 100;
+    queue.flush();
+
+    ASSERT_EQ(driver.sent.size(), 4u);
+    ASSERT_EQ(driver.sent.back().can_id, 4u);
+    ASSERT_EQ(queue.getStatistics().droppedNewest, 2u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_block_ExpectWaitForFlushOrTimeout) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 1, CanTxOverflowPolicy::Block, milliseconds(20));
+
+    ASSERT_TRUE(queue.enqueue(makeFrame(1)));
+    ASSERT_FALSE(queue.enqueue(makeFrame(2)));
+    ASSERT_EQ(queue.getStatistics().blockTimeouts, 1u);
+
+    CanTxQueue blockingQueue(driver, 1, CanTxOverflowPolicy::Block, milliseconds(5000));
+    ASSERT_TRUE(blockingQueue.enqueue(makeFrame(3)));
+
+    driver.budget = 1;
+    thread flusher([&]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        blockingQueue.flush();
+    });
+
+    ASSERT_TRUE(blockingQueue.enqueue(makeFrame(4)));
+    flusher.join();
+
+    ASSERT_EQ(driver.sent.back().can_id, 3u);
+    ASSERT_EQ(blockingQueue.getDepth(), 1u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_coalescing_ExpectNewestPayloadInOriginalPosition) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 16);
+    queue.setCoalescing(true);
+
+    auto update = makeFrame(0x100);
+    for (uint8_t value = 1; value <= 5; value++) {
+        update.data[0] = value;
+        queue.enqueue(update);
+        queue.enqueue(makeFrame(0x200 + value));
+    }
+
+    ASSERT_EQ(queue.getDepth(), 6u);
+    ASSERT_EQ(queue.getStatistics().coalesced, 4u);
+
+    driver.budget = 100;
+    queue.flush();
+
+    ASSERT_EQ(driver.sent.front().can_id, 0x100u);
+    ASSERT_EQ(driver.sent.front().data[0], 5);
+    ASSERT_EQ(driver.sent[1].can_id, 0x201u);
+
+    // Once sent, the next update is queued again
+    queue.enqueue(update);
+    ASSERT_EQ(queue.getDepth(), 1u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_deadlinePassed_ExpectFrameDiscardedNotSent) {
+    LimitedDriver driver;
+    CanTxQueue queue(driver, 2, CanTxOverflowPolicy::DropNewest);
+    const auto now = std::chrono::steady_clock::now();
+
+    ASSERT_TRUE(queue.enqueue(makeFrame(1), now - milliseconds(1)));
+    ASSERT_TRUE(queue.enqueue(makeFrame(2), now + milliseconds(60000)));
+
+    // The expired frame frees its room instead of the new frame being dropped
+    ASSERT_TRUE(queue.enqueue(makeFrame(3)));
+    ASSERT_EQ(queue.getDepth(), 2u);
+
+    driver.budget = 100;
+    ASSERT_EQ(queue.flush(), 2u);
+    ASSERT_EQ(driver.sent.front().can_id, 2u);
+    ASSERT_EQ(driver.sent.back().can_id, 3u);
+
+    const auto statistics = queue.getStatistics();
+    ASSERT_EQ(statistics.expired, 1u);
+    ASSERT_EQ(statistics.droppedNewest, 0u);
+}
+
+TEST(CanTxQueueTests, CanTxQueue_manualClock_ExpectDeadlinesOnQueueClock) {
+    LimitedDriver driver;
+    auto clock = std::make_shared<CanManualClock>();
+    CanTxQueue queue(driver, 16, CanTxOverflowPolicy::DropOldest, milliseconds(100), clock);
+
+    ASSERT_TRUE(queue.enqueue(makeFrame(1), clock->now() + milliseconds(10)));
+    ASSERT_TRUE(queue.enqueue(makeFrame(2), clock->now() + milliseconds(30)));
+
+    clock->advance(milliseconds(20));
+
+    driver.budget = 100;
+    ASSERT_EQ(queue.flush(), 1u);
+    ASSERT_EQ(driver.sent.front().can_id, 2u);
+    ASSERT_EQ(queue.getStatistics().expired, 1u);
+}
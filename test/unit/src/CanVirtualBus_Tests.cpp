@@ -0,0 +1,92 @@
+/**
+ * @file CanVirtualBus_Tests.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains all the unit tests for the CanVirtualBus class.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ */
+
+#include <gtest/gtest.h>
+
+#include <CanDriver.hpp>
+#include <CanVirtualBus.hpp>
+
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanId;
+using sockcanpp::CanMessage;
+using sockcanpp::CanVirtualBus;
+using sockcanpp::filtermap_t;
+
+using std::make_shared;
+using std::string;
+using std::chrono::milliseconds;
+
+TEST(CanVirtualBusTests, CanVirtualBus_sendMessage_ExpectLoopbackToOtherSocketsOnly) {
+    auto bus = make_shared<CanVirtualBus>();
+    CanDriver sender("vcan0", CAN_RAW, bus);
+    CanDriver receiver("vcan0", CAN_RAW, bus);
+
+    ASSERT_EQ(bus->getSocketCount(), 2u);
+
+    sender.sendMessage(CanMessage(CanId(0x123), string("\x01\x02\x03", 3)));
+    sender.sendMessage(CanMessage(CanId(0x18FEF100), string("\xAA", 1)));
+
+    ASSERT_TRUE(receiver.waitForMessages(milliseconds(1000)));
+
+    auto received = receiver.readQueuedMessages();
+    while (received.size() < 2 && receiver.waitForMessages(milliseconds(1000))) {
+        auto more = receiver.readQueuedMessages();
+        for (; !more.empty(); more.pop()) { received.push(more.front()); }
+    }
+
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(*received.front().getCanId(), 0x123u);
+    ASSERT_EQ(received.front().getFrameData(), string("\x01\x02\x03", 3));
+    received.pop();
+    ASSERT_EQ(*received.front().getCanId(), 0x18FEF100u | CAN_EFF_FLAG);
+
+    // The sender doesn't see its own frames
+    ASSERT_FALSE(sender.waitForMessages(milliseconds(20)));
+    ASSERT_THROW(sender.setTxConfirmation(true), std::exception);
+}
+
+TEST(CanVirtualBusTests, CanVirtualBus_filters_ExpectOnlyMatchingFrames) {
+    auto bus = make_shared<CanVirtualBus>();
+    CanDriver sender("vcan0", CAN_RAW, bus);
+    CanDriver filtered("vcan0", CAN_RAW, bus, filtermap_t{{0x100, CAN_SFF_MASK}});
+    CanDriver unfiltered("vcan0", CAN_RAW, bus);
+
+    can_frame frames[3]{};
+    frames[0].can_id = 0x100;
+    frames[1].can_id = 0x200;
+    frames[2].can_id = 0x100;
+    frames[2].can_dlc = 1;
+    ASSERT_EQ(sender.sendFrames(frames, 3), 3u);
+
+    can_frame received[8]{};
+    size_t filteredCount = 0;
+    size_t unfilteredCount = 0;
+
+    while (filteredCount < 2 && filtered.waitForMessages(milliseconds(1000))) { filteredCount += filtered.readFrames(received + filteredCount, 8 - filteredCount); }
+    ASSERT_EQ(filteredCount, 2u);
+    ASSERT_EQ(received[0].can_id, 0x100u);
+    ASSERT_EQ(received[1].can_dlc, 1);
+
+    while (unfilteredCount < 3 && unfiltered.waitForMessages(milliseconds(1000))) { unfilteredCount += unfiltered.readFrames(received + unfilteredCount, 8 - unfilteredCount); }
+    ASSERT_EQ(unfilteredCount, 3u);
+    ASSERT_EQ(received[1].can_id, 0x200u);
+
+    // Replacing the filters takes effect for subsequent frames
+    filtered.setCanFilters(filtermap_t{{0x200, CAN_SFF_MASK}});
+    ASSERT_EQ(sender.sendFrames(frames, 2), 2u);
+    ASSERT_TRUE(filtered.waitForMessages(milliseconds(1000)));
+    ASSERT_EQ(filtered.readFrames(received, 8), 1u);
+    ASSERT_EQ(received[0].can_id, 0x200u);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file Main.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of cancapture, a tool extracting the last frames from a capture ring.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <net/if.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <CanCandump.hpp>
+#include <CanCaptureRing.hpp>
+#include <exceptions/CanInitException.hpp>
+
+using sockcanpp::CanCandump;
+using sockcanpp::CanCaptureDump;
+using sockcanpp::CanCaptureRing;
+using sockcanpp::CanRecord;
+using sockcanpp::CAN_RECORD_BRS;
+using sockcanpp::CAN_RECORD_ESI;
+using sockcanpp::CAN_RECORD_FD;
+using sockcanpp::exceptions::CanInitException;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::to_string;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+void printHelp(string);
+void printRecord(const CanRecord& record);
+
+int main(int32_t argCount, char** argValues) {
+    string ringPath{};
+    size_t frameCount = 0;
+
+    for (int32_t i = 1; i < argCount; i++) {
+        const string argument = argValues[i];
+
+        if (argument == "--help" || argument == "-h") {
+            printHelp(argValues[0]);
+            return 0;
+        } else if (argument == "-ring" && i + 1 < argCount) {
+            ringPath = argValues[++i];
+        } else if (argument == "-count" && i + 1 < argCount) {
+            frameCount = static_cast<size_t>(std::strtoull(argValues[++i], nullptr, 10));
+        } else {
+            printHelp(argValues[0]);
+            return -1;
+        }
+    }
+
+    if (ringPath.empty()) {
+        printHelp(argValues[0]);
+        return -1;
+    }
+
+    try {
+        const auto dump = CanCaptureRing::extract(ringPath, frameCount);
+
+        for (const auto& record : dump.records) { printRecord(record); }
+
+        cerr << "Extracted " << dump.records.size() << " of " << dump.written << " frame(s) written by process " << dump.pid;
+        if (dump.torn) { cerr << "; skipped " << dump.torn << " incomplete frame(s)"; }
+        cerr << endl;
+    } catch (CanInitException& ex) {
+        cerr << "An error occurred while extracting the capture: " << ex.what() << endl;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Prints a record as a candump log line.
+ */
+void printRecord(const CanRecord& record) {
+    char interface[IF_NAMESIZE]{};
+    if (!record.ifindex || !if_indextoname(static_cast<uint32_t>(record.ifindex), interface)) {
+        strncpy(interface, ("if" + to_string(record.ifindex)).c_str(), IF_NAMESIZE - 1);
+    }
+
+    const auto timestamp = system_clock::time_point(std::chrono::duration_cast<system_clock::duration>(nanoseconds(record.timestamp)));
+    char line[CanCandump::MAX_LINE_LENGTH];
+    size_t length = 0;
+
+    if (record.flags & CAN_RECORD_FD) {
+        canfd_frame frame{};
+        frame.can_id = record.canId;
+        frame.len = record.length;
+        if (record.flags & CAN_RECORD_BRS) { frame.flags |= CANFD_BRS; }
+        if (record.flags & CAN_RECORD_ESI) { frame.flags |= CANFD_ESI; }
+        memcpy(frame.data, record.data, record.length);
+
+        length = CanCandump::format(line, sizeof(line), frame, interface, timestamp);
+    } else {
+        can_frame frame{};
+        frame.can_id = record.canId;
+        frame.can_dlc = record.length;
+        memcpy(frame.data, record.data, record.length);
+
+        length = CanCandump::format(line, sizeof(line), frame, interface, timestamp);
+    }
+
+    cout.write(line, static_cast<std::streamsize>(length));
+}
+
+void printHelp(string appname) {
+    cout << appname << endl << endl
+         << "-h\t\tPrints this menu" << endl
+         << "--help\t\tPrints this menu" << endl
+         << "-ring <path>\tThe file backing the capture ring, e.g. /dev/shm/can0.ring" << endl
+         << "-count <n>\tThe amount of most recent frames to extract (default: the whole ring)" << endl;
+}
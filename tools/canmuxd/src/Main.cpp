@@ -0,0 +1,113 @@
+/**
+ * @file Main.cpp
+ * @author Simon Cahill (contact@simonc.eu)
+ * @brief Contains the implementation of canmuxd, a daemon sharing CAN interfaces with local clients.
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026 Simon Cahill and Contributors.
+ *
+ *  Copyright 2026 Simon Cahill
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <CanDriver.hpp>
+#include <CanMuxServer.hpp>
+#include <exceptions/CanException.hpp>
+#include <exceptions/CanInitException.hpp>
+
+using sockcanpp::CanDriver;
+using sockcanpp::CanMuxServer;
+using sockcanpp::exceptions::CanException;
+using sockcanpp::exceptions::CanInitException;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace {
+    CanMuxServer* runningServer = nullptr;
+
+    void onSignal(int) {
+        if (runningServer) { runningServer->stop(); }
+    }
+}
+
+void printHelp(string);
+
+int main(int32_t argCount, char** argValues) {
+    string socketPath = "/run/canmuxd.sock";
+    vector<string> canInterfaces{};
+
+    for (int32_t i = 1; i < argCount; i++) {
+        const string argument = argValues[i];
+
+        if (argument == "--help" || argument == "-h") {
+            printHelp(argValues[0]);
+            return 0;
+        } else if (argument == "-socket" && i + 1 < argCount) {
+            socketPath = argValues[++i];
+        } else if (argument == "-iface" && i + 1 < argCount) {
+            canInterfaces.push_back(argValues[++i]);
+        } else {
+            printHelp(argValues[0]);
+            return -1;
+        }
+    }
+
+    if (canInterfaces.empty()) { canInterfaces.push_back("can0"); }
+
+    try {
+        vector<unique_ptr<CanDriver>> canDrivers{};
+        CanMuxServer server(socketPath);
+
+        for (const auto& canInterface : canInterfaces) {
+            canDrivers.emplace_back(new CanDriver(canInterface, CanDriver::CAN_SOCK_RAW));
+            server.addBus(canInterface, *canDrivers.back());
+        }
+
+        runningServer = &server;
+        signal(SIGINT, onSignal);
+        signal(SIGTERM, onSignal);
+
+        cout << "Serving " << canInterfaces.size() << " interface(s) on " << socketPath << endl;
+        server.run();
+        runningServer = nullptr;
+    } catch (CanInitException& ex) {
+        cerr << "An error occurred while initialising canmuxd: " << ex.what() << endl;
+        return -1;
+    } catch (CanException& ex) {
+        cerr << "An error occurred while serving clients: " << ex.what() << endl;
+        return -1;
+    }
+
+    return 0;
+}
+
+void printHelp(string appname) {
+    cout << appname << endl << endl
+         << "-h\t\tPrints this menu" << endl
+         << "--help\t\tPrints this menu" << endl
+         << "-socket <path>\tThe Unix socket clients connect to (default: /run/canmuxd.sock)" << endl
+         << "-iface <can_iface>\tAn interface to serve; may be given several times (default: can0)" << endl;
+}